@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 2025.01.19
+// File Version: 2026.10.16
 
 #include <GTLGraphicsPCH.h>
 #include <GTL/Utility/Exceptions.h>
@@ -11,12 +11,12 @@
 #include <GTL/Mathematics/Distance/ND/DistLineSegment.h>
 #include <GTL/Mathematics/Distance/ND/DistPointLine.h>
 #include <GTL/Graphics/SceneGraph/Picking/Picker.h>
-#include <thread>
 using namespace gtl;
 
-Picker::Picker(uint32_t numThreads)
+Picker::Picker(uint32_t numThreads, ThreadPool* pool)
     :
     mNumThreads(numThreads > 1 ? numThreads : 1),
+    mPool(pool),
     mMaxDistance(0.0f),
     mOrigin{ 0.0f, 0.0f, 0.0f, 1.0f },
     mDirection{ 0.0f, 0.0f, 0.0f, 0.0f },
@@ -267,24 +267,17 @@ void Picker::PickTriangles(std::shared_ptr<Visual> const& visual, char const* po
         imax[static_cast<size_t>(numThreads) - 1] = firstTriangle + numTriangles - 1;
 
         // Process blocks of items in multiple threads.
-        std::vector<std::thread> process(numThreads);
         std::vector<std::vector<PickRecord>> threadOutputs(numThreads);
-        for (uint32_t t = 0; t < numThreads; ++t)
-        {
-            auto const i0 = imin[t];
-            auto const i1 = imax[t];
-            process[t] = std::thread(
-                [this, t, visual, positions, vstride, ibuffer, line, i0, i1, &threadOutputs]()
-                {
-                    PickTriangles(visual, positions, vstride, ibuffer, line,
-                        i0, i1, threadOutputs[t]);
-                });
-        }
+        ForkJoin(mPool, numThreads,
+            [this, &visual, positions, vstride, ibuffer, &line, &imin, &imax, &threadOutputs](std::size_t t)
+            {
+                PickTriangles(visual, positions, vstride, ibuffer, line,
+                    imin[t], imax[t], threadOutputs[t]);
+            });
 
-        // Wait for all threads to finish.
+        // Gather the outputs in thread order.
         for (uint32_t t = 0; t < numThreads; ++t)
         {
-            process[t].join();
             std::copy(threadOutputs[t].begin(), threadOutputs[t].end(), std::back_inserter(records));
         }
     }
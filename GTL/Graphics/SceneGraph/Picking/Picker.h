@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 2025.01.19
+// File Version: 2026.10.16
 
 #pragma once
 
@@ -11,6 +11,7 @@
 #include <GTL/Graphics/SceneGraph/Hierarchy/Node.h>
 #include <GTL/Graphics/SceneGraph/Hierarchy/Visual.h>
 #include <GTL/Graphics/SceneGraph/Picking/PickRecord.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <cstdint>
 
 namespace gtl
@@ -20,8 +21,10 @@ namespace gtl
     public:
         // Construction and destruction. Set the numThreads parameter to a
         // value larger than 1 for multithreaded picking of triangle
-        // primitives.
-        Picker(uint32_t numThreads = 1);
+        // primitives. If 'pool' is not null, the picking tasks are executed
+        // by the pool workers; otherwise, std::thread objects are launched
+        // for each pick.
+        Picker(uint32_t numThreads = 1, ThreadPool* pool = nullptr);
         ~Picker() = default;
 
         // Set the maximum distance when the 'scene' contains point or segment
@@ -80,6 +83,7 @@ namespace gtl
         // The maximum number of threads that may be used to perform picking
         // requests for triangle primitives.
         uint32_t mNumThreads;
+        ThreadPool* mPool;
 
         // The maximum distance from the pick line used to select point or
         // segment primitives.
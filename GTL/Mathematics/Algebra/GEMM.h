@@ -0,0 +1,478 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// General matrix multiplication C += op(A) * op(B) for row-major matrices,
+// where op(A) is A or A^T and op(B) is B or B^T. The product op(A)*op(B) is
+// numRows-by-numCols and the common dimension is numCommon. When transposeA
+// is 'false', A is stored as numRows-by-numCommon; otherwise, A is stored as
+// numCommon-by-numRows. When transposeB is 'false', B is stored as
+// numCommon-by-numCols; otherwise, B is stored as numCols-by-numCommon.
+//
+// For 'float' and 'double', the product is computed by a cache-blocked
+// algorithm in the style of K. Goto and R. van de Geijn, "Anatomy of
+// High-Performance Matrix Multiplication," ACM Transactions on Mathematical
+// Software, Volume 34, Number 3, Article 12, 2008. Blocks of op(B) and op(A)
+// are packed into contiguous panels, which also absorbs the transposes, and
+// a micro-kernel computes MR-by-NR tiles of the product. The micro-kernel
+// uses AVX2 and FMA intrinsics when __AVX2__ and __FMA__ are defined (for
+// example, g++ -mavx2 -mfma or MSVC /arch:AVX2) and NEON intrinsics on
+// 64-bit ARM. Otherwise a portable micro-kernel is used. Small products are
+// computed by the triple loop, which avoids the packing costs.
+//
+// For all other types, including exact rational types such as BSRational,
+// the product is computed by the triple loop. The elements are accumulated
+// in the same order as the triple loop of the Matrix multiplication
+// functions, so the results are unchanged.
+//
+// The rows of the product can be partitioned among numThreads threads. Each
+// element of C is computed by one thread in an order that does not depend
+// on the partition, so the results are the same for any number of threads.
+// If 'pool' is not null, the threads are those of the pool.
+
+#include <GTL/Mathematics/Arithmetic/Constants.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#define GTL_USE_GEMM_AVX2
+#include <immintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define GTL_USE_GEMM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace gtl
+{
+    // The micro-kernel computes tile = a*b for an MR-by-kc panel a and a
+    // kc-by-NR panel b. The panel a stores MR elements for each k and the
+    // panel b stores NR elements for each k. The tile is MR-by-NR and stored
+    // in row-major order. The portable kernel is used for any type T that
+    // does not have a SIMD kernel.
+    template <typename T>
+    struct GEMMKernel
+    {
+        static std::size_t constexpr MR = 4;
+        static std::size_t constexpr NR = 4;
+
+        static void Compute(std::size_t kc, T const* a, T const* b, T* tile)
+        {
+            T accum[MR * NR] = {};
+            for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR)
+            {
+                for (std::size_t i = 0; i < MR; ++i)
+                {
+                    for (std::size_t j = 0; j < NR; ++j)
+                    {
+                        accum[i * NR + j] += a[i] * b[j];
+                    }
+                }
+            }
+            std::copy(accum, accum + MR * NR, tile);
+        }
+    };
+
+#if defined(GTL_USE_GEMM_AVX2)
+    template <>
+    struct GEMMKernel<double>
+    {
+        static std::size_t constexpr MR = 6;
+        static std::size_t constexpr NR = 8;
+
+        static void Compute(std::size_t kc, double const* a, double const* b, double* tile)
+        {
+            __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+            __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+            __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+            __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+            __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+            __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+            for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR)
+            {
+                __m256d const b0 = _mm256_loadu_pd(b);
+                __m256d const b1 = _mm256_loadu_pd(b + 4);
+                __m256d ai = _mm256_broadcast_sd(a);
+                c00 = _mm256_fmadd_pd(ai, b0, c00);
+                c01 = _mm256_fmadd_pd(ai, b1, c01);
+                ai = _mm256_broadcast_sd(a + 1);
+                c10 = _mm256_fmadd_pd(ai, b0, c10);
+                c11 = _mm256_fmadd_pd(ai, b1, c11);
+                ai = _mm256_broadcast_sd(a + 2);
+                c20 = _mm256_fmadd_pd(ai, b0, c20);
+                c21 = _mm256_fmadd_pd(ai, b1, c21);
+                ai = _mm256_broadcast_sd(a + 3);
+                c30 = _mm256_fmadd_pd(ai, b0, c30);
+                c31 = _mm256_fmadd_pd(ai, b1, c31);
+                ai = _mm256_broadcast_sd(a + 4);
+                c40 = _mm256_fmadd_pd(ai, b0, c40);
+                c41 = _mm256_fmadd_pd(ai, b1, c41);
+                ai = _mm256_broadcast_sd(a + 5);
+                c50 = _mm256_fmadd_pd(ai, b0, c50);
+                c51 = _mm256_fmadd_pd(ai, b1, c51);
+            }
+            _mm256_storeu_pd(tile, c00);
+            _mm256_storeu_pd(tile + 4, c01);
+            _mm256_storeu_pd(tile + 8, c10);
+            _mm256_storeu_pd(tile + 12, c11);
+            _mm256_storeu_pd(tile + 16, c20);
+            _mm256_storeu_pd(tile + 20, c21);
+            _mm256_storeu_pd(tile + 24, c30);
+            _mm256_storeu_pd(tile + 28, c31);
+            _mm256_storeu_pd(tile + 32, c40);
+            _mm256_storeu_pd(tile + 36, c41);
+            _mm256_storeu_pd(tile + 40, c50);
+            _mm256_storeu_pd(tile + 44, c51);
+        }
+    };
+
+    template <>
+    struct GEMMKernel<float>
+    {
+        static std::size_t constexpr MR = 6;
+        static std::size_t constexpr NR = 16;
+
+        static void Compute(std::size_t kc, float const* a, float const* b, float* tile)
+        {
+            __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+            __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+            __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+            __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+            __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+            __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+            for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR)
+            {
+                __m256 const b0 = _mm256_loadu_ps(b);
+                __m256 const b1 = _mm256_loadu_ps(b + 8);
+                __m256 ai = _mm256_broadcast_ss(a);
+                c00 = _mm256_fmadd_ps(ai, b0, c00);
+                c01 = _mm256_fmadd_ps(ai, b1, c01);
+                ai = _mm256_broadcast_ss(a + 1);
+                c10 = _mm256_fmadd_ps(ai, b0, c10);
+                c11 = _mm256_fmadd_ps(ai, b1, c11);
+                ai = _mm256_broadcast_ss(a + 2);
+                c20 = _mm256_fmadd_ps(ai, b0, c20);
+                c21 = _mm256_fmadd_ps(ai, b1, c21);
+                ai = _mm256_broadcast_ss(a + 3);
+                c30 = _mm256_fmadd_ps(ai, b0, c30);
+                c31 = _mm256_fmadd_ps(ai, b1, c31);
+                ai = _mm256_broadcast_ss(a + 4);
+                c40 = _mm256_fmadd_ps(ai, b0, c40);
+                c41 = _mm256_fmadd_ps(ai, b1, c41);
+                ai = _mm256_broadcast_ss(a + 5);
+                c50 = _mm256_fmadd_ps(ai, b0, c50);
+                c51 = _mm256_fmadd_ps(ai, b1, c51);
+            }
+            _mm256_storeu_ps(tile, c00);
+            _mm256_storeu_ps(tile + 8, c01);
+            _mm256_storeu_ps(tile + 16, c10);
+            _mm256_storeu_ps(tile + 24, c11);
+            _mm256_storeu_ps(tile + 32, c20);
+            _mm256_storeu_ps(tile + 40, c21);
+            _mm256_storeu_ps(tile + 48, c30);
+            _mm256_storeu_ps(tile + 56, c31);
+            _mm256_storeu_ps(tile + 64, c40);
+            _mm256_storeu_ps(tile + 72, c41);
+            _mm256_storeu_ps(tile + 80, c50);
+            _mm256_storeu_ps(tile + 88, c51);
+        }
+    };
+#elif defined(GTL_USE_GEMM_NEON)
+    template <>
+    struct GEMMKernel<double>
+    {
+        static std::size_t constexpr MR = 4;
+        static std::size_t constexpr NR = 8;
+
+        static void Compute(std::size_t kc, double const* a, double const* b, double* tile)
+        {
+            float64x2_t c[MR][4];
+            for (std::size_t i = 0; i < MR; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    c[i][j] = vdupq_n_f64(0.0);
+                }
+            }
+
+            for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR)
+            {
+                float64x2_t const b0 = vld1q_f64(b);
+                float64x2_t const b1 = vld1q_f64(b + 2);
+                float64x2_t const b2 = vld1q_f64(b + 4);
+                float64x2_t const b3 = vld1q_f64(b + 6);
+                for (std::size_t i = 0; i < MR; ++i)
+                {
+                    float64x2_t const ai = vdupq_n_f64(a[i]);
+                    c[i][0] = vfmaq_f64(c[i][0], ai, b0);
+                    c[i][1] = vfmaq_f64(c[i][1], ai, b1);
+                    c[i][2] = vfmaq_f64(c[i][2], ai, b2);
+                    c[i][3] = vfmaq_f64(c[i][3], ai, b3);
+                }
+            }
+
+            for (std::size_t i = 0; i < MR; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    vst1q_f64(tile + i * NR + 2 * j, c[i][j]);
+                }
+            }
+        }
+    };
+
+    template <>
+    struct GEMMKernel<float>
+    {
+        static std::size_t constexpr MR = 4;
+        static std::size_t constexpr NR = 16;
+
+        static void Compute(std::size_t kc, float const* a, float const* b, float* tile)
+        {
+            float32x4_t c[MR][4];
+            for (std::size_t i = 0; i < MR; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    c[i][j] = vdupq_n_f32(0.0f);
+                }
+            }
+
+            for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR)
+            {
+                float32x4_t const b0 = vld1q_f32(b);
+                float32x4_t const b1 = vld1q_f32(b + 4);
+                float32x4_t const b2 = vld1q_f32(b + 8);
+                float32x4_t const b3 = vld1q_f32(b + 12);
+                for (std::size_t i = 0; i < MR; ++i)
+                {
+                    float32x4_t const ai = vdupq_n_f32(a[i]);
+                    c[i][0] = vfmaq_f32(c[i][0], ai, b0);
+                    c[i][1] = vfmaq_f32(c[i][1], ai, b1);
+                    c[i][2] = vfmaq_f32(c[i][2], ai, b2);
+                    c[i][3] = vfmaq_f32(c[i][3], ai, b3);
+                }
+            }
+
+            for (std::size_t i = 0; i < MR; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    vst1q_f32(tile + i * NR + 4 * j, c[i][j]);
+                }
+            }
+        }
+    };
+#endif
+
+    template <typename T>
+    class GEMM
+    {
+    public:
+        // The blocked algorithm is used for 'float' and 'double'.
+        static bool constexpr isBlocked =
+            std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+        // The blocked algorithm is used when numRows*numCols*numCommon is
+        // at least this number. Smaller products use the triple loop.
+        static std::size_t constexpr minBlockedProduct = 16 * 16 * 16;
+
+        // The block sizes of the blocked algorithm. The packed block of
+        // op(A) is MC-by-KC and should fit in the L2 cache. The packed block
+        // of op(B) is KC-by-NC and should fit in the L3 cache.
+        static std::size_t constexpr MC = 16 * GEMMKernel<T>::MR;
+        static std::size_t constexpr KC = 256;
+        static std::size_t constexpr NC = 1024;
+
+        // Compute C += op(A)*op(B). See the comments at the beginning of
+        // this file.
+        static void Multiply(bool transposeA, bool transposeB,
+            std::size_t numRows, std::size_t numCols, std::size_t numCommon,
+            T const* A, T const* B, T* C,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            Operands const op{ transposeA, transposeB, numRows, numCols, numCommon, A, B, C };
+            numThreads = std::max(std::min(numThreads, numRows), static_cast<std::size_t>(1));
+            if (numThreads == 1)
+            {
+                MultiplyRows(op, 0, numRows, std::integral_constant<bool, isBlocked>{});
+                return;
+            }
+
+            // Partition the rows into numThreads subsets whose sizes are
+            // multiples of MR, except possibly for the last subset.
+            std::size_t constexpr MR = GEMMKernel<T>::MR;
+            std::size_t const numPanels = (numRows + MR - 1) / MR;
+            numThreads = std::min(numThreads, numPanels);
+            ForkJoin(pool, numThreads,
+                [&op, numRows, numPanels, numThreads](std::size_t t)
+                {
+                    std::size_t const rmin = std::min(MR * ((t * numPanels) / numThreads), numRows);
+                    std::size_t const rsup = std::min(MR * (((t + 1) * numPanels) / numThreads), numRows);
+                    MultiplyRows(op, rmin, rsup, std::integral_constant<bool, isBlocked>{});
+                });
+        }
+
+    private:
+        struct Operands
+        {
+            bool transposeA, transposeB;
+            std::size_t numRows, numCols, numCommon;
+            T const* A;
+            T const* B;
+            T* C;
+
+            // Access to op(A)(i,k) and op(B)(k,j).
+            inline T const& GetA(std::size_t i, std::size_t k) const
+            {
+                return (transposeA ? A[k * numRows + i] : A[i * numCommon + k]);
+            }
+
+            inline T const& GetB(std::size_t k, std::size_t j) const
+            {
+                return (transposeB ? B[j * numCommon + k] : B[k * numCols + j]);
+            }
+        };
+
+        // The triple loop for rows rmin <= row < rsup of the product.
+        static void MultiplyRowsTripleLoop(Operands const& op, std::size_t rmin, std::size_t rsup)
+        {
+            for (std::size_t row = rmin; row < rsup; ++row)
+            {
+                T* cRow = op.C + row * op.numCols;
+                for (std::size_t col = 0; col < op.numCols; ++col)
+                {
+                    for (std::size_t i = 0; i < op.numCommon; ++i)
+                    {
+                        cRow[col] += op.GetA(row, i) * op.GetB(i, col);
+                    }
+                }
+            }
+        }
+
+        static void MultiplyRows(Operands const& op, std::size_t rmin, std::size_t rsup,
+            std::false_type)
+        {
+            MultiplyRowsTripleLoop(op, rmin, rsup);
+        }
+
+        static void MultiplyRows(Operands const& op, std::size_t rmin, std::size_t rsup,
+            std::true_type)
+        {
+            if (op.numRows * op.numCols * op.numCommon < minBlockedProduct)
+            {
+                MultiplyRowsTripleLoop(op, rmin, rsup);
+                return;
+            }
+
+            std::size_t constexpr MR = GEMMKernel<T>::MR;
+            std::size_t constexpr NR = GEMMKernel<T>::NR;
+            std::size_t const kcMax = std::min(static_cast<std::size_t>(KC), op.numCommon);
+            std::size_t const ncMax = std::min(static_cast<std::size_t>(NC), op.numCols);
+            std::size_t const mcMax = std::min(static_cast<std::size_t>(MC), rsup - rmin);
+            std::vector<T> packedA(kcMax * RoundUp(mcMax, MR));
+            std::vector<T> packedB(kcMax * RoundUp(ncMax, NR));
+            T tile[MR * NR];
+
+            for (std::size_t jc = 0; jc < op.numCols; jc += NC)
+            {
+                std::size_t const nc = std::min(static_cast<std::size_t>(NC), op.numCols - jc);
+                for (std::size_t pc = 0; pc < op.numCommon; pc += KC)
+                {
+                    std::size_t const kc = std::min(static_cast<std::size_t>(KC), op.numCommon - pc);
+                    PackB(op, pc, kc, jc, nc, packedB.data());
+                    for (std::size_t ic = rmin; ic < rsup; ic += MC)
+                    {
+                        std::size_t const mc = std::min(static_cast<std::size_t>(MC), rsup - ic);
+                        PackA(op, ic, mc, pc, kc, packedA.data());
+                        for (std::size_t jr = 0; jr < nc; jr += NR)
+                        {
+                            std::size_t const nr = std::min(NR, nc - jr);
+                            T const* b = packedB.data() + jr * kc;
+                            for (std::size_t ir = 0; ir < mc; ir += MR)
+                            {
+                                std::size_t const mr = std::min(MR, mc - ir);
+                                GEMMKernel<T>::Compute(kc, packedA.data() + ir * kc, b, tile);
+
+                                T* c = op.C + (ic + ir) * op.numCols + jc + jr;
+                                for (std::size_t i = 0; i < mr; ++i, c += op.numCols)
+                                {
+                                    T const* tileRow = tile + i * NR;
+                                    for (std::size_t j = 0; j < nr; ++j)
+                                    {
+                                        c[j] += tileRow[j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        static inline std::size_t RoundUp(std::size_t n, std::size_t multiple)
+        {
+            return ((n + multiple - 1) / multiple) * multiple;
+        }
+
+        // Pack the mc-by-kc block of op(A) starting at (ic,pc) into panels
+        // of MR rows. Each panel stores MR elements for each k. The rows
+        // beyond mc are zero.
+        static void PackA(Operands const& op, std::size_t ic, std::size_t mc,
+            std::size_t pc, std::size_t kc, T* packed)
+        {
+            std::size_t constexpr MR = GEMMKernel<T>::MR;
+            for (std::size_t ir = 0; ir < mc; ir += MR)
+            {
+                std::size_t const mr = std::min(MR, mc - ir);
+                for (std::size_t k = 0; k < kc; ++k, packed += MR)
+                {
+                    std::size_t i = 0;
+                    for (; i < mr; ++i)
+                    {
+                        packed[i] = op.GetA(ic + ir + i, pc + k);
+                    }
+                    for (; i < MR; ++i)
+                    {
+                        packed[i] = C_<T>(0);
+                    }
+                }
+            }
+        }
+
+        // Pack the kc-by-nc block of op(B) starting at (pc,jc) into panels
+        // of NR columns. Each panel stores NR elements for each k. The
+        // columns beyond nc are zero.
+        static void PackB(Operands const& op, std::size_t pc, std::size_t kc,
+            std::size_t jc, std::size_t nc, T* packed)
+        {
+            std::size_t constexpr NR = GEMMKernel<T>::NR;
+            for (std::size_t jr = 0; jr < nc; jr += NR)
+            {
+                std::size_t const nr = std::min(NR, nc - jr);
+                for (std::size_t k = 0; k < kc; ++k, packed += NR)
+                {
+                    std::size_t j = 0;
+                    for (; j < nr; ++j)
+                    {
+                        packed[j] = op.GetB(pc + k, jc + jr + j);
+                    }
+                    for (; j < NR; ++j)
+                    {
+                        packed[j] = C_<T>(0);
+                    }
+                }
+            }
+        }
+
+    private:
+        friend class UnitTestGEMM;
+    };
+}
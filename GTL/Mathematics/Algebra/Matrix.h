@@ -3,10 +3,11 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.12
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
+#include <GTL/Mathematics/Algebra/GEMM.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <algorithm>
 #include <array>
@@ -1631,93 +1632,61 @@ namespace gtl
     }
 
     template <typename T>
-    Matrix<T> MultiplyAB(Matrix<T> const& M0, Matrix<T> const& M1)
+    Matrix<T> MultiplyAB(Matrix<T> const& M0, Matrix<T> const& M1,
+        std::size_t numThreads = 1, ThreadPool* pool = nullptr)
     {
         GTL_LENGTH_ASSERT(
             M0.GetNumCols() > 0 && M0.GetNumCols() == M1.GetNumRows(),
             "Mismatched sizes.");
 
         Matrix<T> result(M0.GetNumRows(), M1.GetNumCols());
-        std::size_t const numCommon = M0.GetNumCols();
-        for (std::size_t row = 0; row < result.GetNumRows(); ++row)
-        {
-            for (std::size_t col = 0; col < result.GetNumCols(); ++col)
-            {
-                for (std::size_t i = 0; i < numCommon; ++i)
-                {
-                    result(row, col) += M0(row, i) * M1(i, col);
-                }
-            }
-        }
+        GEMM<T>::Multiply(false, false, M0.GetNumRows(), M1.GetNumCols(), M0.GetNumCols(),
+            M0.data(), M1.data(), result.data(), numThreads, pool);
         return result;
     }
 
     // M0 * M1^T
     template <typename T>
-    Matrix<T> MultiplyABT(Matrix<T> const& M0, Matrix<T> const& M1)
+    Matrix<T> MultiplyABT(Matrix<T> const& M0, Matrix<T> const& M1,
+        std::size_t numThreads = 1, ThreadPool* pool = nullptr)
     {
         GTL_LENGTH_ASSERT(
             M0.GetNumCols() > 0 && M0.GetNumCols() == M1.GetNumCols(),
             "Mismatched sizes.");
 
         Matrix<T> result(M0.GetNumRows(), M1.GetNumRows());
-        std::size_t const numCommon = M0.GetNumCols();
-        for (std::size_t row = 0; row < result.GetNumRows(); ++row)
-        {
-            for (std::size_t col = 0; col < result.GetNumCols(); ++col)
-            {
-                for (std::size_t i = 0; i < numCommon; ++i)
-                {
-                    result(row, col) += M0(row, i) * M1(col, i);
-                }
-            }
-        }
+        GEMM<T>::Multiply(false, true, M0.GetNumRows(), M1.GetNumRows(), M0.GetNumCols(),
+            M0.data(), M1.data(), result.data(), numThreads, pool);
         return result;
     }
 
     // M0^T * M1
     template <typename T>
-    Matrix<T> MultiplyATB(Matrix<T> const& M0, Matrix<T> const& M1)
+    Matrix<T> MultiplyATB(Matrix<T> const& M0, Matrix<T> const& M1,
+        std::size_t numThreads = 1, ThreadPool* pool = nullptr)
     {
         GTL_LENGTH_ASSERT(
             M0.GetNumRows() > 0 && M0.GetNumRows() == M1.GetNumRows(),
             "Mismatched sizes.");
 
         Matrix<T> result(M0.GetNumCols(), M1.GetNumCols());
-        std::size_t const numCommon = M0.GetNumRows();
-        for (std::size_t row = 0; row < result.GetNumRows(); ++row)
-        {
-            for (std::size_t col = 0; col < result.GetNumCols(); ++col)
-            {
-                for (std::size_t i = 0; i < numCommon; ++i)
-                {
-                    result(row, col) += M0(i, row) * M1(i, col);
-                }
-            }
-        }
+        GEMM<T>::Multiply(true, false, M0.GetNumCols(), M1.GetNumCols(), M0.GetNumRows(),
+            M0.data(), M1.data(), result.data(), numThreads, pool);
         return result;
     }
 
     // M0^T * M1^T
     template <typename T>
-    Matrix<T> MultiplyATBT(Matrix<T> const& M0, Matrix<T> const& M1)
+    Matrix<T> MultiplyATBT(Matrix<T> const& M0, Matrix<T> const& M1,
+        std::size_t numThreads = 1, ThreadPool* pool = nullptr)
     {
         GTL_LENGTH_ASSERT(
             M0.GetNumRows() > 0 && M0.GetNumRows() == M1.GetNumCols(),
             "Mismatched sizes.");
 
         Matrix<T> result(M0.GetNumCols(), M1.GetNumRows());
-        std::size_t const numCommon = M0.GetNumRows();
-        for (std::size_t row = 0; row < result.GetNumRows(); ++row)
-        {
-            for (std::size_t col = 0; col < result.GetNumCols(); ++col)
-            {
-                for (std::size_t i = 0; i < numCommon; ++i)
-                {
-                    result(row, col) += M0(i, row) * M1(col, i);
-                }
-            }
-        }
+        GEMM<T>::Multiply(true, true, M0.GetNumCols(), M1.GetNumRows(), M0.GetNumRows(),
+            M0.data(), M1.data(), result.data(), numThreads, pool);
         return result;
     }
 
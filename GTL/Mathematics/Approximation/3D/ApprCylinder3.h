@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.09.21
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -21,12 +21,12 @@
 #include <GTL/Mathematics/Approximation/2D/ApprCircle2.h>
 #include <GTL/Mathematics/MatrixAnalysis/SymmetricEigensolver.h>
 #include <GTL/Mathematics/Primitives/ND/Cylinder.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <limits>
-#include <thread>
 #include <vector>
 
 namespace gtl
@@ -42,10 +42,12 @@ namespace gtl
         // quite large and the number of points to be fitted is large, you
         // most likely will want to run multithreaded. Set numThreads to 0
         // to run single-threaded in the main process. Set numThreads > 0 to
-        // run multithreaded.
+        // run multithreaded. The samples are partitioned into numThreads
+        // subsets. If 'pool' is not null, the subsets are processed by the
+        // pool workers; otherwise, std::thread objects are launched.
         static void FitUsingHemisphereSearch(std::size_t numThreads, std::size_t numPoints,
             Vector3<T> const* points, std::size_t numThetaSamples, std::size_t numPhiSamples,
-            Cylinder3<T>& cylinder)
+            Cylinder3<T>& cylinder, ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numPoints >= 6 && points != nullptr,
@@ -76,7 +78,7 @@ namespace gtl
             else
             {
                 // Execute the algorithm in multiple threads.
-                ComputeMultiThreaded(numThreads, numPoints, numThetaSamples,
+                ComputeMultiThreaded(numThreads, pool, numPoints, numThetaSamples,
                     numPhiSamples, parameters, minW, minPC, minRSqr);
             }
 
@@ -177,7 +179,8 @@ namespace gtl
         template <typename IndexType>
         static void FitUsingHemisphereSearch(std::size_t numThreads, std::size_t numPoints,
             Vector3<T> const* points, std::size_t numTriangles, IndexType const* triangles,
-            std::size_t numThetaSamples, std::size_t numPhiSamples, Cylinder3<T>& cylinder)
+            std::size_t numThetaSamples, std::size_t numPhiSamples, Cylinder3<T>& cylinder,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numPoints >= 6 && points != nullptr,
@@ -225,7 +228,7 @@ namespace gtl
             else
             {
                 // Execute the algorithm in multiple threads.
-                ComputeMeshMultiThreaded(numThreads, localPoints, localTriangles,
+                ComputeMeshMultiThreaded(numThreads, pool, localPoints, localTriangles,
                     numThetaSamples, numPhiSamples, cylinder);
             }
 
@@ -360,7 +363,7 @@ namespace gtl
             }
         }
 
-        static void ComputeMultiThreaded(std::size_t numThreads, std::size_t numPoints,
+        static void ComputeMultiThreaded(std::size_t numThreads, ThreadPool* pool, std::size_t numPoints,
             std::size_t numThetaSamples, std::size_t numPhiSamples, Parameters const& parameters,
             Vector3<T>& minW, Vector3<T>& minPC, T& minRSqr)
         {
@@ -401,47 +404,39 @@ namespace gtl
             }
             local[numThreads - 1].jmax = numPhiSamples + 1;
 
-            std::vector<std::thread> process(numThreads);
-            for (std::size_t t = 0; t < numThreads; ++t)
-            {
-                process[t] = std::thread
-                (
-                    [t, numPoints, numThetaSamples, iMultiplier, jMultiplier,
-                        &parameters, &local]()
+            ForkJoin(pool, numThreads,
+                [numPoints, numThetaSamples, iMultiplier, jMultiplier,
+                    &parameters, &local](std::size_t t)
+                {
+                    for (std::size_t j = local[t].jmin; j < local[t].jmax; ++j)
                     {
-                        for (std::size_t j = local[t].jmin; j < local[t].jmax; ++j)
+                        // phi in [0,pi/2]
+                        T phi = jMultiplier * static_cast<T>(j);
+                        T csphi = std::cos(phi);
+                        T snphi = std::sin(phi);
+                        for (std::size_t i = 0; i < numThetaSamples; ++i)
                         {
-                            // phi in [0,pi/2]
-                            T phi = jMultiplier * static_cast<T>(j);
-                            T csphi = std::cos(phi);
-                            T snphi = std::sin(phi);
-                            for (std::size_t i = 0; i < numThetaSamples; ++i)
+                            // theta in [0,2*pi)
+                            T theta = iMultiplier * static_cast<T>(i);
+                            T cstheta = std::cos(theta);
+                            T sntheta = std::sin(theta);
+                            Vector3<T> W{ cstheta * snphi, sntheta * snphi, csphi };
+                            Vector3<T> PC{};
+                            T rsqr = C_<T>(0);
+                            T error = ApprCylinder3<T>::G(numPoints, parameters, W, PC, rsqr);
+                            if (error < local[t].error)
                             {
-                                // theta in [0,2*pi)
-                                T theta = iMultiplier * static_cast<T>(i);
-                                T cstheta = std::cos(theta);
-                                T sntheta = std::sin(theta);
-                                Vector3<T> W{ cstheta * snphi, sntheta * snphi, csphi };
-                                Vector3<T> PC{};
-                                T rsqr = C_<T>(0);
-                                T error = ApprCylinder3<T>::G(numPoints, parameters, W, PC, rsqr);
-                                if (error < local[t].error)
-                                {
-                                    local[t].error = error;
-                                    local[t].rsqr = rsqr;
-                                    local[t].W = W;
-                                    local[t].PC = PC;
-                                }
+                                local[t].error = error;
+                                local[t].rsqr = rsqr;
+                                local[t].W = W;
+                                local[t].PC = PC;
                             }
                         }
                     }
-                );
-            }
+                });
 
             for (std::size_t t = 0; t < numThreads; ++t)
             {
-                process[t].join();
-
                 if (local[t].error < minError)
                 {
                     minError = local[t].error;
@@ -554,7 +549,7 @@ namespace gtl
             CreateCylinder(minDirection, localPoints, cylinder);
         }
 
-        static void ComputeMeshMultiThreaded(std::size_t numThreads,
+        static void ComputeMeshMultiThreaded(std::size_t numThreads, ThreadPool* pool,
             std::vector<Vector3<T>> const& localPoints,
             std::vector<std::array<std::size_t, 3>> const& localTriangles,
             std::size_t numThetaSamples, std::size_t numPhiSamples, Cylinder3<T>& cylinder)
@@ -592,44 +587,36 @@ namespace gtl
             }
             local[numThreads - 1].jmax = numPhiSamples + 1;
 
-            std::vector<std::thread> process(numThreads);
-            for (std::size_t t = 0; t < numThreads; ++t)
-            {
-                process[t] = std::thread
-                (
-                    [t, iMultiplier, jMultiplier, numThetaSamples,
-                        &local, &localPoints, &localTriangles]()
+            ForkJoin(pool, numThreads,
+                [iMultiplier, jMultiplier, numThetaSamples,
+                    &local, &localPoints, &localTriangles](std::size_t t)
+                {
+                    for (std::size_t j = local[t].jmin; j < local[t].jmax; ++j)
                     {
-                        for (std::size_t j = local[t].jmin; j < local[t].jmax; ++j)
+                        // phi in [0,pi/2]
+                        T phi = jMultiplier * static_cast<T>(j);
+                        T csphi = std::cos(phi);
+                        T snphi = std::sin(phi);
+                        for (std::size_t i = 0; i < numThetaSamples; ++i)
                         {
-                            // phi in [0,pi/2]
-                            T phi = jMultiplier * static_cast<T>(j);
-                            T csphi = std::cos(phi);
-                            T snphi = std::sin(phi);
-                            for (std::size_t i = 0; i < numThetaSamples; ++i)
+                            // theta in [0,2*pi)
+                            T theta = iMultiplier * static_cast<T>(i);
+                            T cstheta = std::cos(theta);
+                            T sntheta = std::sin(theta);
+                            Vector3<T> direction{ cstheta * snphi, sntheta * snphi, csphi };
+                            T measure = GetProjectionMeasure(direction,
+                                localPoints, localTriangles);
+                            if (measure < local[t].measure)
                             {
-                                // theta in [0,2*pi)
-                                T theta = iMultiplier * static_cast<T>(i);
-                                T cstheta = std::cos(theta);
-                                T sntheta = std::sin(theta);
-                                Vector3<T> direction{ cstheta * snphi, sntheta * snphi, csphi };
-                                T measure = GetProjectionMeasure(direction,
-                                    localPoints, localTriangles);
-                                if (measure < local[t].measure)
-                                {
-                                    local[t].direction = direction;
-                                    local[t].measure = measure;
-                                }
+                                local[t].direction = direction;
+                                local[t].measure = measure;
                             }
                         }
                     }
-                );
-            }
+                });
 
             for (std::size_t t = 0; t < numThreads; ++t)
             {
-                process[t].join();
-
                 if (local[t].measure < minMeasure)
                 {
                     minMeasure = local[t].measure;
@@ -3,12 +3,13 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.12
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 #include <GTL/Mathematics/Arithmetic/UIntegerALU32.h>
 #include <GTL/Mathematics/Arithmetic/UIntegerAP32.h>
 #include <GTL/Mathematics/Arithmetic/UIntegerFP32.h>
+#include <GTL/Mathematics/Arithmetic/UIntegerHP32.h>
 #include <GTL/Mathematics/Arithmetic/BSNumber.h>
 #include <GTL/Mathematics/Arithmetic/BSRational.h>
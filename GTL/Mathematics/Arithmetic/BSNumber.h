@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.03.05
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -40,8 +40,11 @@
 //          // that stores contiguous bits in 32-bit blocks. If 'bits' is a
 //          // Container type, then it must support dereferencing by 'bits[i]'
 //          // to access the i-th block, where 'i' is of type std::size_t.
-//          // UIntegerAP32 has Container = std::vector<std::uint32_t> and
-//          // UIntegerFP32<N> has Container = std::array<std::uint32_t, N>.
+//          // UIntegerAP32 has Container = std::vector<std::uint32_t>,
+//          // UIntegerAP32Scratch has Container = std::vector<std::uint32_t,
+//          // ScratchAllocator<std::uint32_t>>,
+//          // UIntegerFP32<N> has Container = std::array<std::uint32_t, N>
+//          // and UIntegerHP32<K> has Container = UIntegerHP32<K>::Container.
 //          Container const& GetBits() const;
 //          Container& GetBits();
 //
@@ -51,7 +54,8 @@
 //          // blocks is modified by 'void SetNumBits(std::size_t)'. The maximum
 //          // number of blocks for UIntegerAP32 is effectively infinite, but
 //          // set to std::numeric_limits<std::size_t>::max(). The maximum number
-//          // of blocks for UIntegerFP32<N> is N.
+//          // of blocks for UIntegerFP32<N> is N. The maximum number of blocks
+//          // for UIntegerHP32<K> is the same as that for UIntegerAP32.
 //          std::size_t GetNumBlocks() const;
 //          std::size_t GetMaxNumBlocks() const;
 //
@@ -80,8 +84,9 @@
 //
 // The GTL currently has 32-bits-per-word storage for UInteger. See the
 // classes UIntegerAP32 (arbitrary precision), UIntegerFP32<N> (fixed
-// precision), and UIntegerALU32 (arithmetic logic unit shared by the
-// previous two classes).
+// precision), UIntegerHP32<K> (hybrid precision, K blocks stored inline and
+// the remaining blocks on the heap), and UIntegerALU32 (arithmetic logic
+// unit shared by the previous three classes).
 
 // The class can throw exceptions on various conditions. If you want
 // exceptions thrown for any of these conditions, add the preprocessor
@@ -0,0 +1,118 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// Support for the floating-point filters of the exact sign predicates
+// ExactToLine2, ExactToCircumcircle2, ExactToPlane3 and ExactToCircumsphere3.
+// Each predicate is evaluated in three stages.
+//
+//   1. The determinant is evaluated in double precision. A static error
+//      bound, errorCoefficient * permanent, is computed from the absolute
+//      values of the terms of the expression tree. If |det| > bound, the
+//      sign of the floating-point determinant is the exact sign.
+//   2. The determinant is evaluated using SWInterval<T>. If the interval
+//      does not contain 0, the sign is known.
+//   3. The determinant is evaluated using BSNumber<UIntegerFP32<N>>.
+//
+// The error coefficients are derived by forward error analysis in the
+// standard model fl(a op b) = (a op b)(1 + d) with |d| <= u, where u is the
+// unit roundoff 2^{-53}. A term of the expanded determinant accumulates one
+// factor (1 + d) for each rounding on its path through the expression tree.
+// The path length is k for the sum or difference of subexpressions whose
+// maximum path length is k-1 and is k0 + k1 + 1 for the product of
+// subexpressions with path lengths k0 and k1; the leaves are the rounded
+// differences of inputs, which have path length 1. For maximum path length
+// n, the error is bounded by gamma(n) * permanent, where gamma(n) =
+// n*u/(1-n*u). The coefficients (n+1)*u used by the predicates absorb the
+// second-order terms and the rounding errors when computing the permanent.
+//
+// The error analysis is valid only when no intermediate result underflows.
+// The nonzero differences of the inputs are required to have magnitude at
+// least minDifference = 1e-55. Every nonzero intermediate value of the
+// expression trees then has magnitude larger than the smallest normal
+// double. For float inputs, the differences are computed in double and
+// always satisfy the requirement. Overflow produces an infinite permanent
+// or a NaN determinant, in which case the filter does not decide the sign.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace gtl
+{
+    // The number of queries whose sign was determined by each stage of a
+    // filtered predicate.
+    struct PredicateStatistics
+    {
+        PredicateStatistics()
+            :
+            numFilter(0),
+            numInterval(0),
+            numRational(0)
+        {
+        }
+
+        inline std::size_t GetNumQueries() const
+        {
+            return numFilter + numInterval + numRational;
+        }
+
+        PredicateStatistics& operator+=(PredicateStatistics const& other)
+        {
+            numFilter += other.numFilter;
+            numInterval += other.numInterval;
+            numRational += other.numRational;
+            return *this;
+        }
+
+        std::size_t numFilter, numInterval, numRational;
+    };
+
+    class PredicateFilter
+    {
+    public:
+        // The unit roundoff u = 2^{-53} for double.
+        static double constexpr unitRoundoff = 1.1102230246251565e-16;
+
+        // The minimum magnitude of a nonzero difference of inputs that
+        // guarantees no underflow in the expression trees of degree at most
+        // 5 with at most 3 levels of cancellation.
+        static double constexpr minDifference = 1.0e-55;
+
+        // Compute u - v in double precision. The flag 'safe' is set to false
+        // when the difference is nonzero and smaller than minDifference.
+        template <typename T>
+        static inline double Sub(T const& u, T const& v, bool& safe)
+        {
+            double const diff = static_cast<double>(u) - static_cast<double>(v);
+            double const absDiff = std::fabs(diff);
+            if (absDiff > 0.0 && absDiff < minDifference)
+            {
+                safe = false;
+            }
+            return diff;
+        }
+
+        // Return +1 or -1 when |det| > errorCoefficient * permanent and 0
+        // otherwise. NaN and infinite inputs lead to 0.
+        static inline std::int32_t GetSign(double det, double errorCoefficient,
+            double permanent)
+        {
+            double const bound = errorCoefficient * permanent;
+            if (det > bound)
+            {
+                return +1;
+            }
+            if (-det > bound)
+            {
+                return -1;
+            }
+            return 0;
+        }
+    };
+}
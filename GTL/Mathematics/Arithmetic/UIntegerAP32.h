@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.12
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -27,6 +27,19 @@
 // by N. This requires an analysis of how many bits of precision you need for
 // the types of computation you perform. See class BSPrecision for code that
 // allows you to compute maximum N.
+//
+// If N cannot be bounded, for example when the inputs are user-supplied
+// polynomials, consider UIntegerHP32<K>. It stores the first K blocks inline
+// and uses the heap only for numbers that require more than K blocks.
+//
+// The class template BasicUIntegerAP32 has the allocator of the blocks as
+// its template parameter. UIntegerAP32 uses std::allocator. The blocks of
+// UIntegerAP32Scratch are allocated by ScratchAllocator; while a
+// ScratchArena::Scope object is alive on the calling thread, they come from
+// a thread-local bump arena instead of the global heap. This is useful for
+// exact predicates that compute only the sign of an expression. See
+// ScratchArena.h for the restrictions on the lifetimes of the numbers
+// created inside a scope.
 
 #if defined(GTL_COLLECT_UINTEGERAP32_STATISTICS)
 #include <GTL/Utility/AtomicMinMax.h>
@@ -38,28 +51,33 @@ namespace gtl
 
 #include <GTL/Mathematics/Arithmetic/UIntegerALU32.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ScratchArena.h>
 #include <algorithm>
 #include <cstdint>
 #include <istream>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <utility>
 #include <vector>
 
 namespace gtl
 {
-    class UIntegerAP32
+    template <typename Allocator>
+    class BasicUIntegerAP32
     {
     public:
+        using Container = std::vector<std::uint32_t, Allocator>;
+
         // Construction and destruction.
-        UIntegerAP32()
+        BasicUIntegerAP32()
             :
             mNumBits(0),
             mBits{}
         {
         }
 
-        UIntegerAP32(std::uint32_t number)
+        BasicUIntegerAP32(std::uint32_t number)
             :
             mNumBits(0),
             mBits{}
@@ -82,7 +100,7 @@ namespace gtl
 #endif
         }
 
-        UIntegerAP32(std::uint64_t number)
+        BasicUIntegerAP32(std::uint64_t number)
             :
             mNumBits(0),
             mBits{}
@@ -112,10 +130,10 @@ namespace gtl
 #endif
         }
 
-        ~UIntegerAP32() = default;
+        ~BasicUIntegerAP32() = default;
 
         // Copy semantics.
-        UIntegerAP32(UIntegerAP32 const& other)
+        BasicUIntegerAP32(BasicUIntegerAP32 const& other)
             :
             mNumBits(0),
             mBits{}
@@ -123,7 +141,7 @@ namespace gtl
             *this = other;
         }
 
-        UIntegerAP32& operator=(UIntegerAP32 const& other)
+        BasicUIntegerAP32& operator=(BasicUIntegerAP32 const& other)
         {
             mNumBits = other.mNumBits;
             mBits = other.mBits;
@@ -131,7 +149,7 @@ namespace gtl
         }
 
         // Move semantics.
-        UIntegerAP32(UIntegerAP32&& other) noexcept
+        BasicUIntegerAP32(BasicUIntegerAP32&& other) noexcept
             :
             mNumBits(0),
             mBits{}
@@ -139,7 +157,7 @@ namespace gtl
             *this = std::move(other);
         }
 
-        UIntegerAP32& operator=(UIntegerAP32&& other) noexcept
+        BasicUIntegerAP32& operator=(BasicUIntegerAP32&& other) noexcept
         {
             mNumBits = other.mNumBits;
             mBits = std::move(other.mBits);
@@ -173,12 +191,12 @@ namespace gtl
             return mNumBits;
         }
 
-        inline std::vector<std::uint32_t> const& GetBits() const
+        inline Container const& GetBits() const
         {
             return mBits;
         }
 
-        inline std::vector<std::uint32_t>& GetBits()
+        inline Container& GetBits()
         {
             return mBits;
         }
@@ -275,40 +293,49 @@ namespace gtl
 
     private:
         std::size_t mNumBits;
-        std::vector<std::uint32_t> mBits;
+        Container mBits;
 
     private:
         friend class UnitTestUIntegerAP32;
     };
 
+    using UIntegerAP32 = BasicUIntegerAP32<std::allocator<std::uint32_t>>;
+    using UIntegerAP32Scratch = BasicUIntegerAP32<ScratchAllocator<std::uint32_t>>;
+
     // Comparisons.
-    inline bool operator==(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator==(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::Equal(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::Equal(n0, n1);
     }
 
-    inline bool operator!=(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator!=(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::NotEqual(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::NotEqual(n0, n1);
     }
 
-    inline bool operator<(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator<(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::LessThan(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::LessThan(n0, n1);
     }
 
-    inline bool operator<=(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator<=(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::LessThanOrEqual(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::LessThanOrEqual(n0, n1);
     }
 
-    inline bool operator>(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator>(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::GreaterThan(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::GreaterThan(n0, n1);
     }
 
-    inline bool operator>=(UIntegerAP32 const& n0, UIntegerAP32 const& n1)
+    template <typename Allocator>
+    inline bool operator>=(BasicUIntegerAP32<Allocator> const& n0, BasicUIntegerAP32<Allocator> const& n1)
     {
-        return UIntegerALU32<UIntegerAP32>::GreaterThanOrEqual(n0, n1);
+        return UIntegerALU32<BasicUIntegerAP32<Allocator>>::GreaterThanOrEqual(n0, n1);
     }
 }
@@ -0,0 +1,535 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// Class UIntegerHP32<K> is designed to support hybrid-precision arithmetic
+// using BSNumber and BSRational. It is not a general-purpose class for
+// arithmetic of unsigned integers. The first K 32-bit blocks are stored
+// inline in the object, so numbers with at most 32*K bits never touch the
+// heap. Numbers that require more blocks spill to heap storage, so there is
+// no upper bound on the precision as there is for UIntegerFP32<N>.
+//
+// UIntegerHP32<K> is the choice when the precision is usually small but
+// cannot be bounded a priori, for example when the inputs are user-supplied
+// polynomials in RootsGeneralPolynomial or when constraints are inserted in
+// ConstrainedDelaunay2. For such computations, UIntegerAP32 pays for a heap
+// allocation and deallocation on every temporary, and UIntegerFP32<N>
+// requires N to be the worst-case precision, which leads to enormous objects
+// that are expensive to copy.
+//
+// Once an object has spilled to the heap, it keeps its heap storage when the
+// number of blocks decreases. This avoids repeated allocations when the
+// object is reused as the result of a sequence of arithmetic operations.
+//
+// As with UIntegerFP32<N>, the inline blocks are not initialized by the
+// constructors for performance.
+//
+// To collect statistics on how large the UIntegerHP32 storage becomes when
+// using it for the UInteger of BSNumber, add the preprocessor symbol
+// GTL_COLLECT_UINTEGERHP32_STATISTICS to the global defines passed to the
+// compiler.
+//
+// If you use this feature, you must define gsUIntegerHP32MaxBlocks and
+// gsUIntegerHP32NumSpills somewhere in your code. The first is the maximum
+// number of blocks encountered and the second is the number of times storage
+// was moved from the inline blocks to the heap. If the number of spills is
+// large, consider increasing K.
+
+#include <GTL/Mathematics/Arithmetic/UIntegerALU32.h>
+#include <GTL/Utility/Exceptions.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#if defined(GTL_COLLECT_UINTEGERHP32_STATISTICS)
+#include <GTL/Utility/AtomicMinMax.h>
+namespace gtl
+{
+    extern std::atomic<std::size_t> gsUIntegerHP32MaxBlocks;
+    extern std::atomic<std::size_t> gsUIntegerHP32NumSpills;
+}
+#endif
+
+namespace gtl
+{
+    template <std::size_t K>
+    class UIntegerHP32
+    {
+    public:
+        // The container of 32-bit blocks returned by GetBits(). The first K
+        // blocks are stored inline. When more than K blocks are required,
+        // the blocks are stored on the heap.
+        class Container
+        {
+        public:
+#if defined(GTL_USE_MSWINDOWS)
+            // Disable the warning:
+            //   warning C26495: Variable 'gtl::UIntegerHP32<K>::Container::mInline'
+            //   is uninitialized. Always initialize a member variable (type.6).
+            // See the comments in UIntegerFP32.h about performance problems
+            // when the inline blocks are initialized in the constructors.
+#pragma warning(disable : 26495)
+#endif
+            Container()
+                :
+                mSize(0),
+                mData(nullptr),
+                mHeap{}
+            {
+                mData = mInline.data();
+            }
+
+            Container(Container const& other)
+                :
+                mSize(0),
+                mData(nullptr),
+                mHeap{}
+            {
+                mData = mInline.data();
+                *this = other;
+            }
+
+            Container(Container&& other) noexcept
+                :
+                mSize(0),
+                mData(nullptr),
+                mHeap{}
+            {
+                mData = mInline.data();
+                *this = std::move(other);
+            }
+#if defined(GTL_USE_MSWINDOWS)
+#pragma warning(default : 26495)
+#endif
+
+            ~Container() = default;
+
+            // Only other.mSize blocks are copied for performance.
+            Container& operator=(Container const& other)
+            {
+                if (this != &other)
+                {
+                    Reserve(other.mSize, false);
+                    mSize = other.mSize;
+                    std::copy(other.mData, other.mData + other.mSize, mData);
+                }
+                return *this;
+            }
+
+            // The heap storage of 'other', if any, is stolen. The inline
+            // blocks must be copied.
+            Container& operator=(Container&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    if (other.IsOnHeap())
+                    {
+                        mHeap = std::move(other.mHeap);
+                        mData = mHeap.data();
+                        other.mHeap.clear();
+                        other.mData = other.mInline.data();
+                    }
+                    else
+                    {
+                        if (IsOnHeap() && mHeap.size() >= other.mSize)
+                        {
+                            // Keep the heap storage for reuse.
+                        }
+                        else
+                        {
+                            mData = mInline.data();
+                        }
+                        std::copy(other.mData, other.mData + other.mSize, mData);
+                    }
+                    mSize = other.mSize;
+                    other.mSize = 0;
+                }
+                return *this;
+            }
+
+            // Change the number of blocks. The first min(size(),numBlocks)
+            // blocks are preserved. New blocks are not initialized.
+            void Resize(std::size_t numBlocks)
+            {
+                Reserve(numBlocks, true);
+                mSize = numBlocks;
+            }
+
+            inline std::size_t size() const
+            {
+                return mSize;
+            }
+
+            inline bool empty() const
+            {
+                return mSize == 0;
+            }
+
+            inline std::uint32_t const* data() const
+            {
+                return mData;
+            }
+
+            inline std::uint32_t* data()
+            {
+                return mData;
+            }
+
+            inline std::uint32_t const* begin() const
+            {
+                return mData;
+            }
+
+            inline std::uint32_t const* end() const
+            {
+                return mData + mSize;
+            }
+
+            inline std::uint32_t* begin()
+            {
+                return mData;
+            }
+
+            inline std::uint32_t* end()
+            {
+                return mData + mSize;
+            }
+
+            inline std::uint32_t const& operator[](std::size_t i) const
+            {
+                return mData[i];
+            }
+
+            inline std::uint32_t& operator[](std::size_t i)
+            {
+                return mData[i];
+            }
+
+            inline std::uint32_t const& back() const
+            {
+                return mData[mSize - 1];
+            }
+
+            inline std::uint32_t& back()
+            {
+                return mData[mSize - 1];
+            }
+
+            // Query whether the blocks are stored on the heap.
+            inline bool IsOnHeap() const
+            {
+                return mData != mInline.data();
+            }
+
+        private:
+            // Ensure there is storage for numBlocks blocks. When 'preserve'
+            // is true, the current blocks are copied to new heap storage.
+            void Reserve(std::size_t numBlocks, bool preserve)
+            {
+                if (IsOnHeap())
+                {
+                    if (numBlocks > mHeap.size())
+                    {
+                        mHeap.resize(numBlocks);
+                        mData = mHeap.data();
+                    }
+                }
+                else if (numBlocks > K)
+                {
+                    mHeap.resize(numBlocks);
+                    if (preserve)
+                    {
+                        std::copy(mInline.data(), mInline.data() + mSize, mHeap.data());
+                    }
+                    mData = mHeap.data();
+
+#if defined(GTL_COLLECT_UINTEGERHP32_STATISTICS)
+                    ++gsUIntegerHP32NumSpills;
+#endif
+                }
+            }
+
+            // The inline blocks are declared first so that they exist before
+            // mData is initialized to point to them.
+            std::array<std::uint32_t, K> mInline;
+            std::size_t mSize;
+            std::uint32_t* mData;
+            std::vector<std::uint32_t> mHeap;
+        };
+
+        // Construction and destruction.
+        UIntegerHP32()
+            :
+            mNumBits(0),
+            mBits{}
+        {
+            static_assert(
+                K >= 2,
+                "Invalid size K; at least 64 bits must be stored inline.");
+        }
+
+        UIntegerHP32(std::uint32_t number)
+            :
+            mNumBits(0),
+            mBits{}
+        {
+            static_assert(
+                K >= 2,
+                "Invalid size K; at least 64 bits must be stored inline.");
+
+            if (number > 0)
+            {
+                std::uint32_t const first = BitHacks::GetLeadingBit(number);
+                std::uint32_t const last = BitHacks::GetTrailingBit(number);
+                mNumBits = static_cast<std::size_t>(first - last) + 1;
+                mBits.Resize(1);
+                mBits[0] = (number >> last);
+            }
+            else
+            {
+                mNumBits = 0;
+            }
+
+#if defined(GTL_COLLECT_UINTEGERHP32_STATISTICS)
+            AtomicMax(gsUIntegerHP32MaxBlocks, mBits.size());
+#endif
+        }
+
+        UIntegerHP32(std::uint64_t number)
+            :
+            mNumBits(0),
+            mBits{}
+        {
+            static_assert(
+                K >= 2,
+                "Invalid size K; at least 64 bits must be stored inline.");
+
+            if (number > 0)
+            {
+                std::uint32_t const first = BitHacks::GetLeadingBit(number);
+                std::uint32_t const last = BitHacks::GetTrailingBit(number);
+                number >>= last;
+                std::size_t const numBitsM1 = static_cast<std::size_t>(first - last);
+                mNumBits = numBitsM1 + 1;
+                std::size_t const numBlocks = 1 + numBitsM1 / 32;
+                mBits.Resize(numBlocks);
+                mBits[0] = static_cast<std::uint32_t>(number & 0x00000000FFFFFFFFull);
+                if (numBlocks > 1)
+                {
+                    mBits[1] = static_cast<std::uint32_t>((number >> 32) & 0x00000000FFFFFFFFull);
+                }
+            }
+            else
+            {
+                mNumBits = 0;
+            }
+
+#if defined(GTL_COLLECT_UINTEGERHP32_STATISTICS)
+            AtomicMax(gsUIntegerHP32MaxBlocks, mBits.size());
+#endif
+        }
+
+        ~UIntegerHP32() = default;
+
+        // Copy semantics. Only other.GetNumBlocks() elements are copied for
+        // performance.
+        UIntegerHP32(UIntegerHP32 const& other)
+            :
+            mNumBits(0),
+            mBits{}
+        {
+            *this = other;
+        }
+
+        UIntegerHP32& operator=(UIntegerHP32 const& other)
+        {
+            mNumBits = other.mNumBits;
+            mBits = other.mBits;
+            return *this;
+        }
+
+        // Move semantics. The heap storage is stolen when the source has
+        // spilled; otherwise, the inline blocks are copied. The source
+        // object has its number of bits and number of blocks set to 0.
+        UIntegerHP32(UIntegerHP32&& other) noexcept
+            :
+            mNumBits(0),
+            mBits{}
+        {
+            *this = std::move(other);
+        }
+
+        UIntegerHP32& operator=(UIntegerHP32&& other) noexcept
+        {
+            mNumBits = other.mNumBits;
+            mBits = std::move(other.mBits);
+            other.mNumBits = 0;
+            return *this;
+        }
+
+        // Member access.
+        void SetNumBits(std::size_t numBits)
+        {
+            if (numBits > 0)
+            {
+                mNumBits = numBits;
+                std::size_t const numBitsM1 = numBits - 1;
+                std::size_t const numBlocks = 1 + numBitsM1 / 32;
+                mBits.Resize(numBlocks);
+            }
+            else
+            {
+                mNumBits = 0;
+                mBits.Resize(0);
+            }
+
+#if defined(GTL_COLLECT_UINTEGERHP32_STATISTICS)
+            AtomicMax(gsUIntegerHP32MaxBlocks, mBits.size());
+#endif
+        }
+
+        inline std::size_t GetNumBits() const
+        {
+            return mNumBits;
+        }
+
+        inline Container const& GetBits() const
+        {
+            return mBits;
+        }
+
+        inline Container& GetBits()
+        {
+            return mBits;
+        }
+
+        inline std::size_t GetNumBlocks() const
+        {
+            return mBits.size();
+        }
+
+        inline static std::size_t GetMaxNumBlocks()
+        {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        inline static std::size_t GetNumInlineBlocks()
+        {
+            return K;
+        }
+
+        inline void SetBack(std::uint32_t value)
+        {
+            GTL_RUNTIME_ASSERT(
+                mBits.size() > 0,
+                "Cannot call SetBack on an empty mBits array.");
+
+            mBits.back() = value;
+        }
+
+        inline std::uint32_t GetBack() const
+        {
+            GTL_RUNTIME_ASSERT(
+                mBits.size() > 0,
+                "Cannot call GetBack on an empty mBits array.");
+
+            return mBits.back();
+        }
+
+        inline void SetAllBitsToZero()
+        {
+            std::fill(mBits.begin(), mBits.end(), 0u);
+        }
+
+        // Disk input/output. The fstream objects should be created using
+        // std::ios::binary. The return value is 'true' iff the operation is
+        // successful. The format is the same as that of UIntegerFP32<N>.
+        bool Write(std::ostream& output) const
+        {
+            if (output.write((char const*)&mNumBits, sizeof(mNumBits)).bad())
+            {
+                return false;
+            }
+
+            std::size_t const numBlocks = mBits.size();
+            if (output.write((char const*)&numBlocks, sizeof(numBlocks)).bad())
+            {
+                return false;
+            }
+
+            return output.write((char const*)mBits.data(), numBlocks * sizeof(std::uint32_t)).good();
+        }
+
+        bool Read(std::istream& input)
+        {
+            if (input.read((char*)&mNumBits, sizeof(mNumBits)).bad())
+            {
+                return false;
+            }
+
+            std::size_t numBlocks = 0;
+            if (input.read((char*)&numBlocks, sizeof(numBlocks)).bad())
+            {
+                return false;
+            }
+
+            mBits.Resize(numBlocks);
+            return input.read((char*)mBits.data(), numBlocks * sizeof(std::uint32_t)).good();
+        }
+
+    private:
+        std::size_t mNumBits;
+        Container mBits;
+
+    private:
+        friend class UnitTestUIntegerHP32;
+    };
+
+    // Comparisons.
+    template <std::size_t K>
+    inline bool operator==(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::Equal(n0, n1);
+    }
+
+    template <std::size_t K>
+    inline bool operator!=(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::NotEqual(n0, n1);
+    }
+
+    template <std::size_t K>
+    inline bool operator<(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::LessThan(n0, n1);
+    }
+
+    template <std::size_t K>
+    inline bool operator<=(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::LessThanOrEqual(n0, n1);
+    }
+
+    template <std::size_t K>
+    inline bool operator>(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::GreaterThan(n0, n1);
+    }
+
+    template <std::size_t K>
+    inline bool operator>=(UIntegerHP32<K> const& n0, UIntegerHP32<K> const& n1)
+    {
+        return UIntegerALU32<UIntegerHP32<K>>::GreaterThanOrEqual(n0, n1);
+    }
+}
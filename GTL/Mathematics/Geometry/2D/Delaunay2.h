@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -76,13 +76,14 @@ namespace gtl
 
         virtual ~Delaunay2() = default;
 
-        // Compute an exact Delaunay triangulation using a blend of interval
-        // arithmetic and rational arithmetic. Call GetDimension() to know
-        // the dimension of the unique input points. If dimension is 0, the
-        // input consists of 1 single point. If dimension is 1, the input
-        // points lie on a line; the output of the triangulationn is a sorted
-        // list of points (the indices are sorted). If dimension is 2, the
-        // input points lie on a plane and are not colinear.
+        // Compute an exact Delaunay triangulation using a blend of
+        // floating-point filters, interval arithmetic and rational
+        // arithmetic. Call GetDimension() to know the dimension of the
+        // unique input points. If dimension is 0, the input consists of 1
+        // single point. If dimension is 1, the input points lie on a line;
+        // the output of the triangulationn is a sorted list of points (the
+        // indices are sorted). If dimension is 2, the input points lie on a
+        // plane and are not colinear.
         void operator()(std::size_t numPoints, Vector2<T> const* points)
         {
             GTL_ARGUMENT_ASSERT(
@@ -93,6 +94,8 @@ namespace gtl
             mNumPoints = numPoints;
             mPoints = points;
             mMesh.Reset(mNumPoints, mAdjacentGrowth, 0);
+            mETCQuery.ResetStatistics();
+            mETLQuery.ResetStatistics();
 
             // The triangulation has V-2 triangles, so the worst-case number
             // of edges is smaller than 3*(V-2).
@@ -201,6 +204,17 @@ namespace gtl
             return mMesh;
         }
 
+        // The number of to-line and to-circumcircle queries whose sign was
+        // determined by the floating-point filter, by interval arithmetic
+        // and by rational arithmetic. The statistics are reset by
+        // operator().
+        PredicateStatistics GetPredicateStatistics() const
+        {
+            PredicateStatistics statistics = mETLQuery.GetStatistics();
+            statistics += mETCQuery.GetStatistics();
+            return statistics;
+        }
+
     protected:
         // Supporting type for rational arithmetic used in the exact
         // predicate for the relationship between a point and a line.
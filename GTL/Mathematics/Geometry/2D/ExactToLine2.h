@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -41,11 +41,18 @@
 // inputs. The member functions with T-valued and Rational-valued arguments
 // are intended for applications where the Rational inputs are cached and
 // re-used to avoid re-converting floating-point numbers to rational numbers.
+//
+// The sign is determined by the first successful stage of a floating-point
+// filter, interval arithmetic and rational arithmetic. See PredicateFilter.h
+// for a description of the filter. GetStatistics() reports how many queries
+// were resolved by each stage.
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
+#include <GTL/Mathematics/Arithmetic/PredicateFilter.h>
 #include <GTL/Mathematics/Arithmetic/SWInterval.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -66,7 +73,8 @@ namespace gtl
             mISign(invalidSign),
             mRSign(invalidSign),
             mIDet{},
-            mNode(numNodes)
+            mNode(numNodes),
+            mStatistics{}
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -78,17 +86,28 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of
             // P, if possible.
             ComputeInterval(P, V0, V1);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
             // The exact relative location of P is not known. Compute the
             // relative location using rational arithmetic.
             ComputeRational(P, V0, V1);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
@@ -98,11 +117,21 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of
             // P, if possible.
             ComputeInterval(P, V0, V1);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
@@ -113,9 +142,47 @@ namespace gtl
             auto const& rV0 = *rPoints[1];
             auto const& rV1 = *rPoints[2];
             ComputeRational(rP, rV0, rV1);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
+        // Evaluate the determinant in double precision and compare it to a
+        // static error bound. The return value is +1 or -1 when the sign of
+        // the determinant is certain and 0 when it is not. See
+        // PredicateFilter.h for the error analysis.
+        static std::int32_t Filter(Vector2<T> const& P, Vector2<T> const& V0, Vector2<T> const& V1)
+        {
+            bool safe = true;
+            double const x0 = PredicateFilter::Sub(P[0], V0[0], safe);
+            double const y0 = PredicateFilter::Sub(P[1], V0[1], safe);
+            double const x1 = PredicateFilter::Sub(V1[0], V0[0], safe);
+            double const y1 = PredicateFilter::Sub(V1[1], V0[1], safe);
+            if (!safe)
+            {
+                return 0;
+            }
+
+            double const x0y1 = x0 * y1;
+            double const x1y0 = x1 * y0;
+            double const det = x0y1 - x1y0;
+            double const permanent = std::fabs(x0y1) + std::fabs(x1y0);
+
+            // The maximum path length of the expression tree is 4.
+            return PredicateFilter::GetSign(det, 5.0 * PredicateFilter::unitRoundoff, permanent);
+        }
+
+        // The number of queries whose sign was determined by the floating-
+        // point filter, by interval arithmetic and by rational arithmetic.
+        inline PredicateStatistics const& GetStatistics() const
+        {
+            return mStatistics;
+        }
+
+        inline void ResetStatistics()
+        {
+            mStatistics = PredicateStatistics{};
+        }
+
     private:
         void ComputeInterval(Vector2<T> const& P, Vector2<T> const& V0,
             Vector2<T> const& V1)
@@ -204,6 +271,7 @@ namespace gtl
         std::int32_t mRSign;
         SWInterval<T> mIDet;
         std::vector<CRational> mNode;
+        PredicateStatistics mStatistics;
 
     private:
         friend class UnitTestExactToLine2;
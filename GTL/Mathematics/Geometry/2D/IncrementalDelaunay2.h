@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -29,8 +29,9 @@
 // are handled by jittering. Although one hopes that jittering prevents
 // degeneracies--and perhaps probabilistically this is acceptable, the only
 // guarantee for a correct result is to use exact arithmetic on the input
-// points. The implementation here uses a blend of interval and rational
-// arithmetic for exactness; the input points are not jittered.
+// points. The implementation here uses a blend of floating-point filters,
+// interval arithmetic and rational arithmetic for exactness; the input
+// points are not jittered.
 //
 // The details of the algorithms and implementation are provided in
 // https://www.geometrictools.com/Documentation/IncrementalDelaunayTriangulation.pdf
@@ -44,6 +45,7 @@
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <GTL/Mathematics/Geometry/2D/ExactToCircumcircle2.h>
 #include <GTL/Mathematics/Geometry/2D/ExactToLine2.h>
+#include <GTL/Mathematics/Geometry/ND/SpatialSort.h>
 #include <GTL/Mathematics/Meshes/DynamicVETManifoldMesh.h>
 #include <GTL/Utility/MinHeap.h>
 #include <algorithm>
@@ -80,6 +82,7 @@ namespace gtl
             mETCQuery{},
             mToLineWrapper{},
             mGraph{},
+            mLastTriangle{ invalid, invalid, invalid },
             mIndex{ { { 0, 1 }, { 1, 2 }, { 2, 0 } } },
             mTriangles{},
             mAdjacencies{},
@@ -165,6 +168,57 @@ namespace gtl
             return posIndex;
         }
 
+        // Insert a batch of points into the triangulation. On return,
+        // vertexIndices[i] is the vertex-map index of positions[i], so
+        // duplicates of each other or of existing vertices share an index.
+        // All positions are validated before any is inserted; an exception
+        // is thrown if one is outside the domain specified in the
+        // constructor. Each point is located by walking from the most
+        // recently created triangle. When useSpatialOrder is true, the
+        // points are inserted in a biased randomized insertion order with
+        // Hilbert curve sorting of the rounds (see SpatialSort.h), which
+        // keeps the walks short for inputs in scanline or random order. The
+        // triangulation is the same for either order unless the input has 4
+        // or more cocircular points.
+        void Insert(std::size_t numPositions, Vector2<T> const* positions,
+            std::vector<std::size_t>& vertexIndices, bool useSpatialOrder = false)
+        {
+            GTL_ARGUMENT_ASSERT(
+                numPositions == 0 || positions != nullptr,
+                "Invalid argument.");
+
+            for (std::size_t i = 0; i < numPositions; ++i)
+            {
+                Vector2<T> const& position = positions[i];
+                GTL_ARGUMENT_ASSERT(
+                    mXMin <= position[0] && position[0] <= mXMax &&
+                    mYMin <= position[1] && position[1] <= mYMax,
+                    "The position is outside the domain specified in the constructor.");
+            }
+
+            std::vector<std::size_t> order(numPositions);
+            for (std::size_t i = 0; i < numPositions; ++i)
+            {
+                order[i] = i;
+            }
+            if (useSpatialOrder)
+            {
+                SpatialSort<T, 2>::BRIO(positions, order);
+            }
+
+            vertexIndices.resize(numPositions);
+            for (auto i : order)
+            {
+                vertexIndices[i] = Insert(positions[i]);
+            }
+        }
+
+        void Insert(std::vector<Vector2<T>> const& positions,
+            std::vector<std::size_t>& vertexIndices, bool useSpatialOrder = false)
+        {
+            Insert(positions.size(), positions.data(), vertexIndices, useSpatialOrder);
+        }
+
         // Remove a point from the triangulation. The return value is the index
         // associated with the vertex in the vertex map when that vertex exists.
         // If the vertex does not exist, the return value is
@@ -173,6 +227,10 @@ namespace gtl
         {
             mTrianglesAndAdjacenciesNeedUpdate = true;
 
+            // The retriangulation of the removal polygon destroys triangles,
+            // so the next point location starts from an arbitrary triangle.
+            mLastTriangle = { invalid, invalid, invalid };
+
             auto iter = mVertexIndexMap.find(position);
             if (iter == mVertexIndexMap.end())
             {
@@ -276,6 +334,16 @@ namespace gtl
             return mVertices;
         }
 
+        // The number of to-line and to-circumcircle queries whose sign was
+        // determined by the floating-point filter, by interval arithmetic
+        // and by rational arithmetic.
+        PredicateStatistics GetPredicateStatistics() const
+        {
+            PredicateStatistics statistics = mETLQuery.GetStatistics();
+            statistics += mETCQuery.GetStatistics();
+            return statistics;
+        }
+
         std::size_t GetNumTriangles() const
         {
             if (mTrianglesAndAdjacenciesNeedUpdate)
@@ -541,6 +609,14 @@ namespace gtl
         using TrianglePtrSet = std::set<Triangle*>;
         DynamicVETManifoldMesh mGraph;
 
+        // The vertices of the most recently created triangle, which is where
+        // the search for the triangle containing the next inserted point
+        // starts. Points that are inserted in a spatially coherent order are
+        // close to it. The triangle is looked up in mGraph by its vertices
+        // rather than stored as a pointer, so a copy of the object does not
+        // refer to the triangles of the original.
+        std::array<std::size_t, 3> mLastTriangle;
+
         // Indexing for the vertices of the triangle adjacent to a vertex.
         // The edge adjacent to vertex j is <mIndex[j][0], mIndex[j][1]> and
         // is listed so that the triangle interior is to your left as you walk
@@ -708,7 +784,20 @@ namespace gtl
         void Update(std::size_t pIndex)
         {
             auto const& tmap = mGraph.GetTriangles();
-            Triangle* tri = tmap.begin()->second.get();
+            Triangle* tri = nullptr;
+            if (mLastTriangle[0] != invalid)
+            {
+                TriangleKey<true> const key(mLastTriangle[0], mLastTriangle[1], mLastTriangle[2]);
+                auto iter = tmap.find(key);
+                if (iter != tmap.end())
+                {
+                    tri = iter->second.get();
+                }
+            }
+            if (tri == nullptr)
+            {
+                tri = tmap.begin()->second.get();
+            }
             if (GetContainingTriangle(pIndex, tri))
             {
                 // The point is inside the convex hull. The insertion polygon
@@ -738,6 +827,7 @@ namespace gtl
                         GTL_RUNTIME_ASSERT(
                             inserted != nullptr,
                             "Unexpected insertion failure.");
+                        mLastTriangle = inserted->V;
                     }
                 }
             }
@@ -817,6 +907,7 @@ namespace gtl
                         GTL_RUNTIME_ASSERT(
                             inserted != nullptr,
                             "Unexpected insertion failure.");
+                        mLastTriangle = inserted->V;
                     }
                 }
                 for (auto const& key : visible)
@@ -825,6 +916,7 @@ namespace gtl
                     GTL_RUNTIME_ASSERT(
                         inserted != nullptr,
                         "Unexpected insertion failure.");
+                    mLastTriangle = inserted->V;
                 }
             }
         }
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.08.09
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -22,14 +22,32 @@
 // depth H) is 2^H.
 // 
 // The partitioning of primitives between left and right children of a node
-// is based on the projection of centroids of the primitives onto a line
-// determined by the bounding volume type. The median of projections is chosen
-// to partition the primitives into two subsets of equal size or absolute size
-// difference of 1. This leads to a balanced tree, which is helpful for
-// performance of tree traversals.
+// is selected by SplitMethod.
+//
+// MEDIAN: The partitioning is based on the projection of centroids of the
+// primitives onto a line determined by the bounding volume type. The median
+// of projections is chosen to partition the primitives into two subsets of
+// equal size or absolute size difference of 1. This leads to a balanced tree.
+//
+// SURFACE_AREA: The partitioning minimizes the surface area heuristic (SAH)
+// cost estimate of a split. The centroids are binned along each coordinate
+// axis and the primitives' axis-aligned bounding boxes are accumulated per
+// bin. The candidate splits are the bin boundaries. A node with a small
+// number of primitives becomes a leaf when the SAH cost of the leaf is no
+// larger than the cost of the best split, so a leaf can represent more than
+// one primitive. The tree is generally not balanced, but for primitives with
+// nonuniform sizes or distributions, a linear-component query visits fewer
+// nodes than for the median-split tree.
+//
+// The nodes are stored in depth-first order; the left child of an interior
+// node immediately follows it in the array. The node indices and the indices
+// into the partition array are 32-bit, so a node with an AlignedBoxBV<double>
+// bounding volume occupies 64 bytes, which is the size of a cache line on
+// most CPUs.
 
 #include <GTL/Mathematics/Arithmetic/BitHacks.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Mathematics/Primitives/ND/AlignedBox.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
@@ -77,22 +95,22 @@ namespace gtl
         class Node
         {
         public:
-            static std::size_t constexpr invalid = std::numeric_limits<std::size_t>::max();
+            static std::uint32_t constexpr invalid = std::numeric_limits<std::uint32_t>::max();
 
             Node()
                 :
                 boundingVolume{},
-                minIndex(std::numeric_limits<std::size_t>::max()),
-                maxIndex(std::numeric_limits<std::size_t>::max()),
-                leftChild(std::numeric_limits<std::size_t>::max()),
-                rightChild(std::numeric_limits<std::size_t>::max())
+                minIndex(std::numeric_limits<std::uint32_t>::max()),
+                maxIndex(std::numeric_limits<std::uint32_t>::max()),
+                leftChild(std::numeric_limits<std::uint32_t>::max()),
+                rightChild(std::numeric_limits<std::uint32_t>::max())
             {
 
             }
 
             BoundingVolume boundingVolume;
-            std::size_t minIndex, maxIndex;
-            std::size_t leftChild, rightChild;
+            std::uint32_t minIndex, maxIndex;
+            std::uint32_t leftChild, rightChild;
         };
 
         // Abstract base class. The derived classes must compute the centroids
@@ -108,7 +126,10 @@ namespace gtl
                 BoundingVolume::IntersectLine,
                 BoundingVolume::IntersectRay,
                 BoundingVolume::IntersectSegment
-            }
+            },
+            mMaxHeight(0),
+            mSplitMethod(SplitMethod::MEDIAN),
+            mPrimitiveBoxes(nullptr)
         {
         }
 
@@ -125,11 +146,24 @@ namespace gtl
         static std::uint32_t constexpr RAY_QUERY = 1;
         static std::uint32_t constexpr SEGMENT_QUERY = 2;
 
+        // The methods for partitioning the primitives of a node between its
+        // children. See the comments at the beginning of this file.
+        enum class SplitMethod
+        {
+            MEDIAN,
+            SURFACE_AREA
+        };
+
+        // The number of bins per axis and the maximum number of primitives
+        // of a leaf node for SplitMethod::SURFACE_AREA.
+        static std::size_t constexpr numSAHBins = 16;
+        static std::size_t constexpr maxSAHLeafSize = 4;
+
         virtual ~BVTree() = default;
 
         // The derived classes must compute the centroids of the primitives
         // and store them in the member mCentroids before calling the
-        // Create(...) function.
+        // Create(...) function. The tree is built using SplitMethod::MEDIAN.
         //
         // The input height specifies the desired height of the tree and must
         // be no larger than 31. If std::numeric_limits<std::size_t>::max(),
@@ -139,43 +173,43 @@ namespace gtl
             std::vector<Vector3<T>>&& centroids,
             std::size_t height)
         {
-            GTL_RUNTIME_ASSERT(
-                centroids.size() > 0,
-                "Expecting centroids to create a bounding volume tree.");
-
-            mCentroids = std::move(centroids);
-
+            std::size_t maxHeight{};
             if (height == std::numeric_limits<std::size_t>::max())
             {
+                GTL_RUNTIME_ASSERT(
+                    centroids.size() > 0,
+                    "Expecting centroids to create a bounding volume tree.");
+
                 std::array<std::uint32_t, 2> minPowerOfTwo = BitHacks::RoundUpToPowerOfTwo(
-                    static_cast<std::uint32_t>(mCentroids.size()));
+                    static_cast<std::uint32_t>(centroids.size()));
                 std::uint32_t logMinPowerOfTwo = BitHacks::Log2OfPowerOfTwo(minPowerOfTwo[0]);
-                mHeight = static_cast<std::size_t>(logMinPowerOfTwo);
+                maxHeight = static_cast<std::size_t>(logMinPowerOfTwo);
             }
             else
             {
-                mHeight = std::min(height, static_cast<std::size_t>(31));
+                maxHeight = std::min(height, static_cast<std::size_t>(31));
             }
 
-            // The tree is built recursively. Preallocate the nodes because
-            // the BuildTree function declares references on the stack. We
-            // must guarantee that no reallocations occur in order to avoid
-            // invalidating those references.
-            std::size_t const numNodes = (static_cast<std::size_t>(1) << (mHeight + 1)) - 1;
-            mNodes.resize(numNodes);
+            CreateTree(std::move(centroids), maxHeight, SplitMethod::MEDIAN, nullptr);
+        }
 
-            // The array mPartition stores indices into mCentroids so that at
-            // a node, the centroids represented by the node are the indices
-            // [mPartition[node.minIndex], mPartition[node.maxIndex]].
-            mPartition.resize(mCentroids.size());
-            std::iota(mPartition.begin(), mPartition.end(), 0);
+        // Build the tree using SplitMethod::SURFACE_AREA. The input
+        // primitiveBoxes[i] is the axis-aligned bounding box of the primitive
+        // whose centroid is centroids[i]. The input height specifies the
+        // maximum height of the tree. If std::numeric_limits<std::size_t>::max(),
+        // the height is not limited; otherwise, the nodes at depth height are
+        // leaves regardless of their number of primitives.
+        void Create(
+            std::vector<Vector3<T>>&& centroids,
+            std::vector<AlignedBox3<T>> const& primitiveBoxes,
+            std::size_t height)
+        {
+            GTL_ARGUMENT_ASSERT(
+                primitiveBoxes.size() == centroids.size(),
+                "Expecting one box per centroid.");
 
-            // Build the tree recursively.
-            std::size_t const depth = 0;
-            std::size_t const nodeIndex = 0;
-            std::size_t const i0 = 0;
-            std::size_t const i1 = mCentroids.size() - 1;
-            BuildTree(depth, nodeIndex, i0, i1);
+            CreateTree(std::move(centroids), height, SplitMethod::SURFACE_AREA,
+                &primitiveBoxes);
         }
 
         // Member access.
@@ -184,6 +218,8 @@ namespace gtl
             return mCentroids;
         }
 
+        // The actual height of the tree, which can be smaller than the
+        // height passed to Create(...).
         inline std::size_t GetHeight() const
         {
             return mHeight;
@@ -226,18 +262,22 @@ namespace gtl
             nodeIndices.clear();
 
             auto linearBoundaryVolumeQuery = this->mLinearBoundingVolumeQuery[queryType];
-            std::vector<std::size_t> indexStack(2 * this->mHeight + 1);
+            std::vector<std::uint32_t> indexStack(this->mHeight + 1);
             std::size_t top = 0;
             indexStack[0] = 0;
             while (top != std::numeric_limits<std::size_t>::max())
             {
-                std::size_t nodeIndex = indexStack[top--];
+                std::uint32_t nodeIndex = indexStack[top--];
                 auto const& node = mNodes[nodeIndex];
 
-                // For the balanced tree created by BVTree<T>, an interior
-                // node has two valid children and a leaf node has two invalid
-                // children. This is true even if the height passed to
-                // BVTree<T>::Create is smaller than the actual height.
+                // For the trees created by BVTree<T>, an interior node has
+                // two valid children and a leaf node has two invalid
+                // children. A leaf node represents more than one primitive
+                // when the height passed to BVTree<T>::Create is smaller
+                // than the actual height or when the SAH leaf cost is the
+                // smaller cost. The stack holds at most one pending right
+                // child per level plus the current node, so mHeight + 1
+                // elements suffice.
                 if (node.leftChild != Node::invalid &&
                     node.rightChild != Node::invalid)
                 {
@@ -272,50 +312,110 @@ namespace gtl
 
     private:
         // Support for tree creation.
-        void BuildTree(
+        void CreateTree(
+            std::vector<Vector3<T>>&& centroids,
+            std::size_t maxHeight,
+            SplitMethod splitMethod,
+            std::vector<AlignedBox3<T>> const* primitiveBoxes)
+        {
+            GTL_RUNTIME_ASSERT(
+                centroids.size() > 0,
+                "Expecting centroids to create a bounding volume tree.");
+
+            // A tree has at most 2*n-1 nodes for n primitives. The node
+            // indices must be representable by 32-bit unsigned integers
+            // other than Node::invalid.
+            GTL_RUNTIME_ASSERT(
+                centroids.size() <= (static_cast<std::size_t>(1) << 31),
+                "Too many primitives for 32-bit node indices.");
+
+            mCentroids = std::move(centroids);
+            mHeight = 0;
+            mMaxHeight = maxHeight;
+            mSplitMethod = splitMethod;
+            mPrimitiveBoxes = primitiveBoxes;
+
+            // The nodes are appended in depth-first order. The number of
+            // nodes is not known in advance for a height-limited or SAH
+            // tree, so reserve the upper bound to avoid reallocations.
+            mNodes.clear();
+            mNodes.reserve(2 * mCentroids.size() - 1);
+
+            // The array mPartition stores indices into mCentroids so that at
+            // a node, the centroids represented by the node are the indices
+            // [mPartition[node.minIndex], mPartition[node.maxIndex]].
+            mPartition.resize(mCentroids.size());
+            std::iota(mPartition.begin(), mPartition.end(), 0);
+
+            // Build the tree recursively.
+            std::size_t const depth = 0;
+            std::size_t const i0 = 0;
+            std::size_t const i1 = mCentroids.size() - 1;
+            (void)BuildTree(depth, i0, i1);
+
+            mPrimitiveBoxes = nullptr;
+        }
+
+        std::uint32_t BuildTree(
             std::size_t depth,
-            std::size_t nodeIndex,
             std::size_t i0,
             std::size_t i1)
         {
-            auto& node = mNodes[nodeIndex];
-            node.minIndex = i0;
-            node.maxIndex = i1;
+            std::uint32_t const nodeIndex = static_cast<std::uint32_t>(mNodes.size());
+            mNodes.emplace_back();
+            mNodes[nodeIndex].minIndex = static_cast<std::uint32_t>(i0);
+            mNodes[nodeIndex].maxIndex = static_cast<std::uint32_t>(i1);
+            mHeight = std::max(mHeight, depth);
 
             if (i0 < i1)
             {
                 // The node is interior. Compute a bounding volume for the
                 // primitives' vertices.
-                ComputeInteriorBoundingVolume(i0, i1, node.boundingVolume);
-                if (depth == mHeight)
+                ComputeInteriorBoundingVolume(i0, i1, mNodes[nodeIndex].boundingVolume);
+                if (depth == mMaxHeight)
                 {
                     // The user-specified height has been reached. Do not
                     // continue the recursion past this node.
-                    return;
+                    return nodeIndex;
                 }
 
-                // The BoundingVolume type provides a function to access a
-                // splitting axis, typically one in a direction of largest
-                // distribution of primitive vertices. Use the splitting axis
-                // to partition the centroids of the primitives into two
-                // subsets, one for the left child and one for the right
-                // child. The subsets have numbers of elements that differ by
-                // at most 1, so the tree is balanced.
                 std::size_t j0{}, j1{};
-                SplitPoints(i0, i1, node.boundingVolume, j0, j1);
+                if (mSplitMethod == SplitMethod::MEDIAN)
+                {
+                    // The BoundingVolume type provides a function to access
+                    // a splitting axis, typically one in a direction of
+                    // largest distribution of primitive vertices. Use the
+                    // splitting axis to partition the centroids of the
+                    // primitives into two subsets, one for the left child
+                    // and one for the right child. The subsets have numbers
+                    // of elements that differ by at most 1, so the tree is
+                    // balanced.
+                    SplitPoints(i0, i1, mNodes[nodeIndex].boundingVolume, j0, j1);
+                }
+                else
+                {
+                    if (!SplitSurfaceArea(i0, i1, j0, j1))
+                    {
+                        // The SAH cost of a leaf is no larger than that of
+                        // the best split.
+                        return nodeIndex;
+                    }
+                }
 
-                // Recurse on the two children.
-                node.leftChild = 2 * nodeIndex + 1;
-                node.rightChild = node.leftChild + 1;
-                BuildTree(depth + 1, node.leftChild, i0, j0);
-                BuildTree(depth + 1, node.rightChild, j1, i1);
+                // Recurse on the two children. The left child is the next
+                // node in depth-first order.
+                std::uint32_t const leftChild = BuildTree(depth + 1, i0, j0);
+                std::uint32_t const rightChild = BuildTree(depth + 1, j1, i1);
+                mNodes[nodeIndex].leftChild = leftChild;
+                mNodes[nodeIndex].rightChild = rightChild;
             }
             else // i0 = i1
             {
                 // The node is a leaf. Compute a bounding volume for a single
                 // primitive's vertices.
-                ComputeLeafBoundingVolume(i0, node.boundingVolume);
+                ComputeLeafBoundingVolume(i0, mNodes[nodeIndex].boundingVolume);
             }
+            return nodeIndex;
         }
 
         class ProjectionInfo
@@ -390,6 +490,193 @@ namespace gtl
             }
         }
 
+        // Bin the primitives [mPartition[i0], mPartition[i1]] and select the
+        // bin boundary of minimum SAH cost. The function returns false when
+        // the node should be a leaf. Otherwise, the primitives are
+        // partitioned into [i0,j0] and [j1,i1] with j1 = j0 + 1.
+        bool SplitSurfaceArea(
+            std::size_t i0,
+            std::size_t i1,
+            std::size_t& j0,
+            std::size_t& j1)
+        {
+            auto const& boxes = *mPrimitiveBoxes;
+            std::size_t const numPrimitives = i1 - i0 + 1;
+
+            // Compute the bounding box of the centroids and the bounding box
+            // of the primitives.
+            AlignedBox3<T> centroidBox{}, nodeBox{};
+            centroidBox.min = mCentroids[mPartition[i0]];
+            centroidBox.max = centroidBox.min;
+            nodeBox = boxes[mPartition[i0]];
+            for (std::size_t i = i0 + 1; i <= i1; ++i)
+            {
+                std::size_t const p = mPartition[i];
+                Include(mCentroids[p], mCentroids[p], centroidBox);
+                Include(boxes[p].min, boxes[p].max, nodeBox);
+            }
+
+            // The SAH cost of a split into subsets L and R of the primitives
+            // of node N is cost = 1 + (area(L)*|L| + area(R)*|R|)/area(N),
+            // where the traversal cost and the primitive-intersection cost
+            // are both 1. The cost of a leaf is |N|.
+            T const nodeArea = HalfArea(nodeBox);
+            T bestCost = std::numeric_limits<T>::max();
+            std::size_t bestAxis = 0, bestBoundary = 0;
+            std::array<std::size_t, numSAHBins> binCount{};
+            std::array<AlignedBox3<T>, numSAHBins> binBox{};
+            std::array<T, numSAHBins> rightArea{};
+            std::array<std::size_t, numSAHBins> rightCount{};
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                T const extent = centroidBox.max[axis] - centroidBox.min[axis];
+                if (extent <= C_<T>(0))
+                {
+                    continue;
+                }
+
+                T const binScale = static_cast<T>(numSAHBins) / extent;
+                binCount.fill(0);
+                for (std::size_t i = i0; i <= i1; ++i)
+                {
+                    std::size_t const p = mPartition[i];
+                    std::size_t b = GetBin(mCentroids[p][axis], centroidBox.min[axis], binScale);
+                    if (binCount[b]++ == 0)
+                    {
+                        binBox[b] = boxes[p];
+                    }
+                    else
+                    {
+                        Include(boxes[p].min, boxes[p].max, binBox[b]);
+                    }
+                }
+
+                // Sweep from the right to compute the areas and counts of
+                // the right subsets. The split at boundary k puts the bins
+                // [0,k] in the left subset and the bins [k+1,numSAHBins-1]
+                // in the right subset.
+                AlignedBox3<T> accumulator{};
+                std::size_t count = 0;
+                for (std::size_t b = numSAHBins - 1; b > 0; --b)
+                {
+                    if (binCount[b] > 0)
+                    {
+                        if (count == 0)
+                        {
+                            accumulator = binBox[b];
+                        }
+                        else
+                        {
+                            Include(binBox[b].min, binBox[b].max, accumulator);
+                        }
+                        count += binCount[b];
+                    }
+                    rightArea[b - 1] = (count > 0 ? HalfArea(accumulator) : C_<T>(0));
+                    rightCount[b - 1] = count;
+                }
+
+                // Sweep from the left and evaluate the costs.
+                count = 0;
+                for (std::size_t b = 0; b + 1 < numSAHBins; ++b)
+                {
+                    if (binCount[b] > 0)
+                    {
+                        if (count == 0)
+                        {
+                            accumulator = binBox[b];
+                        }
+                        else
+                        {
+                            Include(binBox[b].min, binBox[b].max, accumulator);
+                        }
+                        count += binCount[b];
+                    }
+
+                    if (count > 0 && rightCount[b] > 0)
+                    {
+                        T cost = HalfArea(accumulator) * static_cast<T>(count) +
+                            rightArea[b] * static_cast<T>(rightCount[b]);
+                        if (cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestAxis = axis;
+                            bestBoundary = b;
+                        }
+                    }
+                }
+            }
+
+            if (bestCost == std::numeric_limits<T>::max())
+            {
+                // The centroids are all the same point. Split the primitives
+                // in half unless the node is small enough to be a leaf.
+                if (numPrimitives <= maxSAHLeafSize)
+                {
+                    return false;
+                }
+                j0 = i0 + (numPrimitives - 1) / 2;
+                j1 = j0 + 1;
+                return true;
+            }
+
+            if (numPrimitives <= maxSAHLeafSize)
+            {
+                T const splitCost = (nodeArea > C_<T>(0) ?
+                    C_<T>(1) + bestCost / nodeArea : C_<T>(1));
+                if (static_cast<T>(numPrimitives) <= splitCost)
+                {
+                    return false;
+                }
+            }
+
+            // Partition the primitives by the selected bin boundary.
+            T const binMin = centroidBox.min[bestAxis];
+            T const binScale = static_cast<T>(numSAHBins) /
+                (centroidBox.max[bestAxis] - binMin);
+            auto begin = mPartition.begin() + i0;
+            auto end = mPartition.begin() + i1 + 1;
+            auto middle = std::partition(begin, end,
+                [this, bestAxis, bestBoundary, binMin, binScale](std::size_t p)
+                {
+                    return GetBin(mCentroids[p][bestAxis], binMin, binScale) <= bestBoundary;
+                });
+
+            j0 = i0 + static_cast<std::size_t>(middle - begin) - 1;
+            j1 = j0 + 1;
+            return true;
+        }
+
+        static std::size_t GetBin(T const& value, T const& binMin, T const& binScale)
+        {
+            T const t = (value - binMin) * binScale;
+            std::size_t const b = (t > C_<T>(0) ? static_cast<std::size_t>(t) : 0);
+            return std::min(b, numSAHBins - 1);
+        }
+
+        static void Include(Vector3<T> const& vmin, Vector3<T> const& vmax,
+            AlignedBox3<T>& box)
+        {
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                box.min[k] = std::min(box.min[k], vmin[k]);
+                box.max[k] = std::max(box.max[k], vmax[k]);
+            }
+        }
+
+        // The surface area of the box divided by 2. The factor 2 cancels in
+        // the ratios of the SAH cost.
+        static T HalfArea(AlignedBox3<T> const& box)
+        {
+            Vector3<T> d = box.max - box.min;
+            return d[0] * d[1] + d[1] * d[2] + d[2] * d[0];
+        }
+
+        // Parameters of the tree construction, valid only during the call
+        // to CreateTree(...).
+        std::size_t mMaxHeight;
+        SplitMethod mSplitMethod;
+        std::vector<AlignedBox3<T>> const* mPrimitiveBoxes;
+
     private:
         friend class UnitTestBVTree;
     };
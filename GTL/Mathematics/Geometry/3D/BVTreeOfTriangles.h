@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.08.08
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -15,6 +15,7 @@
 #include <GTL/Mathematics/Intersection/3D/IntrLine3Triangle3.h>
 #include <GTL/Mathematics/Intersection/3D/IntrRay3Triangle3.h>
 #include <GTL/Mathematics/Intersection/3D/IntrSegment3Triangle3.h>
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -42,14 +43,21 @@ namespace gtl
         {
         }
 
-        // The input height specifies the desired height of the tree and must
-        // be no larger than 31. If std::numeric_limits<std::size_t>::max(), the
-        // the entire tree is built and the actual height is computed from
-        // vertices.size(). If larger than 31, the height is clamped to 31.
+        // For SplitMethod::MEDIAN, the input height specifies the desired
+        // height of the tree and must be no larger than 31. If
+        // std::numeric_limits<std::size_t>::max(), the entire tree is
+        // built and the actual height is computed from triangles.size(). If
+        // larger than 31, the height is clamped to 31.
+        //
+        // For SplitMethod::SURFACE_AREA, the input height is the maximum
+        // height of the tree. If std::numeric_limits<std::size_t>::max(),
+        // the height is not limited.
         void Create(
             std::vector<Vector3<T>> const& vertices,
             std::vector<std::array<std::size_t, 3>> const& triangles,
-            std::size_t height = std::numeric_limits<std::size_t>::max())
+            std::size_t height = std::numeric_limits<std::size_t>::max(),
+            typename BVTree<T, BoundingVolume>::SplitMethod splitMethod =
+                BVTree<T, BoundingVolume>::SplitMethod::MEDIAN)
         {
             GTL_ARGUMENT_ASSERT(
                 vertices.size() >= 3 && triangles.size() > 0,
@@ -67,8 +75,36 @@ namespace gtl
                 centroids[t] = (mVertices[tri[0]] + mVertices[tri[1]] + mVertices[tri[2]]) / three;
             }
 
-            // Create the bounding volume tree for centroids.
-            BVTree<T, BoundingVolume>::Create(std::move(centroids), height);
+            if (splitMethod == BVTree<T, BoundingVolume>::SplitMethod::MEDIAN)
+            {
+                // Create the bounding volume tree for centroids.
+                BVTree<T, BoundingVolume>::Create(std::move(centroids), height);
+            }
+            else
+            {
+                // Compute the triangle bounding boxes for the SAH.
+                std::vector<AlignedBox3<T>> boxes(mTriangles.size());
+                for (std::size_t t = 0; t < mTriangles.size(); ++t)
+                {
+                    auto const& tri = mTriangles[t];
+                    auto& box = boxes[t];
+                    box.min = mVertices[tri[0]];
+                    box.max = box.min;
+                    for (std::size_t j = 1; j < 3; ++j)
+                    {
+                        Vector3<T> const& vertex = mVertices[tri[j]];
+                        for (std::size_t k = 0; k < 3; ++k)
+                        {
+                            box.min[k] = std::min(box.min[k], vertex[k]);
+                            box.max[k] = std::max(box.max[k], vertex[k]);
+                        }
+                    }
+                }
+
+                // Create the bounding volume tree for centroids using the
+                // triangle bounding boxes.
+                BVTree<T, BoundingVolume>::Create(std::move(centroids), boxes, height);
+            }
         }
 
         // Member access.
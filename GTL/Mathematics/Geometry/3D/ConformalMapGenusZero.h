@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.17
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -19,6 +19,7 @@
 #include <GTL/Mathematics/Algebra/Polynomial.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <GTL/Mathematics/Meshes/DynamicETManifoldMesh.h>
+#include <GTL/Mathematics/MatrixAnalysis/CSRMatrix.h>
 #include <GTL/Mathematics/MatrixAnalysis/LinearSystem.h>
 #include <algorithm>
 #include <array>
@@ -142,6 +143,10 @@ namespace gtl
             T re2 = C_<T>(0);
             T im2 = -len10 * invLenNormal;
 
+            // Convert A to compressed sparse row format. The map stores only
+            // one of the entries (i,j) and (j,i).
+            CSRMatrix<T> csrA(numPositions, numPositions, A, true);
+
             // Solve the sparse system for the real parts.
             std::size_t constexpr maxIterations = 1024;
             T const tolerance = 1e-06f;
@@ -150,8 +155,9 @@ namespace gtl
             tmp[v1] = re1;
             tmp[v2] = re2;
             std::vector<T> result(numPositions);
-            std::size_t iterations = LinearSystem<T>::SolveSymmetricCG(numPositions, A,
-                tmp.data(), result.data(), maxIterations, tolerance);
+            std::size_t iterations = LinearSystem<T>::SolveSymmetricPCG(csrA, tmp.data(),
+                result.data(), LinearSystem<T>::Preconditioner::JACOBI, maxIterations,
+                tolerance);
             if (iterations >= maxIterations)
             {
                 converged = false;
@@ -166,8 +172,9 @@ namespace gtl
             tmp[v0] = -im0;
             tmp[v1] = -im1;
             tmp[v2] = -im2;
-            iterations = LinearSystem<T>::SolveSymmetricCG(numPositions, A,
-                tmp.data(), result.data(), maxIterations, tolerance);
+            iterations = LinearSystem<T>::SolveSymmetricPCG(csrA, tmp.data(),
+                result.data(), LinearSystem<T>::Preconditioner::JACOBI, maxIterations,
+                tolerance);
             if (iterations >= maxIterations)
             {
                 converged = false;
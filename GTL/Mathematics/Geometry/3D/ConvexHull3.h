@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -32,6 +32,7 @@
 #include <GTL/Mathematics/Geometry/3D/ExactToPlane3.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <GTL/Mathematics/Meshes/VETManifoldMeshKS.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -41,7 +42,6 @@
 #include <numeric>
 #include <queue>
 #include <set>
-#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -63,6 +63,7 @@ namespace gtl
         ConvexHull3(std::size_t adjacentGrowth = defaultAdjacentGrowth)
             :
             mNumThreads(0),
+            mPool(nullptr),
             mNumPoints(0),
             mPoints(nullptr),
             mEquivalentTo{},
@@ -72,29 +73,38 @@ namespace gtl
             mVertices{},
             mHull{},
             mMesh{},
-            mAdjacentGrowth(adjacentGrowth)
+            mAdjacentGrowth(adjacentGrowth),
+            mStatistics{}
         {
             static_assert(
                 std::is_floating_point<T>::value,
                 "The input type must be a floating-point type.");
         }
 
-        // Compute the exact convex hull using a blend of interval arithmetic
-        // and rational arithmetic. The code runs single-threaded when
-        // lgNumThreads = 0. It runs multithreaded when lgNumThreads > 0,
-        // where the number of threads is 2^{lgNumThreads} > 1.
-        void operator()(std::size_t numPoints, Vector3<T> const* points, std::size_t lgNumThreads)
+        // Compute the exact convex hull using a blend of floating-point
+        // filters, interval arithmetic and rational arithmetic. The code
+        // runs single-threaded when lgNumThreads = 0. It runs multithreaded
+        // when lgNumThreads > 0, where the number of threads is
+        // 2^{lgNumThreads} > 1. The points are partitioned into
+        // 2^{lgNumThreads} subsets regardless of where the threads come
+        // from. If 'pool' is not null, the subhulls are computed by the
+        // pool workers; otherwise, std::thread objects are launched for the
+        // subhulls. The output is the same in either case.
+        void operator()(std::size_t numPoints, Vector3<T> const* points, std::size_t lgNumThreads,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numPoints > 0 && points != nullptr,
                 "Invalid argument.");
 
             mNumThreads = (static_cast<std::size_t>(1) << lgNumThreads);
+            mPool = pool;
 
             // Provide access to the points for the member functions.
             mNumPoints = numPoints;
             mPoints = points;
-            mMesh.Reset(mNumPoints, mAdjacentGrowth, mNumThreads);
+            mMesh.Reset(mNumPoints, mAdjacentGrowth, mNumThreads, mPool);
+            mStatistics = PredicateStatistics{};
 
             // Allocate storage for any rational points that must be computed
             // in the exact sign predicates.
@@ -102,10 +112,13 @@ namespace gtl
             mConverted.resize(numPoints);
             std::fill(mConverted.begin(), mConverted.end(), 0);
 
-            // Sort all the points indirectly.
+            // Sort all the points indirectly. Equal points are ordered by
+            // index, so the representative of a set of equal points is the
+            // one with the smallest index.
             auto lessThanPoints = [this](std::size_t s0, std::size_t s1)
             {
-                return mPoints[s0] < mPoints[s1];
+                return mPoints[s0] < mPoints[s1] ||
+                    (mPoints[s0] == mPoints[s1] && s0 < s1);
             };
 
             auto equalPoints = [this](std::size_t s0, std::size_t s1)
@@ -150,12 +163,12 @@ namespace gtl
             {
                 // Execute in multiple threads.
                 std::size_t numThreads = mNumThreads;
-                std::vector<std::thread> process(numThreads);
 
                 // Partition the sorted points for the first pass.
                 std::vector<std::size_t> inNumSorted(numThreads);
                 std::vector<std::size_t*> inSorted(numThreads);
                 std::vector<std::vector<std::size_t>> outVertices(numThreads);
+                std::vector<PredicateStatistics> outStatistics(numThreads);
                 std::size_t load = sorted.size() / numThreads;
                 inNumSorted.back() = sorted.size();
                 inSorted.front() = sorted.data();
@@ -169,18 +182,15 @@ namespace gtl
                 while (numThreads > 1)
                 {
                     // Divide ...
-                    for (std::size_t i = 0; i < numThreads; ++i)
-                    {
-                        process[i] = std::thread(
-                            [this, i, &inNumSorted, &inSorted, &outVertices]()
-                            {
-                                std::size_t dimension = 0;
-                                VETManifoldMeshKS mesh(mNumPoints, mAdjacentGrowth,
-                                    mNumThreads);
-                                ComputeHull(inNumSorted[i], inSorted[i], dimension,
-                                    outVertices[i], mesh);
-                            });
-                    }
+                    ForkJoin(mPool, numThreads,
+                        [this, &inNumSorted, &inSorted, &outVertices, &outStatistics](std::size_t i)
+                        {
+                            std::size_t dimension = 0;
+                            VETManifoldMeshKS mesh(mNumPoints, mAdjacentGrowth,
+                                mNumThreads, mPool);
+                            ComputeHull(inNumSorted[i], inSorted[i], dimension,
+                                outVertices[i], mesh, outStatistics[i]);
+                        });
 
                     numThreads /= 2;
 
@@ -189,9 +199,6 @@ namespace gtl
                     inSorted[0] = sorted.data();
                     for (std::size_t i = 0, k = 0; i < numThreads; ++i)
                     {
-                        process[2 * i].join();
-                        process[2 * i + 1].join();
-
                         inNumSorted[i] = 0;
                         std::vector<std::size_t>::iterator begin = target;
                         for (std::size_t j = 0; j < 2; ++j, ++k)
@@ -206,12 +213,19 @@ namespace gtl
                     }
                 }
 
-                ComputeHull(inNumSorted[0], inSorted[0], mDimension, mVertices, mMesh);
+                ComputeHull(inNumSorted[0], inSorted[0], mDimension, mVertices, mMesh,
+                    mStatistics);
+
+                for (auto const& statistics : outStatistics)
+                {
+                    mStatistics += statistics;
+                }
             }
             else
             {
                 // Execute single=threaded, in the main thread only.
-                ComputeHull(sorted.size(), sorted.data(), mDimension, mVertices, mMesh);
+                ComputeHull(sorted.size(), sorted.data(), mDimension, mVertices, mMesh,
+                    mStatistics);
             }
 
             // Get the array of 3-tuples of indices that represent the hull
@@ -220,31 +234,35 @@ namespace gtl
             {
                 // For manifold mesh representing a convex polyhedron with V
                 // vertices, the number of triangles is 2(V-2) and the number
-                // of edges is 3(V-2).
+                // of edges is 3(V-2). Each triangle is stored by the three
+                // vertices that share it. It is copied from the vertex with
+                // the smallest index, so no set of visited triangles is
+                // needed and the first index of each triple is the smallest.
                 mHull.reserve(6 * (mNumPoints - 1));
                 mHull.clear();
-                VETTrianglesKS unique(mNumPoints, mAdjacentGrowth, mNumThreads);
                 auto const& vertexPool = mMesh.GetVertexPool();
                 for (std::size_t v = 0; v < vertexPool.size(); ++v)
                 {
                     auto const& vertex = vertexPool[v];
                     for (std::size_t e = 0; e < vertex.numAdjacent; ++e)
                     {
-                        TriangleKey<true> tri(v, vertex.adjacent[e][0], vertex.adjacent[e][1]);
-                        if (unique.Insert(tri))
+                        std::size_t const v1 = vertex.adjacent[e][0];
+                        std::size_t const v2 = vertex.adjacent[e][1];
+                        if (v < v1 && v < v2)
                         {
-                            mHull.push_back(tri[0]);
-                            mHull.push_back(tri[1]);
-                            mHull.push_back(tri[2]);
+                            mHull.push_back(v);
+                            mHull.push_back(v1);
+                            mHull.push_back(v2);
                         }
                     }
                 }
             }
         }
 
-        void operator()(std::vector<Vector3<T>> const& points, std::size_t lgNumThreads)
+        void operator()(std::vector<Vector3<T>> const& points, std::size_t lgNumThreads,
+            ThreadPool* pool = nullptr)
         {
-            operator()(points.size(), points.data(), lgNumThreads);
+            operator()(points.size(), points.data(), lgNumThreads, pool);
         }
 
         // Access to the inputs to operator().
@@ -259,8 +277,9 @@ namespace gtl
         }
 
         // The equivalence array mEquivalentTo[i] = j keeps track of duplicate
-        // points. The point[i] is equal to the point[j]. For a dataset with
-        // no duplicates, mEquivalentTo[i] = i for all i.
+        // points. The point[i] is equal to the point[j], where j is the
+        // smallest index of the points equal to point[i]. For a dataset
+        // with no duplicates, mEquivalentTo[i] = i for all i.
         inline std::vector<std::size_t> const& GetEquivalentTo() const
         {
             return mEquivalentTo;
@@ -328,6 +347,97 @@ namespace gtl
             return mHull;
         }
 
+        // Get the triangles adjacent to the hull triangles when the
+        // dimension is 3. Triangle t has vertices GetHull()[3*t+i] for
+        // 0 <= i < 3, and adjacencies[3*t+i] is the index of the triangle
+        // that shares the edge <GetHull()[3*t+i],GetHull()[3*t+(i+1)%3]>.
+        // The hull is a closed mesh, so every edge is shared by two
+        // triangles. The return value is 'true' iff the dimension is 3.
+        bool GetHullAdjacencies(std::vector<std::size_t>& adjacencies) const
+        {
+            adjacencies.clear();
+            if (mDimension != 3)
+            {
+                return false;
+            }
+
+            // The triangles are numbered in the order they were copied to
+            // mHull, which is the order of the adjacency lists of their
+            // smallest vertices. The triangles with smallest vertex v have
+            // indices starting at first[v].
+            auto const& vertexPool = mMesh.GetVertexPool();
+            std::vector<std::size_t> first(vertexPool.size() + 1, 0);
+            for (std::size_t v = 0; v < vertexPool.size(); ++v)
+            {
+                auto const& vertex = vertexPool[v];
+                std::size_t numTriangles = 0;
+                for (std::size_t e = 0; e < vertex.numAdjacent; ++e)
+                {
+                    if (v < vertex.adjacent[e][0] && v < vertex.adjacent[e][1])
+                    {
+                        ++numTriangles;
+                    }
+                }
+                first[v + 1] = first[v] + numTriangles;
+            }
+
+            // Get the index of the counterclockwise triangle <v0,v1,v2>
+            // whose smallest vertex is v0.
+            auto GetTriangle = [&vertexPool, &first](std::size_t v0, std::size_t v1, std::size_t v2)
+            {
+                auto const& vertex = vertexPool[v0];
+                std::size_t t = first[v0];
+                for (std::size_t e = 0; e < vertex.numAdjacent; ++e)
+                {
+                    std::size_t const a = vertex.adjacent[e][0];
+                    std::size_t const b = vertex.adjacent[e][1];
+                    if (v0 < a && v0 < b)
+                    {
+                        if (a == v1 && b == v2)
+                        {
+                            return t;
+                        }
+                        ++t;
+                    }
+                }
+                GTL_RUNTIME_ERROR(
+                    "The triangle is not in the mesh.");
+            };
+
+            // The triangle adjacent to <v0,v1> contains the directed edge
+            // <v1,v0>, so it is <v1,v0,w> for the adjacency <v0,w> of v1.
+            adjacencies.resize(mHull.size());
+            for (std::size_t i = 0; i < mHull.size(); ++i)
+            {
+                std::size_t const v0 = mHull[i];
+                std::size_t const v1 = mHull[i % 3 < 2 ? i + 1 : i - 2];
+                auto const& vertex = vertexPool[v1];
+                std::size_t e = 0;
+                while (e < vertex.numAdjacent && vertex.adjacent[e][0] != v0)
+                {
+                    ++e;
+                }
+                GTL_RUNTIME_ASSERT(
+                    e < vertex.numAdjacent,
+                    "The hull is not a closed mesh.");
+
+                std::size_t const w = vertex.adjacent[e][1];
+                if (v1 < v0 && v1 < w)
+                {
+                    adjacencies[i] = GetTriangle(v1, v0, w);
+                }
+                else if (v0 < w)
+                {
+                    adjacencies[i] = GetTriangle(v0, w, v1);
+                }
+                else
+                {
+                    adjacencies[i] = GetTriangle(w, v1, v0);
+                }
+            }
+            return true;
+        }
+
         // Get the hull mesh, which is valid only when the dimension is 3.
         // This allows access to the graph of vertices, edges and triangles
         // of the convex (polyhedron) hull.
@@ -336,9 +446,20 @@ namespace gtl
             return mMesh;
         }
 
+        // The number of to-plane queries whose sign was determined by the
+        // floating-point filter, by interval arithmetic and by rational
+        // arithmetic, summed over all threads. The statistics are reset by
+        // operator().
+        inline PredicateStatistics const& GetPredicateStatistics() const
+        {
+            return mStatistics;
+        }
+
     private:
+        // The to-plane statistics of the call are added to 'statistics'.
         void ComputeHull(std::size_t numSorted, std::size_t* sorted, std::size_t& dimension,
-            std::vector<std::size_t>& vertices, VETManifoldMeshKS& mesh)
+            std::vector<std::size_t>& vertices, VETManifoldMeshKS& mesh,
+            PredicateStatistics& statistics)
         {
             std::vector<std::size_t> hull{};
             hull.reserve(numSorted);
@@ -386,12 +507,14 @@ namespace gtl
             // or 3-dimensional.
             if (Hull2(hull, numSorted, sorted, toPlaneQuery, dimension, current))
             {
+                statistics += toPlaneQuery.GetStatistics();
                 vertices = hull;
                 return;
             }
 
             // The hull is 3-dimensional; continue inserting points.
             Hull3(hull, numSorted, sorted, toPlaneQuery, mesh, current);
+            statistics += toPlaneQuery.GetStatistics();
 
             // Get an array of indices for the unique vertices of the hull.
             mesh.GetVertices(vertices);
@@ -593,7 +716,7 @@ namespace gtl
             // to add elements to hull. At the time the full hull is known,
             // hull will be assigned the triangle indices.
             std::queue<TriangleKey<true>> visible;
-            VETTrianglesKS visited(mNumPoints, mAdjacentGrowth, mNumThreads);
+            VETTrianglesKS visited(mNumPoints, mAdjacentGrowth, mNumThreads, mPool);
             std::vector<std::array<std::size_t, 2>> terminator;
             for (++current; current < numSorted; ++current)
             {
@@ -734,6 +857,7 @@ namespace gtl
     private:
         // The input points to operator().
         std::size_t mNumThreads;
+        ThreadPool* mPool;
         std::size_t mNumPoints;
         Vector3<T> const* mPoints;
 
@@ -760,6 +884,9 @@ namespace gtl
         VETManifoldMeshKS mMesh;
         std::size_t mAdjacentGrowth;
 
+        // Statistics about the stages of the to-plane predicates.
+        PredicateStatistics mStatistics;
+
     private:
         friend class UnitTestConvexHull3;
     };
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -15,14 +15,25 @@
 // std::is_floating_point<T>::value = true.
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
+#include <GTL/Mathematics/Arithmetic/PredicateFilter.h>
 #include <GTL/Mathematics/Arithmetic/SWInterval.h>
+#include <GTL/Mathematics/Geometry/3D/ExactToCircumsphere3.h>
+#include <GTL/Mathematics/Geometry/3D/ExactToPlane3.h>
+#include <GTL/Mathematics/Geometry/ND/SpatialSort.h>
 #include <GTL/Mathematics/Meshes/DynamicTSManifoldMesh.h>
+#include <GTL/Mathematics/Meshes/EdgeKey.h>
 #include <GTL/Mathematics/Primitives/ND/Line.h>
 #include <GTL/Mathematics/Primitives/3D/Plane3.h>
-#include <map>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <numeric>
-#include <set>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace gtl
@@ -49,7 +60,18 @@ namespace gtl
             mAdjacencies{},
             mQueryPoint{},
             mIRQueryPoint{},
-            mCRPool(maxNumCRPool)
+            mCRPool(maxNumCRPool),
+            mStatistics{},
+            mHasCosphericalPoints(false),
+            mPartitionStatus(PartitionStatus::NOT_ATTEMPTED),
+            mTetrahedra{},
+            mFreeTetrahedra(invalid32),
+            mLastTetra(invalid32),
+            mCavity{},
+            mCavityFaces{},
+            mVisibleFaces{},
+            mHullFaces{},
+            mNewFaces{}
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -59,8 +81,9 @@ namespace gtl
         virtual ~Delaunay3() = default;
 
         // Compute an exact Delaunay tetrahedralization using a blend of
-        // interval arithmetic and rational arithmetic. Call GetDimension()
-        // to know the dimension of the unique input points. FOR NOW, the
+        // floating-point filters, interval arithmetic and rational
+        // arithmetic. Call GetDimension() to know the dimension of the
+        // unique input points. FOR NOW, the
         // only support is for tetrahedralizing points whose convex hull has
         // positive volume.
         // 
@@ -70,12 +93,57 @@ namespace gtl
         // now, only the point (0D) or a line (2D) or a plane (3D) are
         // returned, which allows you to project the 3D points to the
         // proper dimension in which to sort the points.
-        bool operator()(std::size_t numPoints, Vector3<T> const* points)
+        //
+        // The points are inserted in input order unless useSpatialOrder is
+        // true, in which case they are inserted in a biased randomized
+        // insertion order with Hilbert curve sorting of the rounds; see
+        // SpatialSort.h. Each point is located by walking from the most
+        // recently created tetrahedron, so the spatial order makes the walks
+        // short, which matters for large inputs whose order is that of a
+        // scanner. The tetrahedralization is the same for either order
+        // unless the input has 5 or more cospherical points, and the
+        // outputs use the indices of the input points in both cases.
+        //
+        // If numThreads > 1, the unique points are partitioned by median
+        // splits into numThreads cells of a k-d tree and the cells are
+        // tetrahedralized concurrently. A tetrahedron of a cell whose
+        // circumsphere is strictly inside the cell box is a Delaunay
+        // tetrahedron of all the points. The vertices of the other
+        // tetrahedra, which are near the cell boundaries, are
+        // tetrahedralized by a single thread, and the tetrahedra of that
+        // tetrahedralization that are outside the kept cell tetrahedra fill
+        // the remaining space. The merged mesh is verified using the exact
+        // predicates: it must be manifold, it must use all the unique
+        // points, its boundary must be convex and each face between a cell
+        // tetrahedron and a filling tetrahedron must be locally Delaunay.
+        // If the verification fails, which is possible only when the input
+        // has cospherical points, the points are inserted incrementally
+        // instead. The partitioned tetrahedralization is abandoned before
+        // the border points are tetrahedralized when a cell has cospherical
+        // points, for which the verification usually fails, or when at
+        // least half of the points are border points, for which the single
+        // thread that tetrahedralizes them costs as much as the incremental
+        // insertion. This is the case for points on or near a surface, such
+        // as a cylinder. The cost of the cells is then added to that of the
+        // incremental insertion. Call GetPartitionStatus() to know which
+        // path produced the output. The mode is faster only when the cells
+        // are tetrahedralized on separate cores; with a single core it is
+        // slower than the incremental insertion. The cells are the same
+        // whether 'pool' is null, in which case std::thread objects are
+        // launched, or not null, in which case the pool workers are used, so
+        // the output does not depend on where the threads come from.
+        bool operator()(std::size_t numPoints, Vector3<T> const* points,
+            bool useSpatialOrder = false, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numPoints > 0 && points != nullptr,
                 "Invalid argument.");
 
+            GTL_LENGTH_ASSERT(
+                numPoints < static_cast<std::size_t>(invalid32),
+                "The number of points exceeds the range of 32-bit indices.");
+
             mNumPoints = numPoints;
             mPoints = points;
             mIRVertices.clear();
@@ -90,6 +158,12 @@ namespace gtl
             mAdjacencies.clear();
             MakeZero(mQueryPoint);
             MakeZero(mIRQueryPoint);
+            mStatistics = PredicateStatistics{};
+            mHasCosphericalPoints = false;
+            mPartitionStatus = PartitionStatus::NOT_ATTEMPTED;
+            mTetrahedra.clear();
+            mFreeTetrahedra = invalid32;
+            mLastTetra = invalid32;
 
             // Compute the intrinsic dimension and return early if that
             // dimension is 0, 1 or 2.
@@ -132,49 +206,78 @@ namespace gtl
                 mIRVertices[i][2] = mPoints[i][2];
             }
 
-            // Assume initially the points are unique. If duplicates are
-            // found during the Delaunay update, mDuplicates[] will be
-            // modified accordingly.
+            // Eliminate duplicates in input order, so the representative of
+            // a set of equal points is its first occurrence.
             mDuplicates.resize(mNumPoints);
-            std::iota(mDuplicates.begin(), mDuplicates.end(), 0);
+            std::vector<std::size_t> unique{};
+            unique.reserve(mNumPoints);
+            ProcessedVertexSet processed{};
+            processed.reserve(mNumPoints);
+            for (std::size_t i = 0; i < mNumPoints; ++i)
+            {
+                auto result = processed.insert(ProcessedVertex(mPoints[i], i));
+                if (result.second)
+                {
+                    mDuplicates[i] = i;
+                    unique.push_back(i);
+                }
+                else
+                {
+                    mDuplicates[i] = result.first->location;
+                }
+            }
+            mNumUniqueVertices = unique.size();
+
+            // Tetrahedralize the cells concurrently when requested and when
+            // each cell has enough points to amortize the merge.
+            if (numThreads > 1 && unique.size() >= numThreads * minPartitionSize)
+            {
+                mPartitionStatus = TetrahedralizePartitioned(unique, numThreads, pool);
+                if (mPartitionStatus == PartitionStatus::MERGED)
+                {
+                    UpdateIndicesAdjacencies();
+                    return true;
+                }
+                mTetrahedra.clear();
+            }
 
             // Insert the nondegenerate tetrahedron constructed by the call to
             // IntrinsicsVector2{T}. This is necessary for the circumsphere
-            // visibility algorithm to work correctly.
+            // visibility algorithm to work correctly. The extreme points are
+            // replaced by their representatives, which are the same points.
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                info.extreme[i] = mDuplicates[info.extreme[i]];
+            }
             if (!info.extremeCCW)
             {
                 std::swap(info.extreme[2], info.extreme[3]);
             }
-            auto inserted = mGraph.Insert(info.extreme[0], info.extreme[1],
-                info.extreme[2], info.extreme[3]);
-            GTL_RUNTIME_ASSERT(
-                inserted != nullptr,
-                "The tetrahedron should not be degenerate.");
+            mLastTetra = CreateTetrahedron(
+                static_cast<std::uint32_t>(info.extreme[0]),
+                static_cast<std::uint32_t>(info.extreme[1]),
+                static_cast<std::uint32_t>(info.extreme[2]),
+                static_cast<std::uint32_t>(info.extreme[3]));
+
+            // Incrementally update the tetrahedralization with the remaining
+            // unique points.
+            unique.erase(std::remove_if(unique.begin(), unique.end(),
+                [&info](std::size_t i)
+                {
+                    return i == info.extreme[0] || i == info.extreme[1]
+                        || i == info.extreme[2] || i == info.extreme[3];
+                }),
+                unique.end());
 
-            // Incrementally update the tetrahedralization. The set of
-            // processed points is maintained to eliminate duplicates.
-            ProcessedVertexSet processed{};
-            for (std::size_t i = 0; i < 4; ++i)
+            if (useSpatialOrder)
             {
-                std::size_t j = info.extreme[i];
-                processed.insert(ProcessedVertex(mPoints[j], j));
-                mDuplicates[j] = j;
+                SpatialSort<T, 3>::BRIO(mPoints, unique);
             }
-            for (std::size_t i = 0; i < mNumPoints; ++i)
+
+            for (auto i : unique)
             {
-                ProcessedVertex v(mPoints[i], i);
-                auto iter = processed.find(v);
-                if (iter == processed.end())
-                {
-                    Update(i);
-                    processed.insert(v);
-                }
-                else
-                {
-                    mDuplicates[i] = iter->location;
-                }
+                Update(i);
             }
-            mNumUniqueVertices = processed.size();
 
             // Assign integer values to the tetrahedra for use by the caller
             // and copy the tetrahedra information to compact arrays mIndices
@@ -184,9 +287,12 @@ namespace gtl
             return true;
         }
 
-        bool operator()(std::vector<Vector3<T>> const& points)
+        bool operator()(std::vector<Vector3<T>> const& points,
+            bool useSpatialOrder = false, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
-            return operator()(points.size(), points.data());
+            return operator()(points.size(), points.data(), useSpatialOrder,
+                numThreads, pool);
         }
 
         // Dimensional information. If GetDimension() returns 1, the points
@@ -240,8 +346,23 @@ namespace gtl
             return mNumTetrahedra;
         }
 
-        inline DynamicTSManifoldMesh const& GetGraph() const
+        // The graph is created from GetIndices() by the first call after
+        // operator(), because the tetrahedralization is constructed in
+        // compact arrays; see the comments for mTetrahedra. The first call
+        // is not thread-safe.
+        DynamicTSManifoldMesh const& GetGraph() const
         {
+            if (mGraph.GetTetrahedra().size() == 0 && mNumTetrahedra > 0)
+            {
+                for (std::size_t i = 0; i < mIndices.size(); i += 4)
+                {
+                    auto inserted = mGraph.Insert(mIndices[i], mIndices[i + 1],
+                        mIndices[i + 2], mIndices[i + 3]);
+                    GTL_RUNTIME_ASSERT(
+                        inserted != nullptr,
+                        "Unexpected insertion failure.");
+                }
+            }
             return mGraph;
         }
 
@@ -255,6 +376,37 @@ namespace gtl
             return mAdjacencies;
         }
 
+        // The number of ToPlane and ToCircumsphere queries whose sign was
+        // determined by the floating-point filter, by interval arithmetic
+        // and by rational arithmetic. The statistics are reset by
+        // operator().
+        inline PredicateStatistics const& GetPredicateStatistics() const
+        {
+            return mStatistics;
+        }
+
+        // The path taken by the last call to operator() when numThreads > 1.
+        // NOT_ATTEMPTED means there were fewer than numThreads times
+        // minPartitionSize unique points or the dimension is smaller than
+        // 3. MERGED means the output is the merged tetrahedralization of the
+        // cells. ABANDONED and MERGE_FAILED mean the points were inserted
+        // incrementally after the cells were tetrahedralized; ABANDONED is
+        // reported before the border points are tetrahedralized and
+        // MERGE_FAILED after the merged mesh failed the verification. Read
+        // the comments for operator().
+        enum class PartitionStatus
+        {
+            NOT_ATTEMPTED,
+            MERGED,
+            ABANDONED,
+            MERGE_FAILED
+        };
+
+        inline PartitionStatus GetPartitionStatus() const
+        {
+            return mPartitionStatus;
+        }
+
         // Locate those tetrahedra faces that do not share other tetrahedra.
         // The returned array has hull.size() = 3*numFaces indices, each
         // triple representing a triangle. The triangles are counterclockwise
@@ -332,38 +484,49 @@ namespace gtl
         // Copy Delaunay tetrahedra to compact arrays mIndices and
         // mAdjacencies. The array information is accessible via the
         // functions GetIndices(std::size_t, std::array<std::int32_t, 4>&) and
-        // GetAdjacencies(std::size_t, std::array<std::int32_t, 4>&).
+        // GetAdjacencies(std::size_t, std::array<std::int32_t, 4>&). The
+        // tetrahedra are numbered in the order of their slots in
+        // mTetrahedra, skipping the deleted slots, after which the storage
+        // of mTetrahedra is released.
         void UpdateIndicesAdjacencies()
         {
             // Assign integer values to the tetrahedra for use by the caller.
-            auto const& smap = mGraph.GetTetrahedra();
-            std::map<Tetrahedron*, std::size_t> permute{};
-            std::size_t i = invalid;
-            permute[nullptr] = i++;
-            for (auto const& element : smap)
+            std::vector<std::uint32_t> permute(mTetrahedra.size(), invalid32);
+            std::uint32_t numTetrahedra = 0;
+            for (std::size_t t = 0; t < mTetrahedra.size(); ++t)
             {
-                permute[element.second.get()] = i++;
+                if (mTetrahedra[t].V[0] != invalid32)
+                {
+                    permute[t] = numTetrahedra++;
+                }
             }
 
             // Put Delaunay tetrahedra into an array (points and adjacency
             // info).
-            mNumTetrahedra = smap.size();
+            mNumTetrahedra = numTetrahedra;
             std::size_t numIndices = 4 * mNumTetrahedra;
             if (mNumTetrahedra > 0)
             {
                 mIndices.resize(numIndices);
                 mAdjacencies.resize(numIndices);
-                i = 0;
-                for (auto const& element : smap)
+                std::size_t i = 0;
+                for (auto const& tetra : mTetrahedra)
                 {
-                    Tetrahedron* tetra = element.second.get();
-                    for (std::size_t j = 0; j < 4; ++j, ++i)
+                    if (tetra.V[0] != invalid32)
                     {
-                        mIndices[i] = tetra->V[j];
-                        mAdjacencies[i] = permute[tetra->S[j]];
+                        for (std::size_t j = 0; j < 4; ++j, ++i)
+                        {
+                            mIndices[i] = tetra.V[j];
+                            mAdjacencies[i] = (tetra.S[j] != invalid32 ?
+                                permute[tetra.S[j]] : invalid);
+                        }
                     }
                 }
             }
+
+            std::vector<CompactTetrahedron>().swap(mTetrahedra);
+            mFreeTetrahedra = invalid32;
+            mLastTetra = invalid32;
         }
 
         // Get the vertex indices for tetrahedron i. The function returns
@@ -577,15 +740,35 @@ namespace gtl
         Vector3<T> const* mPoints;
         std::vector<Vector3<InputRational>> mIRVertices;
 
-        DynamicTSManifoldMesh mGraph;
+        mutable DynamicTSManifoldMesh mGraph;
 
     private:
         // The compute type used for exact sign classification.
         static std::size_t constexpr ComputeNumWords = std::is_same<T, float>::value ? 44 : 330;
         using ComputeRational = BSNumber<UIntegerFP32<ComputeNumWords>>;
 
-        // Convenient renaming.
-        typedef DynamicTSManifoldMesh::Tetrahedron Tetrahedron;
+        static std::uint32_t constexpr invalid32 = std::numeric_limits<std::uint32_t>::max();
+
+        // A tetrahedron of the tetrahedralization under construction.
+        // V[] are indices into mPoints[] and S[j] is the index of the
+        // tetrahedron that shares the face opposite V[j], or invalid32 when
+        // that face is on the hull. A deleted tetrahedron has
+        // V[0] = invalid32 and S[0] is the next slot of the free list.
+        struct CompactTetrahedron
+        {
+            std::array<std::uint32_t, 4> V;
+            std::array<std::uint32_t, 4> S;
+        };
+
+        // A face <V[0],V[1],V[2]> of a new tetrahedron <P,V[0],V[1],V[2]>.
+        // The face is opposite vertex V[adjacentFace] of the tetrahedron
+        // 'adjacent' on the other side of the face, or adjacent is invalid32
+        // when the face is on the hull.
+        struct CavityFace
+        {
+            std::array<std::uint32_t, 3> V;
+            std::uint32_t adjacent, adjacentFace;
+        };
 
         struct ProcessedVertex
         {
@@ -606,14 +789,16 @@ namespace gtl
             // Support for hashing in std::unordered_set<>. The first
             // operator() is the hash function. The second operator() is
             // the equality comparison used for elements in the same bucket.
+            // The location is not part of the key, so a point that equals
+            // an already processed point is found regardless of its index.
             std::size_t operator()(ProcessedVertex const& v) const
             {
-                return HashValue(v.vertex[0], v.vertex[1], v.vertex[2], v.location);
+                return HashValue(v.vertex[0], v.vertex[1], v.vertex[2]);
             }
 
             bool operator()(ProcessedVertex const& v0, ProcessedVertex const& v1) const
             {
-                return v0.vertex == v1.vertex && v0.location == v1.location;
+                return v0.vertex == v1.vertex;
             }
 
             Vector3<T> vertex;
@@ -626,8 +811,6 @@ namespace gtl
         using DirectedTriangleKeySet = std::unordered_set<
             TriangleKey<true>, TriangleKey<true>, TriangleKey<true>>;
 
-        using TetrahedronPtrSet = std::unordered_set<Tetrahedron*>;
-
         // Given a plane with origin V0 and normal N = Cross(V1-V0,V2-V0)
         // and given a query point P, ToPlane returns
         //   +1, P on positive side of plane (side to which N points)
@@ -638,13 +821,21 @@ namespace gtl
             // The expression tree has 34 nodes consisting of 12 input
             // leaves and 22 compute nodes.
 
-            // Use interval arithmetic to determine the sign if possible.
+            // Get the query point and the vertices.
             auto const& inP = (pIndex != invalid ? mPoints[pIndex] : mQueryPoint);
             Vector3<T> const& inV0 = mPoints[v0Index];
             Vector3<T> const& inV1 = mPoints[v1Index];
             Vector3<T> const& inV2 = mPoints[v2Index];
 
-            // Evaluate the expression tree of intervals.
+            // Use a floating-point filter to determine the sign if possible.
+            std::int32_t const fSign = ExactToPlane3<T>::Filter(inP, inV0, inV1, inV2);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
+            // Use interval arithmetic to determine the sign if possible.
             auto x0 = SWInterval<T>::Sub(inP[0], inV0[0]);
             auto y0 = SWInterval<T>::Sub(inP[1], inV0[1]);
             auto z0 = SWInterval<T>::Sub(inP[2], inV0[2]);
@@ -670,10 +861,12 @@ namespace gtl
 
             if (det[0] > C_<T>(0))
             {
+                ++mStatistics.numInterval;
                 return +1;
             }
             else if (det[1] < C_<T>(0))
             {
+                ++mStatistics.numInterval;
                 return -1;
             }
 
@@ -747,6 +940,7 @@ namespace gtl
             crX1C1 = crX1 * crC1;
             crX2C2 = crX2 * crC2;
             crDet = crX0C0 + crX1C1 + crX2C2;
+            ++mStatistics.numRational;
             return crDet.GetSign();
         }
 
@@ -761,14 +955,22 @@ namespace gtl
             // The expression tree has 98 nodes consisting of 15 input
             // leaves and 83 compute nodes.
 
-            // Use interval arithmetic to determine the sign if possible.
+            // Get the query point and the vertices.
             auto const& inP = (pIndex != invalid ? mPoints[pIndex] : mQueryPoint);
             Vector3<T> const& inV0 = mPoints[v0Index];
             Vector3<T> const& inV1 = mPoints[v1Index];
             Vector3<T> const& inV2 = mPoints[v2Index];
             Vector3<T> const& inV3 = mPoints[v3Index];
 
-            // Evaluate the expression tree of intervals.
+            // Use a floating-point filter to determine the sign if possible.
+            std::int32_t const fSign = ExactToCircumsphere3<T>::Filter(inP, inV0, inV1, inV2, inV3);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
+            // Use interval arithmetic to determine the sign if possible.
             auto x0 = SWInterval<T>::Sub(inV0[0], inP[0]);
             auto y0 = SWInterval<T>::Sub(inV0[1], inP[1]);
             auto z0 = SWInterval<T>::Sub(inV0[2], inP[2]);
@@ -855,10 +1057,12 @@ namespace gtl
 
             if (det[0] > C_<T>(0))
             {
+                ++mStatistics.numInterval;
                 return +1;
             }
             else if (det[1] < C_<T>(0))
             {
+                ++mStatistics.numInterval;
                 return -1;
             }
 
@@ -1058,38 +1262,99 @@ namespace gtl
             crU4V1 = crU4 * crV1;
             crU5V0 = crU5 * crV0;
             crDet = crU0V5 - crU1V4 + crU2V3 + crU3V2 - crU4V1 + crU5V0;
-            return crDet.GetSign();
+            ++mStatistics.numRational;
+            std::int32_t const sign = crDet.GetSign();
+            if (sign == 0)
+            {
+                mHasCosphericalPoints = true;
+            }
+            return sign;
         }
 
-        bool GetContainingTetrahedron(std::size_t pIndex, Tetrahedron*& tetra) const
+        // Create a tetrahedron with no adjacent tetrahedra. The slot of a
+        // deleted tetrahedron is reused when there is one.
+        std::uint32_t CreateTetrahedron(std::uint32_t v0, std::uint32_t v1,
+            std::uint32_t v2, std::uint32_t v3)
         {
-            std::size_t const numTetrahedra = mGraph.GetTetrahedra().size();
-            for (std::size_t t = 0; t < numTetrahedra; ++t)
+            std::uint32_t t{};
+            if (mFreeTetrahedra != invalid32)
+            {
+                t = mFreeTetrahedra;
+                mFreeTetrahedra = mTetrahedra[t].S[0];
+            }
+            else
             {
+                GTL_LENGTH_ASSERT(
+                    mTetrahedra.size() < static_cast<std::size_t>(invalid32),
+                    "The number of tetrahedra exceeds the range of 32-bit indices.");
+
+                t = static_cast<std::uint32_t>(mTetrahedra.size());
+                mTetrahedra.push_back(CompactTetrahedron{});
+            }
+
+            CompactTetrahedron& tetra = mTetrahedra[t];
+            tetra.V = { v0, v1, v2, v3 };
+            tetra.S = { invalid32, invalid32, invalid32, invalid32 };
+            return t;
+        }
+
+        // Move a tetrahedron to the free list. Its adjacent tetrahedra are
+        // not modified.
+        void DeleteTetrahedron(std::uint32_t t)
+        {
+            CompactTetrahedron& tetra = mTetrahedra[t];
+            tetra.V[0] = invalid32;
+            tetra.S[0] = mFreeTetrahedra;
+            mFreeTetrahedra = t;
+        }
+
+        // Get the index j for which tetra.S[j] is t.
+        static std::uint32_t GetAdjacentFace(CompactTetrahedron const& tetra, std::uint32_t t)
+        {
+            for (std::uint32_t j = 0; j < 4; ++j)
+            {
+                if (tetra.S[j] == t)
+                {
+                    return j;
+                }
+            }
+            GTL_RUNTIME_ERROR(
+                "The tetrahedra are not adjacent.");
+        }
+
+        // Walk from tetrahedron t toward the point. If the point is outside
+        // the hull, the walk ends at a hull face visible to the point; that
+        // face is opposite vertex V[face] of the returned tetrahedron.
+        bool GetContainingTetrahedron(std::size_t pIndex, std::uint32_t& t,
+            std::size_t& face) const
+        {
+            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+            std::size_t const numTetrahedra = mTetrahedra.size();
+            for (std::size_t i = 0; i < numTetrahedra; ++i)
+            {
+                CompactTetrahedron const& tetra = mTetrahedra[t];
                 std::size_t j{};
                 for (j = 0; j < 4; ++j)
                 {
-                    auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
-                    if (ToPlane(pIndex, tetra->V[opposite[j][0]],
-                        tetra->V[opposite[j][1]], tetra->V[opposite[j][2]]) > 0)
+                    if (ToPlane(pIndex, tetra.V[opposite[j][0]],
+                        tetra.V[opposite[j][1]], tetra.V[opposite[j][2]]) > 0)
                     {
                         // Point i sees face <v0,v1,v2> from outside the
                         // tetrahedron.
-                        auto adjTetra = tetra->S[j];
-                        if (adjTetra)
+                        if (tetra.S[j] != invalid32)
                         {
                             // Traverse to the tetrahedron sharing the face.
-                            tetra = adjTetra;
+                            t = tetra.S[j];
                             break;
                         }
                         else
                         {
                             // We reached a hull face, so the point is outside
                             // the hull.
+                            face = j;
                             return false;
                         }
                     }
-
                 }
 
                 if (j == 4)
@@ -1104,92 +1369,198 @@ namespace gtl
                 "Unexpected termination of loop.");
         }
 
-        void GetAndRemoveInsertionPolyhedron(std::size_t pIndex,
-            TetrahedronPtrSet& candidates, DirectedTriangleKeySet& boundary)
+        // Copy a tetrahedron of the insertion polyhedron to mCavity and
+        // delete it. A deleted tetrahedron has V[0] = invalid32, which is
+        // how the search recognizes the tetrahedra already in mCavity.
+        void AddToCavity(std::uint32_t t)
         {
-            // Locate the tetrahedra that make up the insertion polyhedron.
-            DynamicTSManifoldMesh polyhedron{};
-            while (candidates.size() > 0)
-            {
-                Tetrahedron* tetra = *candidates.begin();
-                candidates.erase(candidates.begin());
+            mCavity.push_back(std::make_pair(t, mTetrahedra[t]));
+            DeleteTetrahedron(t);
+        }
 
+        // The tetrahedra of mCavity are the initial tetrahedra of the
+        // insertion polyhedron. Add the tetrahedra connected to them whose
+        // circumspheres contain point P and store the boundary faces of the
+        // polyhedron in mCavityFaces.
+        void GetAndRemoveInsertionPolyhedron(std::size_t pIndex)
+        {
+            for (std::size_t c = 0; c < mCavity.size(); ++c)
+            {
                 for (std::size_t j = 0; j < 4; ++j)
                 {
-                    auto adj = tetra->S[j];
-                    if (adj && candidates.find(adj) == candidates.end())
+                    std::uint32_t const a = mCavity[c].second.S[j];
+                    if (a != invalid32 && mTetrahedra[a].V[0] != invalid32)
                     {
-                        if (ToCircumsphere(pIndex, adj->V[0], adj->V[1],
-                            adj->V[2], adj->V[3]) <= 0)
+                        CompactTetrahedron const& adj = mTetrahedra[a];
+                        if (ToCircumsphere(pIndex, adj.V[0], adj.V[1],
+                            adj.V[2], adj.V[3]) <= 0)
                         {
                             // Point P is in the circumsphere.
-                            candidates.insert(adj);
+                            AddToCavity(a);
                         }
                     }
                 }
+            }
 
-                auto inserted = polyhedron.Insert(tetra->V[0], tetra->V[1],
-                    tetra->V[2], tetra->V[3]);
-                GTL_RUNTIME_ASSERT(
-                    inserted != nullptr,
-                    "Unexpected insertion failure.");
+            // Get the boundary triangles of the insertion polyhedron. The
+            // adjacent faces are looked up before any slot is reused.
+            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+            mCavityFaces.clear();
+            for (auto const& element : mCavity)
+            {
+                CompactTetrahedron const& tetra = element.second;
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    std::uint32_t const a = tetra.S[j];
+                    if (a == invalid32 || mTetrahedra[a].V[0] != invalid32)
+                    {
+                        CavityFace face{};
+                        face.V = { tetra.V[opposite[j][0]], tetra.V[opposite[j][1]],
+                            tetra.V[opposite[j][2]] };
+                        face.adjacent = a;
+                        face.adjacentFace = (a != invalid32 ?
+                            GetAdjacentFace(mTetrahedra[a], element.first) : invalid32);
+                        mCavityFaces.push_back(face);
+                    }
+                }
+            }
+        }
 
-                auto removed = mGraph.Remove(tetra->V[0], tetra->V[1],
-                    tetra->V[2], tetra->V[3]);
-                GTL_RUNTIME_ASSERT(
-                    removed,
-                    "Unexpected removal failure.");
+        // Given a hull face opposite vertex V[face] of tetrahedron t and an
+        // edge <a,b> of that face, rotate about the edge through the
+        // tetrahedra sharing it to reach the other hull face that contains
+        // the edge.
+        void GetAdjacentHullFace(std::uint32_t a, std::uint32_t b,
+            std::uint32_t& t, std::size_t& face) const
+        {
+            // The current tetrahedron is entered through a face <a,b,c>.
+            // It is exited through the face opposite c, which contains the
+            // edge and the fourth vertex w.
+            std::uint32_t c = invalid32;
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                std::uint32_t const v = mTetrahedra[t].V[j];
+                if (j != face && v != a && v != b)
+                {
+                    c = v;
+                    break;
+                }
             }
 
-            // Get the boundary triangles of the insertion polyhedron.
-            for (auto const& element : polyhedron.GetTetrahedra())
+            for (;;)
             {
-                Tetrahedron* tetra = element.second.get();
+                CompactTetrahedron const& tetra = mTetrahedra[t];
+                std::size_t exit = 0;
+                std::uint32_t w = invalid32;
                 for (std::size_t j = 0; j < 4; ++j)
                 {
-                    if (!tetra->S[j])
+                    std::uint32_t const v = tetra.V[j];
+                    if (v == c)
+                    {
+                        exit = j;
+                    }
+                    else if (v != a && v != b)
                     {
-                        auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
-                        boundary.insert(TriangleKey<true>(tetra->V[opposite[j][0]],
-                            tetra->V[opposite[j][1]], tetra->V[opposite[j][2]]));
+                        w = v;
                     }
                 }
+
+                if (tetra.S[exit] == invalid32)
+                {
+                    face = exit;
+                    return;
+                }
+                t = tetra.S[exit];
+                c = w;
+            }
+        }
+
+        // Insert the tetrahedron <P,V[0],V[1],V[2]> for a face whose plane
+        // has point P on its negative side and link it to the tetrahedron
+        // outside the face. The faces that contain P are stored in
+        // mNewFaces for linking by InsertNewTetrahedra.
+        void InsertNewTetrahedron(std::size_t pIndex, CavityFace const& face)
+        {
+            std::uint32_t const p = static_cast<std::uint32_t>(pIndex);
+            std::uint32_t const t = CreateTetrahedron(p, face.V[0], face.V[1], face.V[2]);
+            if (face.adjacent != invalid32)
+            {
+                mTetrahedra[t].S[0] = face.adjacent;
+                mTetrahedra[face.adjacent].S[face.adjacentFace] = t;
+            }
+
+            // The face opposite V[j] for j > 0 contains the edge of
+            // <V[0],V[1],V[2]> that does not contain V[j-1].
+            std::uint64_t const tetra = static_cast<std::uint64_t>(t) << 2;
+            mNewFaces.push_back(std::make_pair(GetEdgeCode(face.V[1], face.V[2]), tetra | 1));
+            mNewFaces.push_back(std::make_pair(GetEdgeCode(face.V[0], face.V[2]), tetra | 2));
+            mNewFaces.push_back(std::make_pair(GetEdgeCode(face.V[0], face.V[1]), tetra | 3));
+            mLastTetra = t;
+        }
+
+        static std::uint64_t GetEdgeCode(std::uint32_t v0, std::uint32_t v1)
+        {
+            return v0 < v1 ?
+                (static_cast<std::uint64_t>(v0) << 32) | v1 :
+                (static_cast<std::uint64_t>(v1) << 32) | v0;
+        }
+
+        // Insert the tetrahedra formed by point P and the back faces of the
+        // boundary of the removed insertion polyhedron, and then those
+        // formed by point P and the visible hull faces in mVisibleFaces.
+        // Two new tetrahedra are adjacent when their faces opposite P share
+        // an edge. A new face that is not shared is a hull face.
+        void InsertNewTetrahedra(std::size_t pIndex)
+        {
+            mNewFaces.clear();
+            for (auto const& face : mCavityFaces)
+            {
+                if (ToPlane(pIndex, face.V[0], face.V[1], face.V[2]) < 0)
+                {
+                    InsertNewTetrahedron(pIndex, face);
+                }
+            }
+            for (auto const& face : mVisibleFaces)
+            {
+                InsertNewTetrahedron(pIndex, face);
+            }
+
+            std::sort(mNewFaces.begin(), mNewFaces.end());
+            for (std::size_t i = 0; i + 1 < mNewFaces.size(); ++i)
+            {
+                if (mNewFaces[i].first == mNewFaces[i + 1].first)
+                {
+                    GTL_RUNTIME_ASSERT(
+                        i + 2 == mNewFaces.size() || mNewFaces[i + 1].first != mNewFaces[i + 2].first,
+                        "Unexpected nonmanifold insertion.");
+
+                    std::uint64_t const face0 = mNewFaces[i].second;
+                    std::uint64_t const face1 = mNewFaces[i + 1].second;
+                    std::uint32_t const t0 = static_cast<std::uint32_t>(face0 >> 2);
+                    std::uint32_t const t1 = static_cast<std::uint32_t>(face1 >> 2);
+                    mTetrahedra[t0].S[face0 & 3] = t1;
+                    mTetrahedra[t1].S[face1 & 3] = t0;
+                    ++i;
+                }
             }
         }
 
         void Update(std::size_t pIndex)
         {
-            auto const& smap = mGraph.GetTetrahedra();
-            Tetrahedron* tetra = smap.begin()->second.get();
-            if (GetContainingTetrahedron(pIndex, tetra))
+            mCavity.clear();
+            mVisibleFaces.clear();
+
+            // Walk from the most recently created tetrahedron. For spatially
+            // coherent insertion orders, it is near the point.
+            std::uint32_t t = mLastTetra;
+            std::size_t face = 0;
+            if (GetContainingTetrahedron(pIndex, t, face))
             {
                 // The point is inside the convex hull. The insertion
                 // polyhedron contains only tetrahedra in the current
-                // tetrahedralization; the hull does not change.
-
-                // Use a depth-first search for those tetrahedra whose
-                // circumspheres contain point P.
-                TetrahedronPtrSet candidates{};
-                candidates.insert(tetra);
-
-                // Get the boundary of the insertion polyhedron C that
-                // contains the tetrahedra whose circumspheres contain point
-                // P. Polyhedron C contains this point.
-                DirectedTriangleKeySet boundary{};
-                GetAndRemoveInsertionPolyhedron(pIndex, candidates, boundary);
-
-                // The insertion polyhedron consists of the tetrahedra formed
-                // by point i and the faces of C.
-                for (auto const& key : boundary)
-                {
-                    if (ToPlane(pIndex, key[0], key[1], key[2]) < 0)
-                    {
-                        auto inserted = mGraph.Insert(pIndex, key[0], key[1], key[2]);
-                        GTL_RUNTIME_ASSERT(
-                            inserted != nullptr,
-                            "Unexpected insertion failure.");
-                    }
-                }
+                // tetrahedralization; the hull does not change. Search for
+                // those tetrahedra whose circumspheres contain point P.
+                AddToCavity(t);
             }
             else
             {
@@ -1198,87 +1569,761 @@ namespace gtl
                 // current tetrahedralization whose circumspheres contain
                 // point P.
 
-                // Locate the convex hull of the tetrahedra.
-                DirectedTriangleKeySet hull{};
-                for (auto const& element : smap)
+                // The hull faces visible to point P form a connected set
+                // that contains the face where the walk ended. Visit them
+                // by a search over the edge-adjacent hull faces, which
+                // avoids enumerating the entire hull. The tetrahedra are
+                // not modified until the search is complete.
+                auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+                DirectedTriangleKeySet tested{};
+                std::vector<std::pair<std::uint32_t, std::size_t>> stack{};
+                mHullFaces.clear();
+                stack.push_back(std::make_pair(t, face));
+                tested.insert(TriangleKey<true>(mTetrahedra[t].V[opposite[face][0]],
+                    mTetrahedra[t].V[opposite[face][1]], mTetrahedra[t].V[opposite[face][2]]));
+                while (stack.size() > 0)
+                {
+                    std::uint32_t const hullTetra = stack.back().first;
+                    std::size_t const hullFace = stack.back().second;
+                    stack.pop_back();
+                    mHullFaces.push_back(std::make_pair(hullTetra, hullFace));
+
+                    std::array<std::uint32_t, 3> const key
+                    {
+                        mTetrahedra[hullTetra].V[opposite[hullFace][0]],
+                        mTetrahedra[hullTetra].V[opposite[hullFace][1]],
+                        mTetrahedra[hullTetra].V[opposite[hullFace][2]]
+                    };
+
+                    for (std::size_t i0 = 2, i1 = 0; i1 < 3; i0 = i1++)
+                    {
+                        std::uint32_t adjTetra = hullTetra;
+                        std::size_t adjFace = hullFace;
+                        GetAdjacentHullFace(key[i0], key[i1], adjTetra, adjFace);
+                        auto const& adjV = mTetrahedra[adjTetra].V;
+                        TriangleKey<true> adjKey(adjV[opposite[adjFace][0]],
+                            adjV[opposite[adjFace][1]], adjV[opposite[adjFace][2]]);
+                        if (tested.insert(adjKey).second &&
+                            ToPlane(pIndex, adjKey[0], adjKey[1], adjKey[2]) > 0)
+                        {
+                            stack.push_back(std::make_pair(adjTetra, adjFace));
+                        }
+                    }
+                }
+
+                // A tetrahedron with a visible hull face is in the insertion
+                // polyhedron when point P is in its circumsphere. Otherwise,
+                // the face is stored with reversed ordering so that P is on
+                // its negative side.
+                for (auto const& element : mHullFaces)
+                {
+                    std::uint32_t const hullTetra = element.first;
+                    std::size_t const hullFace = element.second;
+                    CompactTetrahedron const& tetra = mTetrahedra[hullTetra];
+                    if (tetra.V[0] == invalid32)
+                    {
+                        // The tetrahedron is already in the polyhedron.
+                        continue;
+                    }
+
+                    if (ToCircumsphere(pIndex, tetra.V[0], tetra.V[1],
+                        tetra.V[2], tetra.V[3]) <= 0)
+                    {
+                        // Point P is in the circumsphere.
+                        AddToCavity(hullTetra);
+                    }
+                    else
+                    {
+                        // Point P is not in the circumsphere but the
+                        // hull face is visible.
+                        CavityFace visible{};
+                        visible.V = { tetra.V[opposite[hullFace][0]],
+                            tetra.V[opposite[hullFace][2]], tetra.V[opposite[hullFace][1]] };
+                        visible.adjacent = hullTetra;
+                        visible.adjacentFace = static_cast<std::uint32_t>(hullFace);
+                        mVisibleFaces.push_back(visible);
+                    }
+                }
+            }
+
+            // Get the boundary of the insertion polyhedron C that contains
+            // the tetrahedra whose circumspheres contain point P. The
+            // new tetrahedra are formed by point P and the back faces of C
+            // and, when P is outside the hull, the visible faces of the
+            // tetrahedra not in C.
+            GetAndRemoveInsertionPolyhedron(pIndex);
+            InsertNewTetrahedra(pIndex);
+        }
+
+        // Support for the multithreaded tetrahedralization. A cell must have
+        // at least minPartitionSize points to be processed concurrently. The
+        // border points are not partitioned again: they are concentrated
+        // in thin layers around the cell boundaries, and the circumspheres
+        // of the tetrahedra of such a layer cross the boundaries of any
+        // partition of it.
+        static std::size_t constexpr minPartitionSize = 4096;
+
+        // A cell of the k-d tree partition. It contains the points
+        // mPoints[subset[i]] for begin <= i < end. The cell box is the open
+        // box lo < x < hi; a point strictly inside the box is in the cell.
+        struct PartitionCell
+        {
+            PartitionCell()
+                :
+                begin(0),
+                end(0),
+                lo{},
+                hi{}
+            {
+            }
+
+            std::size_t begin, end;
+            std::array<double, 3> lo, hi;
+        };
+
+        // The tetrahedralization of a cell. The interior tetrahedra are
+        // those whose circumspheres are strictly inside the cell box. Their
+        // vertices are indices into mPoints[] and their adjacent tetrahedra
+        // are indices into 'interior'. A face that is not shared with
+        // another interior tetrahedron is an interface face and has
+        // adjacent tetrahedron invalid32. The border points are the
+        // vertices of the other tetrahedra and of the hull faces of the cell.
+        struct PartitionResult
+        {
+            PartitionResult()
+                :
+                interior{},
+                border{},
+                statistics{},
+                hasCosphericalPoints(false)
+            {
+            }
+
+            std::vector<CompactTetrahedron> interior;
+            std::vector<std::size_t> border;
+            PredicateStatistics statistics;
+            bool hasCosphericalPoints;
+        };
+
+        // An interface face of the merged mesh. The face is shared by the
+        // interior tetrahedron tetra[0], whose vertex opposite the face is
+        // apex, and the filling tetrahedron tetra[1], which is invalid32
+        // when the face is on the hull.
+        struct InterfaceFace
+        {
+            InterfaceFace()
+                :
+                apex(0),
+                tetra{ invalid32, invalid32 }
+            {
+            }
+
+            std::size_t apex;
+            std::array<std::uint32_t, 2> tetra;
+        };
+
+        using InterfaceFaceMap = std::unordered_map<TriangleKey<false>, InterfaceFace,
+            TriangleKey<false>, TriangleKey<false>>;
+
+        // Tetrahedralize the points mPoints[subset[]] with a single thread.
+        // The function returns false when the points do not have a
+        // tetrahedralization. The vertex indices of the output of
+        // 'delaunay' are indices into subset[].
+        bool TetrahedralizeSubset(std::vector<std::size_t> const& subset,
+            Delaunay3<T>& delaunay)
+        {
+            std::vector<Vector3<T>> points(subset.size());
+            for (std::size_t i = 0; i < subset.size(); ++i)
+            {
+                points[i] = mPoints[subset[i]];
+            }
+
+            bool const success = delaunay(points, true);
+            mStatistics += delaunay.GetPredicateStatistics();
+            return success;
+        }
+
+        // Split the points mPoints[subset[i]] for first <= i < last into
+        // numCells cells. The number of points of each child is proportional
+        // to its number of cells. The split is along the axis of largest
+        // extent of the points, and the points are ordered by that
+        // coordinate, with ties broken by index, so the cells depend only on
+        // the inputs.
+        void SplitPartitionCell(std::vector<std::size_t>& subset, std::size_t first,
+            std::size_t last, std::size_t numCells, PartitionCell const& cell,
+            std::vector<PartitionCell>& cells) const
+        {
+            if (numCells == 1)
+            {
+                cells.push_back(cell);
+                cells.back().begin = first;
+                cells.back().end = last;
+                return;
+            }
+
+            Vector3<T> vmin = mPoints[subset[first]], vmax = vmin;
+            for (std::size_t i = first + 1; i < last; ++i)
+            {
+                Vector3<T> const& point = mPoints[subset[i]];
+                for (std::size_t d = 0; d < 3; ++d)
+                {
+                    vmin[d] = std::min(vmin[d], point[d]);
+                    vmax[d] = std::max(vmax[d], point[d]);
+                }
+            }
+            std::size_t axis = 0;
+            for (std::size_t d = 1; d < 3; ++d)
+            {
+                if (vmax[d] - vmin[d] > vmax[axis] - vmin[axis])
+                {
+                    axis = d;
+                }
+            }
+
+            std::size_t const numLower = numCells / 2;
+            std::size_t const middle = first + (last - first) * numLower / numCells;
+            auto const begin = subset.begin();
+            std::nth_element(begin + first, begin + middle, begin + last,
+                [this, axis](std::size_t i0, std::size_t i1)
+                {
+                    T const& x0 = mPoints[i0][axis];
+                    T const& x1 = mPoints[i1][axis];
+                    return x0 < x1 || (x0 == x1 && i0 < i1);
+                });
+
+            // The lower cell is bounded by its largest coordinate and the
+            // upper cell by its smallest coordinate, which is that of the
+            // point at the split position.
+            PartitionCell lower = cell, upper = cell;
+            T xmax = mPoints[subset[first]][axis];
+            for (std::size_t i = first + 1; i < middle; ++i)
+            {
+                xmax = std::max(xmax, mPoints[subset[i]][axis]);
+            }
+            lower.hi[axis] = static_cast<double>(xmax);
+            upper.lo[axis] = static_cast<double>(mPoints[subset[middle]][axis]);
+
+            SplitPartitionCell(subset, first, middle, numLower, lower, cells);
+            SplitPartitionCell(subset, middle, last, numCells - numLower, upper, cells);
+        }
+
+        // Tetrahedralize the points of a cell. The function is called
+        // concurrently, so it does not modify the members of this object.
+        void TetrahedralizePartition(std::size_t numSubset, std::size_t const* subset,
+            PartitionCell const& cell, PartitionResult& result) const
+        {
+            std::vector<Vector3<T>> points(numSubset);
+            for (std::size_t i = 0; i < numSubset; ++i)
+            {
+                points[i] = mPoints[subset[i]];
+            }
+
+            Delaunay3<T> delaunay{};
+            bool const success = delaunay(points, true);
+            result.statistics = delaunay.GetPredicateStatistics();
+            result.hasCosphericalPoints = delaunay.mHasCosphericalPoints;
+            if (!success)
+            {
+                // The cell points are not in general position, so all of
+                // them are border points.
+                result.border.assign(subset, subset + numSubset);
+                return;
+            }
+
+            // Number the interior tetrahedra.
+            auto const& indices = delaunay.GetIndices();
+            auto const& adjacencies = delaunay.GetAdjacencies();
+            std::size_t const numTetrahedra = delaunay.GetNumTetrahedra();
+            std::vector<std::uint32_t> interior(numTetrahedra, invalid32);
+            std::uint32_t numInterior = 0;
+            for (std::size_t t = 0; t < numTetrahedra; ++t)
+            {
+                std::size_t const* v = &indices[4 * t];
+                if (IsCircumsphereInBox(points[v[0]], points[v[1]],
+                    points[v[2]], points[v[3]], cell.lo, cell.hi))
+                {
+                    interior[t] = numInterior++;
+                }
+            }
+
+            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+            std::vector<std::uint8_t> isBorder(numSubset, 0);
+            result.interior.reserve(numInterior);
+            for (std::size_t t = 0; t < numTetrahedra; ++t)
+            {
+                std::size_t const* v = &indices[4 * t];
+                std::size_t const* adj = &adjacencies[4 * t];
+                if (interior[t] != invalid32)
+                {
+                    CompactTetrahedron tetra{};
+                    for (std::size_t j = 0; j < 4; ++j)
+                    {
+                        tetra.V[j] = static_cast<std::uint32_t>(subset[v[j]]);
+                        tetra.S[j] = (adj[j] != invalid ? interior[adj[j]] : invalid32);
+                    }
+                    result.interior.push_back(tetra);
+                }
+                else
                 {
-                    Tetrahedron* t = element.second.get();
                     for (std::size_t j = 0; j < 4; ++j)
                     {
-                        if (!t->S[j])
+                        isBorder[v[j]] = 1;
+                    }
+                }
+
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    if (adj[j] == invalid)
+                    {
+                        for (std::size_t k = 0; k < 3; ++k)
                         {
-                            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
-                            hull.insert(TriangleKey<true>(t->V[opposite[j][0]],
-                                t->V[opposite[j][1]], t->V[opposite[j][2]]));
+                            isBorder[v[opposite[j][k]]] = 1;
                         }
                     }
                 }
+            }
+
+            for (std::size_t i = 0; i < numSubset; ++i)
+            {
+                if (isBorder[i] != 0)
+                {
+                    result.border.push_back(subset[i]);
+                }
+            }
+        }
+
+        // Determine whether the circumsphere of the tetrahedron is strictly
+        // inside the box lo < x < hi. The computation uses floating-point
+        // arithmetic and is conservative. The function returns false when
+        // the tetrahedron is nearly flat, in which case the circumcenter is
+        // ill-conditioned, or when the sphere is within a relative margin of
+        // a box face. When the function returns true, the sphere is inside
+        // the box.
+        static bool IsCircumsphereInBox(Vector3<T> const& v0, Vector3<T> const& v1,
+            Vector3<T> const& v2, Vector3<T> const& v3,
+            std::array<double, 3> const& lo, std::array<double, 3> const& hi)
+        {
+            // Solve Dot(E[i],C) = Dot(E[i],E[i])/2 for the circumcenter
+            // offset C = center - V0, where E[i] = V[i+1] - V0.
+            std::array<Vector3<T> const*, 3> const V{ &v1, &v2, &v3 };
+            std::array<std::array<double, 3>, 3> E{};
+            std::array<double, 3> B{};
+            double maxLength = 0.0;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                for (std::size_t d = 0; d < 3; ++d)
+                {
+                    E[i][d] = static_cast<double>((*V[i])[d]) - static_cast<double>(v0[d]);
+                }
+                B[i] = 0.5 * (E[i][0] * E[i][0] + E[i][1] * E[i][1] + E[i][2] * E[i][2]);
+                maxLength = std::max(maxLength, std::sqrt(2.0 * B[i]));
+            }
+
+            auto Cross = [](std::array<double, 3> const& U, std::array<double, 3> const& W)
+            {
+                return std::array<double, 3>
+                {
+                    U[1] * W[2] - U[2] * W[1],
+                    U[2] * W[0] - U[0] * W[2],
+                    U[0] * W[1] - U[1] * W[0]
+                };
+            };
+
+            std::array<double, 3> const C12 = Cross(E[1], E[2]);
+            std::array<double, 3> const C20 = Cross(E[2], E[0]);
+            std::array<double, 3> const C01 = Cross(E[0], E[1]);
+            double const det = E[0][0] * C12[0] + E[0][1] * C12[1] + E[0][2] * C12[2];
+            double const minDet = 1e-6 * maxLength * maxLength * maxLength;
+            if (!(std::fabs(det) > minDet))
+            {
+                return false;
+            }
+
+            std::array<double, 3> C{};
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                C[d] = (B[0] * C12[d] + B[1] * C20[d] + B[2] * C01[d]) / det;
+            }
+            double const radius = std::sqrt(C[0] * C[0] + C[1] * C[1] + C[2] * C[2]);
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                double const center = static_cast<double>(v0[d]) + C[d];
+                double const extent = radius + 1e-6 * (radius + maxLength) + 1e-12 * std::fabs(center);
+                if (!(center - extent > lo[d] && center + extent < hi[d]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
 
-                // Iterate over all the hull faces and use the ones visible to
-                // point i to locate the insertion polyhedron.
-                auto const& tmap = mGraph.GetTriangles();
-                TetrahedronPtrSet candidates{};
-                DirectedTriangleKeySet visible{};
-                for (auto const& key : hull)
+        // Tetrahedralize the points mPoints[subset[]] by partitioning them
+        // into cells and merging the cell tetrahedralizations into
+        // mTetrahedra. The function returns MERGED on success, ABANDONED
+        // when the cells show that the merge is unlikely to succeed or to
+        // be faster than the incremental insertion and MERGE_FAILED when the
+        // merged mesh fails the verification.
+        PartitionStatus TetrahedralizePartitioned(std::vector<std::size_t> subset,
+            std::size_t numPartitions, ThreadPool* pool)
+        {
+            std::size_t const numSubset = subset.size();
+            PartitionCell root{};
+            root.lo.fill(-std::numeric_limits<double>::infinity());
+            root.hi.fill(std::numeric_limits<double>::infinity());
+            std::vector<PartitionCell> cells{};
+            cells.reserve(numPartitions);
+            SplitPartitionCell(subset, 0, numSubset, numPartitions, root, cells);
+
+            std::vector<PartitionResult> results(numPartitions);
+            ForkJoin(pool, numPartitions,
+                [this, &subset, &cells, &results](std::size_t k)
+                {
+                    PartitionCell const& cell = cells[k];
+                    TetrahedralizePartition(cell.end - cell.begin,
+                        subset.data() + cell.begin, cell, results[k]);
+                });
+
+            // Tetrahedralize the border points.
+            std::vector<std::size_t> border{};
+            bool hasCosphericalPoints = false;
+            for (auto const& result : results)
+            {
+                border.insert(border.end(), result.border.begin(), result.border.end());
+                mStatistics += result.statistics;
+                hasCosphericalPoints = hasCosphericalPoints || result.hasCosphericalPoints;
+            }
+            if (hasCosphericalPoints || 2 * border.size() >= numSubset)
+            {
+                return PartitionStatus::ABANDONED;
+            }
+
+            Delaunay3<T> borderDelaunay{};
+            if (!TetrahedralizeSubset(border, borderDelaunay))
+            {
+                return PartitionStatus::MERGE_FAILED;
+            }
+            auto const& borderIndices = borderDelaunay.GetIndices();
+            auto const& borderAdjacencies = borderDelaunay.GetAdjacencies();
+            std::size_t const numBorderTetrahedra = borderDelaunay.GetNumTetrahedra();
+
+            // Copy the interior tetrahedra to the merged mesh.
+            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+            mTetrahedra.clear();
+            mFreeTetrahedra = invalid32;
+            InterfaceFaceMap interfaces{};
+            for (auto const& result : results)
+            {
+                std::uint32_t const base = static_cast<std::uint32_t>(mTetrahedra.size());
+                for (auto const& interiorTetra : result.interior)
                 {
-                    if (ToPlane(pIndex, key[0], key[1], key[2]) > 0)
+                    std::uint32_t const t = static_cast<std::uint32_t>(mTetrahedra.size());
+                    CompactTetrahedron tetra = interiorTetra;
+                    for (std::size_t j = 0; j < 4; ++j)
+                    {
+                        if (tetra.S[j] != invalid32)
+                        {
+                            tetra.S[j] += base;
+                        }
+                    }
+                    mTetrahedra.push_back(tetra);
+
+                    for (std::size_t j = 0; j < 4; ++j)
                     {
-                        auto iter = tmap.find(TriangleKey<false>(key[0], key[1], key[2]));
-                        if (iter != tmap.end() && iter->second->S[1] == nullptr)
+                        if (tetra.S[j] == invalid32)
                         {
-                            auto adj = iter->second->S[0];
-                            if (adj && candidates.find(adj) == candidates.end())
+                            InterfaceFace face{};
+                            face.apex = tetra.V[j];
+                            face.tetra[0] = t;
+                            if (!interfaces.insert(std::make_pair(TriangleKey<false>(
+                                tetra.V[opposite[j][0]], tetra.V[opposite[j][1]],
+                                tetra.V[opposite[j][2]]), face)).second)
                             {
-                                if (ToCircumsphere(pIndex, adj->V[0], adj->V[1], adj->V[2],
-                                    adj->V[3]) <= 0)
-                                {
-                                    // Point P is in the circumsphere.
-                                    candidates.insert(adj);
-                                }
-                                else
-                                {
-                                    // Point P is not in the circumsphere but
-                                    // the hull face is visible.
-                                    visible.insert(key);
-                                }
+                                return PartitionStatus::MERGE_FAILED;
                             }
                         }
-                        else
+                    }
+                }
+            }
+
+            // The border tetrahedra that fill the space not covered by the
+            // interior tetrahedra are those reachable from the interface
+            // faces without crossing an interface face. The starting
+            // tetrahedra are on the side of an interface face opposite the
+            // interior tetrahedron. If there are no interior tetrahedra, all
+            // the border tetrahedra are used.
+            auto GetBorderFace = [&border, &borderIndices, &opposite](std::size_t t, std::size_t j)
+            {
+                std::size_t const* v = &borderIndices[4 * t];
+                return TriangleKey<false>(border[v[opposite[j][0]]],
+                    border[v[opposite[j][1]]], border[v[opposite[j][2]]]);
+            };
+
+            std::vector<std::uint32_t> filling(numBorderTetrahedra, invalid32);
+            std::vector<std::size_t> stack{};
+            if (mTetrahedra.size() > 0)
+            {
+                for (std::size_t t = 0; t < numBorderTetrahedra; ++t)
+                {
+                    for (std::size_t j = 0; j < 4 && filling[t] == invalid32; ++j)
+                    {
+                        TriangleKey<false> const key = GetBorderFace(t, j);
+                        auto iter = interfaces.find(key);
+                        if (iter != interfaces.end())
                         {
-                            GTL_RUNTIME_ERROR(
-                                "This condition should not occur for rational arithmetic.");
+                            std::size_t const w = border[borderIndices[4 * t + j]];
+                            std::size_t const apex = iter->second.apex;
+                            if (w != apex && ToPlane(w, key[0], key[1], key[2]) !=
+                                ToPlane(apex, key[0], key[1], key[2]))
+                            {
+                                filling[t] = 0;
+                                stack.push_back(t);
+                            }
                         }
                     }
                 }
 
-                // Get the boundary of the insertion subpolyhedron C that
-                // contains the tetrahedra whose circumspheres contain
-                // point P.
-                DirectedTriangleKeySet boundary{};
-                GetAndRemoveInsertionPolyhedron(pIndex, candidates, boundary);
+                while (stack.size() > 0)
+                {
+                    std::size_t const t = stack.back();
+                    stack.pop_back();
+                    for (std::size_t j = 0; j < 4; ++j)
+                    {
+                        std::size_t const adj = borderAdjacencies[4 * t + j];
+                        if (adj != invalid && filling[adj] == invalid32 &&
+                            interfaces.find(GetBorderFace(t, j)) == interfaces.end())
+                        {
+                            filling[adj] = 0;
+                            stack.push_back(adj);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                std::fill(filling.begin(), filling.end(), 0);
+            }
 
-                // The insertion polyhedron P consists of the tetrahedra
-                // formed by point i and the back faces of C *and* the visible
-                // faces of mGraph-C.
-                for (auto const& key : boundary)
+            // Append the filling tetrahedra in the order of the border
+            // tetrahedralization, so the output depends only on the inputs.
+            for (std::size_t t = 0; t < numBorderTetrahedra; ++t)
+            {
+                if (filling[t] != invalid32)
                 {
-                    if (ToPlane(pIndex, key[0], key[1], key[2]) < 0)
+                    GTL_LENGTH_ASSERT(
+                        mTetrahedra.size() < static_cast<std::size_t>(invalid32),
+                        "The number of tetrahedra exceeds the range of 32-bit indices.");
+
+                    filling[t] = static_cast<std::uint32_t>(mTetrahedra.size());
+                    CompactTetrahedron tetra{};
+                    for (std::size_t j = 0; j < 4; ++j)
                     {
-                        // This is a back face of the boundary.
-                        auto inserted = mGraph.Insert(pIndex, key[0], key[1], key[2]);
-                        GTL_RUNTIME_ASSERT(
-                            inserted != nullptr,
-                            "Unexpected insertion failure.");
+                        tetra.V[j] = static_cast<std::uint32_t>(border[borderIndices[4 * t + j]]);
+                        tetra.S[j] = invalid32;
                     }
+                    mTetrahedra.push_back(tetra);
+                }
+            }
+
+            // Link the filling tetrahedra to each other and to the interface
+            // faces. A face shared by more than two tetrahedra makes the
+            // merge fail.
+            for (std::size_t t = 0; t < numBorderTetrahedra; ++t)
+            {
+                if (filling[t] == invalid32)
+                {
+                    continue;
                 }
-                for (auto const& key : visible)
+
+                CompactTetrahedron& tetra = mTetrahedra[filling[t]];
+                for (std::size_t j = 0; j < 4; ++j)
                 {
-                    auto inserted = mGraph.Insert(pIndex, key[0], key[2], key[1]);
-                    GTL_RUNTIME_ASSERT(
-                        inserted != nullptr,
-                        "Unexpected insertion failure.");
+                    auto iter = interfaces.find(GetBorderFace(t, j));
+                    if (iter != interfaces.end())
+                    {
+                        InterfaceFace& face = iter->second;
+                        if (face.tetra[1] != invalid32)
+                        {
+                            return PartitionStatus::MERGE_FAILED;
+                        }
+                        face.tetra[1] = filling[t];
+                    }
+                    else
+                    {
+                        std::size_t const adj = borderAdjacencies[4 * t + j];
+                        if (adj != invalid && filling[adj] != invalid32)
+                        {
+                            tetra.S[j] = filling[adj];
+                        }
+                    }
+                }
+            }
+
+            // The tetrahedra sharing an interface face must be on opposite
+            // sides of the face and the face must be locally Delaunay.
+            for (auto const& element : interfaces)
+            {
+                auto const& key = element.first;
+                InterfaceFace const& face = element.second;
+                if (face.tetra[1] == invalid32)
+                {
+                    continue;
+                }
+
+                CompactTetrahedron& tetra0 = mTetrahedra[face.tetra[0]];
+                CompactTetrahedron& tetra1 = mTetrahedra[face.tetra[1]];
+                std::size_t const j0 = GetOppositeVertex(tetra0, key);
+                std::size_t const j1 = GetOppositeVertex(tetra1, key);
+                std::size_t const w0 = tetra0.V[j0];
+                std::size_t const w1 = tetra1.V[j1];
+                if (ToPlane(w0, key[0], key[1], key[2]) *
+                    ToPlane(w1, key[0], key[1], key[2]) >= 0)
+                {
+                    return PartitionStatus::MERGE_FAILED;
+                }
+                if (ToCircumsphere(w1, tetra0.V[0], tetra0.V[1],
+                    tetra0.V[2], tetra0.V[3]) < 0)
+                {
+                    return PartitionStatus::MERGE_FAILED;
+                }
+                tetra0.S[j0] = face.tetra[1];
+                tetra1.S[j1] = face.tetra[0];
+            }
+
+            return (IsValidMerge(numSubset) ? PartitionStatus::MERGED :
+                PartitionStatus::MERGE_FAILED);
+        }
+
+        // Get the index j of the vertex of the tetrahedron that is not on
+        // the face.
+        static std::size_t GetOppositeVertex(CompactTetrahedron const& tetra,
+            TriangleKey<false> const& face)
+        {
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                std::size_t const v = tetra.V[j];
+                if (v != face[0] && v != face[1] && v != face[2])
+                {
+                    return j;
+                }
+            }
+            GTL_RUNTIME_ERROR(
+                "The face is not a face of the tetrahedron.");
+        }
+
+        // Verify the merged mesh. The interior tetrahedra and the filling
+        // tetrahedra are Delaunay tetrahedralizations of their own points
+        // and the faces they share were verified when they were linked. The
+        // mesh covers the convex hull of the points exactly once when its
+        // boundary is a single closed, locally convex surface, because the
+        // tetrahedra are positively oriented.
+        bool IsValidMerge(std::size_t numVertices) const
+        {
+            // The mesh must use all the points.
+            std::vector<std::uint8_t> used(mNumPoints, 0);
+            std::size_t numUsed = 0;
+            for (auto const& tetra : mTetrahedra)
+            {
+                for (auto v : tetra.V)
+                {
+                    if (used[v] == 0)
+                    {
+                        used[v] = 1;
+                        ++numUsed;
+                    }
+                }
+            }
+            if (numUsed != numVertices)
+            {
+                return false;
+            }
+
+            // Get the boundary faces, counterclockwise ordered when viewed
+            // from outside the mesh, and the boundary faces sharing each
+            // edge.
+            auto const& opposite = TetrahedronKey<true>::GetOppositeFace();
+            std::vector<std::array<std::size_t, 3>> hull{};
+            for (auto const& tetra : mTetrahedra)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    if (tetra.S[j] == invalid32)
+                    {
+                        hull.push_back({ tetra.V[opposite[j][0]],
+                            tetra.V[opposite[j][1]], tetra.V[opposite[j][2]] });
+                    }
                 }
             }
+
+            std::unordered_map<EdgeKey<false>, std::array<std::size_t, 2>,
+                EdgeKey<false>, EdgeKey<false>> edges{};
+            for (std::size_t f = 0; f < hull.size(); ++f)
+            {
+                for (std::size_t i0 = 2, i1 = 0; i1 < 3; i0 = i1++)
+                {
+                    auto result = edges.insert(std::make_pair(
+                        EdgeKey<false>(hull[f][i0], hull[f][i1]),
+                        std::array<std::size_t, 2>{ f, invalid }));
+                    if (!result.second)
+                    {
+                        auto& shared = result.first->second;
+                        if (shared[1] != invalid)
+                        {
+                            return false;
+                        }
+                        shared[1] = f;
+                    }
+                }
+            }
+
+            // Each boundary edge must be shared by two boundary faces, the
+            // surface must be locally convex at each edge and the surface
+            // must be connected.
+            std::vector<std::uint8_t> visited(hull.size(), 0);
+            std::vector<std::size_t> faceStack{};
+            std::size_t numVisited = 0;
+            if (hull.size() > 0)
+            {
+                visited[0] = 1;
+                faceStack.push_back(0);
+                numVisited = 1;
+            }
+            while (faceStack.size() > 0)
+            {
+                std::size_t const f = faceStack.back();
+                faceStack.pop_back();
+                auto const& face = hull[f];
+                for (std::size_t i0 = 2, i1 = 0; i1 < 3; i0 = i1++)
+                {
+                    auto const& shared = edges.find(EdgeKey<false>(face[i0], face[i1]))->second;
+                    if (shared[1] == invalid)
+                    {
+                        return false;
+                    }
+
+                    std::size_t const g = (shared[0] == f ? shared[1] : shared[0]);
+                    auto const& adjFace = hull[g];
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        std::size_t const w = adjFace[k];
+                        if (w != face[i0] && w != face[i1])
+                        {
+                            if (ToPlane(w, face[0], face[1], face[2]) > 0)
+                            {
+                                return false;
+                            }
+                            break;
+                        }
+                    }
+
+                    if (visited[g] == 0)
+                    {
+                        visited[g] = 1;
+                        faceStack.push_back(g);
+                        ++numVisited;
+                    }
+                }
+            }
+            return hull.size() > 0 && numVisited == hull.size();
         }
 
         // If a vertex occurs multiple times in the 'points' input to the
@@ -1321,5 +2366,38 @@ namespace gtl
         // the exact signs in ToPlane(...) and ToCircumsphere(...).
         static std::size_t constexpr maxNumCRPool = 98;
         mutable std::vector<ComputeRational> mCRPool;
+
+        // Statistics about the stages of the sign predicates.
+        mutable PredicateStatistics mStatistics;
+
+        // The flag is set when a ToCircumsphere query has sign 0, which
+        // means the input has 5 or more cospherical points.
+        mutable bool mHasCosphericalPoints;
+        PartitionStatus mPartitionStatus;
+
+        // The tetrahedralization is constructed in mTetrahedra, which uses
+        // 32 bytes per tetrahedron. The slots of the tetrahedra deleted by
+        // an insertion form a free list that starts at mFreeTetrahedra and
+        // are reused by the insertion, so the array does not grow by more
+        // than the net number of new tetrahedra. UpdateIndicesAdjacencies
+        // copies the array to mIndices and mAdjacencies and releases it.
+        std::vector<CompactTetrahedron> mTetrahedra;
+        std::uint32_t mFreeTetrahedra;
+
+        // The most recently created tetrahedron, which is where the search
+        // for the tetrahedron containing the next point starts.
+        std::uint32_t mLastTetra;
+
+        // Storage for Update, which is reused by the insertions. mCavity
+        // stores the indices and copies of the deleted tetrahedra. mHullFaces
+        // stores <tetrahedron,face> for the hull faces visible to the point.
+        // mNewFaces stores the faces of the new tetrahedra that contain the
+        // point, each with the code of its edge opposite the point and the
+        // code 4*tetrahedron+face.
+        std::vector<std::pair<std::uint32_t, CompactTetrahedron>> mCavity;
+        std::vector<CavityFace> mCavityFaces;
+        std::vector<CavityFace> mVisibleFaces;
+        std::vector<std::pair<std::uint32_t, std::size_t>> mHullFaces;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> mNewFaces;
     };
 }
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -42,11 +42,18 @@
 // inputs. The member functions with T-valued and Rational-valued arguments
 // are intended for applications where the Rational inputs are cached and
 // re-used to avoid re-converting floating-point numbers to rational numbers.
+//
+// The sign is determined by the first successful stage of a floating-point
+// filter, interval arithmetic and rational arithmetic. See PredicateFilter.h
+// for a description of the filter. GetStatistics() reports how many queries
+// were resolved by each stage.
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
+#include <GTL/Mathematics/Arithmetic/PredicateFilter.h>
 #include <GTL/Mathematics/Arithmetic/SWInterval.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -67,7 +74,8 @@ namespace gtl
             mISign(invalidSign),
             mRSign(invalidSign),
             mIDet{},
-            mNode(numNodes)
+            mNode(numNodes),
+            mStatistics{}
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -80,17 +88,28 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1, V2, V3);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of P
             // if possible.
             ComputeInterval(P, V0, V1, V2, V3);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
             // The exact relative location of P is not known. Compute the
             // relative location using rational arithmetic.
             ComputeRational(P, V0, V1, V2, V3);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
@@ -101,11 +120,21 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1, V2, V3);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of P
             // if possible.
             ComputeInterval(P, V0, V1, V2, V3);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
@@ -118,9 +147,94 @@ namespace gtl
             auto const& rV2 = *rPoints[3];
             auto const& rV3 = *rPoints[4];
             ComputeRational(rP, rV0, rV1, rV2, rV3);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
+        // Evaluate the determinant in double precision and compare it to a
+        // static error bound. The return value is +1 or -1 when the sign of
+        // the determinant is certain and 0 when it is not. See
+        // PredicateFilter.h for the error analysis.
+        static std::int32_t Filter(Vector3<T> const& P, Vector3<T> const& V0, Vector3<T> const& V1,
+            Vector3<T> const& V2, Vector3<T> const& V3)
+        {
+            // The lifted coordinates |V[i]-P|^2 are used instead of
+            // |V[i]|^2-|P|^2. The two determinants are equal because the
+            // lifted columns differ by a linear combination of the other
+            // columns.
+            bool safe = true;
+            double const x0 = PredicateFilter::Sub(V0[0], P[0], safe);
+            double const y0 = PredicateFilter::Sub(V0[1], P[1], safe);
+            double const z0 = PredicateFilter::Sub(V0[2], P[2], safe);
+            double const x1 = PredicateFilter::Sub(V1[0], P[0], safe);
+            double const y1 = PredicateFilter::Sub(V1[1], P[1], safe);
+            double const z1 = PredicateFilter::Sub(V1[2], P[2], safe);
+            double const x2 = PredicateFilter::Sub(V2[0], P[0], safe);
+            double const y2 = PredicateFilter::Sub(V2[1], P[1], safe);
+            double const z2 = PredicateFilter::Sub(V2[2], P[2], safe);
+            double const x3 = PredicateFilter::Sub(V3[0], P[0], safe);
+            double const y3 = PredicateFilter::Sub(V3[1], P[1], safe);
+            double const z3 = PredicateFilter::Sub(V3[2], P[2], safe);
+            if (!safe)
+            {
+                return 0;
+            }
+
+            double const w0 = (x0 * x0 + y0 * y0) + z0 * z0;
+            double const w1 = (x1 * x1 + y1 * y1) + z1 * z1;
+            double const w2 = (x2 * x2 + y2 * y2) + z2 * z2;
+            double const w3 = (x3 * x3 + y3 * y3) + z3 * z3;
+            double const x0y1 = x0 * y1, x1y0 = x1 * y0;
+            double const x0y2 = x0 * y2, x2y0 = x2 * y0;
+            double const x0y3 = x0 * y3, x3y0 = x3 * y0;
+            double const x1y2 = x1 * y2, x2y1 = x2 * y1;
+            double const x1y3 = x1 * y3, x3y1 = x3 * y1;
+            double const x2y3 = x2 * y3, x3y2 = x3 * y2;
+            double const z0w1 = z0 * w1, z1w0 = z1 * w0;
+            double const z0w2 = z0 * w2, z2w0 = z2 * w0;
+            double const z0w3 = z0 * w3, z3w0 = z3 * w0;
+            double const z1w2 = z1 * w2, z2w1 = z2 * w1;
+            double const z1w3 = z1 * w3, z3w1 = z3 * w1;
+            double const z2w3 = z2 * w3, z3w2 = z3 * w2;
+            double const u0 = x0y1 - x1y0, v0 = z0w1 - z1w0;
+            double const u1 = x0y2 - x2y0, v1 = z0w2 - z2w0;
+            double const u2 = x0y3 - x3y0, v2 = z0w3 - z3w0;
+            double const u3 = x1y2 - x2y1, v3 = z1w2 - z2w1;
+            double const u4 = x1y3 - x3y1, v4 = z1w3 - z3w1;
+            double const u5 = x2y3 - x3y2, v5 = z2w3 - z3w2;
+            double const det = ((u0 * v5 + u5 * v0) + (u2 * v3 + u3 * v2)) - (u1 * v4 + u4 * v1);
+
+            double const pu0 = std::fabs(x0y1) + std::fabs(x1y0);
+            double const pu1 = std::fabs(x0y2) + std::fabs(x2y0);
+            double const pu2 = std::fabs(x0y3) + std::fabs(x3y0);
+            double const pu3 = std::fabs(x1y2) + std::fabs(x2y1);
+            double const pu4 = std::fabs(x1y3) + std::fabs(x3y1);
+            double const pu5 = std::fabs(x2y3) + std::fabs(x3y2);
+            double const pv0 = std::fabs(z0w1) + std::fabs(z1w0);
+            double const pv1 = std::fabs(z0w2) + std::fabs(z2w0);
+            double const pv2 = std::fabs(z0w3) + std::fabs(z3w0);
+            double const pv3 = std::fabs(z1w2) + std::fabs(z2w1);
+            double const pv4 = std::fabs(z1w3) + std::fabs(z3w1);
+            double const pv5 = std::fabs(z2w3) + std::fabs(z3w2);
+            double const permanent = ((pu0 * pv5 + pu5 * pv0) + (pu2 * pv3 + pu3 * pv2)) +
+                (pu1 * pv4 + pu4 * pv1);
+
+            // The maximum path length of the expression tree is 16.
+            return PredicateFilter::GetSign(det, 17.0 * PredicateFilter::unitRoundoff, permanent);
+        }
+
+        // The number of queries whose sign was determined by the floating-
+        // point filter, by interval arithmetic and by rational arithmetic.
+        inline PredicateStatistics const& GetStatistics() const
+        {
+            return mStatistics;
+        }
+
+        inline void ResetStatistics()
+        {
+            mStatistics = PredicateStatistics{};
+        }
+
     private:
         void ComputeInterval(Vector3<T> const& P, Vector3<T> const& V0,
             Vector3<T> const& V1, Vector3<T> const& V2, Vector3<T> const& V3)
@@ -421,6 +535,7 @@ namespace gtl
         std::int32_t mRSign;
         SWInterval<T> mIDet;
         std::vector<CRational> mNode;
+        PredicateStatistics mStatistics;
 
     private:
         friend class UnitTestExactToCircumsphere3;
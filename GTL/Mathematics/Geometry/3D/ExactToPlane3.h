@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -42,11 +42,18 @@
 // inputs. The member functions with T-valued and Rational-valued arguments
 // are intended for applications where the Rational inputs are cached and
 // re-used to avoid re-converting floating-point numbers to rational numbers.
+//
+// The sign is determined by the first successful stage of a floating-point
+// filter, interval arithmetic and rational arithmetic. See PredicateFilter.h
+// for a description of the filter. GetStatistics() reports how many queries
+// were resolved by each stage.
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
+#include <GTL/Mathematics/Arithmetic/PredicateFilter.h>
 #include <GTL/Mathematics/Arithmetic/SWInterval.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -67,7 +74,8 @@ namespace gtl
             mISign(invalidSign),
             mRSign(invalidSign),
             mIDet{},
-            mNode(numNodes)
+            mNode(numNodes),
+            mStatistics{}
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -80,17 +88,28 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1, V2);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of
             // P, if possible.
             ComputeInterval(P, V0, V1, V2);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
             // The exact relative location of P is not known. Compute the
             // relative location using rational arithmetic.
             ComputeRational(P, V0, V1, V2);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
@@ -101,11 +120,21 @@ namespace gtl
             mISign = invalidSign;
             mRSign = invalidSign;
 
+            // Use a floating-point filter to determine the relative location
+            // of P if possible.
+            std::int32_t const fSign = Filter(P, V0, V1, V2);
+            if (fSign != 0)
+            {
+                ++mStatistics.numFilter;
+                return fSign;
+            }
+
             // Use interval arithmetic to determine the relative location of
             // P, if possible.
             ComputeInterval(P, V0, V1, V2);
             if (mISign != invalidSign)
             {
+                ++mStatistics.numInterval;
                 return mISign;
             }
 
@@ -117,9 +146,63 @@ namespace gtl
             auto const& rV1 = *rPoints[2];
             auto const& rV2 = *rPoints[3];
             ComputeRational(rP, rV0, rV1, rV2);
+            ++mStatistics.numRational;
             return mRSign;
         }
 
+        // Evaluate the determinant in double precision and compare it to a
+        // static error bound. The return value is +1 or -1 when the sign of
+        // the determinant is certain and 0 when it is not. See
+        // PredicateFilter.h for the error analysis.
+        static std::int32_t Filter(Vector3<T> const& P, Vector3<T> const& V0, Vector3<T> const& V1,
+            Vector3<T> const& V2)
+        {
+            bool safe = true;
+            double const x0 = PredicateFilter::Sub(P[0], V0[0], safe);
+            double const y0 = PredicateFilter::Sub(P[1], V0[1], safe);
+            double const z0 = PredicateFilter::Sub(P[2], V0[2], safe);
+            double const x1 = PredicateFilter::Sub(V1[0], V0[0], safe);
+            double const y1 = PredicateFilter::Sub(V1[1], V0[1], safe);
+            double const z1 = PredicateFilter::Sub(V1[2], V0[2], safe);
+            double const x2 = PredicateFilter::Sub(V2[0], V0[0], safe);
+            double const y2 = PredicateFilter::Sub(V2[1], V0[1], safe);
+            double const z2 = PredicateFilter::Sub(V2[2], V0[2], safe);
+            if (!safe)
+            {
+                return 0;
+            }
+
+            double const y0z1 = y0 * z1;
+            double const y0z2 = y0 * z2;
+            double const y1z0 = y1 * z0;
+            double const y1z2 = y1 * z2;
+            double const y2z0 = y2 * z0;
+            double const y2z1 = y2 * z1;
+            double const c0 = y1z2 - y2z1;
+            double const c1 = y2z0 - y0z2;
+            double const c2 = y0z1 - y1z0;
+            double const det = (x0 * c0 + x1 * c1) + x2 * c2;
+            double const permanent =
+                (std::fabs(x0) * (std::fabs(y1z2) + std::fabs(y2z1)) +
+                std::fabs(x1) * (std::fabs(y2z0) + std::fabs(y0z2))) +
+                std::fabs(x2) * (std::fabs(y0z1) + std::fabs(y1z0));
+
+            // The maximum path length of the expression tree is 8.
+            return PredicateFilter::GetSign(det, 9.0 * PredicateFilter::unitRoundoff, permanent);
+        }
+
+        // The number of queries whose sign was determined by the floating-
+        // point filter, by interval arithmetic and by rational arithmetic.
+        inline PredicateStatistics const& GetStatistics() const
+        {
+            return mStatistics;
+        }
+
+        inline void ResetStatistics()
+        {
+            mStatistics = PredicateStatistics{};
+        }
+
     private:
         void ComputeInterval(Vector3<T> const& P, Vector3<T> const& V0,
             Vector3<T> const& V1, Vector3<T> const& V2)
@@ -266,6 +349,7 @@ namespace gtl
         std::int32_t mRSign;
         SWInterval<T> mIDet;
         std::vector<CRational> mNode;
+        PredicateStatistics mStatistics;
 
     private:
         friend class UnitTestExactToPlane3;
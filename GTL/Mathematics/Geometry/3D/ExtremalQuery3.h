@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.17
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -11,6 +11,9 @@
 // ExtremalQuery3PRJ.
 
 #include <GTL/Mathematics/Primitives/3D/ConvexPolyhedron3.h>
+#include <GTL/Mathematics/Arithmetic/IEEEFunctions.h>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <vector>
 
@@ -55,15 +58,64 @@ namespace gtl
             mFaceNormals.resize(numTriangles);
             for (std::size_t t = 0; t < numTriangles; ++t)
             {
-                Vector3<T> v0 = mPolytope.vertices[mPolytope.indices[3 * t + 0]];
-                Vector3<T> v1 = mPolytope.vertices[mPolytope.indices[3 * t + 1]];
-                Vector3<T> v2 = mPolytope.vertices[mPolytope.indices[3 * t + 2]];
-                Vector3<T> edge1 = v1 - v0;
-                Vector3<T> edge2 = v2 - v0;
-                mFaceNormals[t] = UnitCross(edge1, edge2);
+                Vector3<T> const& v0 = mPolytope.vertices[mPolytope.indices[3 * t + 0]];
+                Vector3<T> const& v1 = mPolytope.vertices[mPolytope.indices[3 * t + 1]];
+                Vector3<T> const& v2 = mPolytope.vertices[mPolytope.indices[3 * t + 2]];
+                mFaceNormals[t] = GetNormal(v0, v1, v2);
             }
         }
 
+        // The convex hull of points that are nearly coplanar, for example
+        // rotated grid points, has sliver triangles whose vertices are
+        // nearly collinear. The rounding errors in the edges V1-V0 and V2-V0
+        // are then comparable to the triangle height, and UnitCross of the
+        // edges can have any direction. The normal is computed instead as
+        // Cross(V0,V1) + Cross(V1,V2) + Cross(V2,V0). Each product of
+        // components is split into its rounded value and its rounding error
+        // using FMA, and the 12 terms of a component are accumulated with
+        // compensated summation.
+        static Vector3<T> GetNormal(Vector3<T> const& v0, Vector3<T> const& v1,
+            Vector3<T> const& v2)
+        {
+            std::array<Vector3<T> const*, 3> const v = { &v0, &v1, &v2 };
+            Vector3<T> normal{};
+            for (std::size_t i0 = 0; i0 < 3; ++i0)
+            {
+                std::size_t const i1 = (i0 + 1) % 3;
+                std::size_t const i2 = (i0 + 2) % 3;
+                T sum = C_<T>(0), compensation = C_<T>(0);
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    Vector3<T> const& a = *v[j];
+                    Vector3<T> const& b = *v[(j + 1) % 3];
+                    T const p0 = a[i1] * b[i2];
+                    T const p1 = -(a[i2] * b[i1]);
+                    std::array<T, 4> const terms =
+                    {
+                        p0, FMA(a[i1], b[i2], -p0),
+                        p1, -FMA(a[i2], b[i1], p1)
+                    };
+
+                    for (auto const& term : terms)
+                    {
+                        T const next = sum + term;
+                        if (std::fabs(sum) >= std::fabs(term))
+                        {
+                            compensation += (sum - next) + term;
+                        }
+                        else
+                        {
+                            compensation += (term - next) + sum;
+                        }
+                        sum = next;
+                    }
+                }
+                normal[i0] = sum + compensation;
+            }
+            Normalize(normal);
+            return normal;
+        }
+
         ConvexPolyhedron3<T> const& mPolytope;
         std::vector<Vector3<T>> mFaceNormals;
 
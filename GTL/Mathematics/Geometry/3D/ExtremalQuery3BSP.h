@@ -3,26 +3,54 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.17
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Compute the extreme vertices of a convex polyhedron in a specified
 // direction using Binary Space Partitioning (BSP) trees. For details, see
 //   https://www.geometrictools.com/Documentation/ExtremalPolytopeQueries.pdf
+//
+// The BSP tree is built once and then stored as a contiguous array of
+// compact nodes in depth-first order. A node stores the arc normal and two
+// 32-bit child indices. A child whose leaf bit is set stores the index of
+// a vertex instead of a node index, so the descent computes one dot product
+// per level. The queries are const and may be called concurrently.
+//
+// The faces of the polyhedron are grouped from the triangle normals with a
+// floating-point tolerance, so for nearly coplanar sliver triangles the
+// vertex at the leaf need not be extreme. Every query therefore finishes
+// with a climb along the polyhedron edges from that vertex to a vertex
+// whose neighbors do not increase the dot product. The polyhedron is
+// convex, so such a vertex is extreme. When the leaf vertex is extreme,
+// which is the typical case, the climb costs one dot product per neighbor.
+//
+// When consecutive directions are nearby, which is the case for the
+// support mappings of GJK-style distance and collision queries, the
+// previous extreme vertex is a good starting point. The GetExtremeVertex
+// overload with a start vertex climbs along the polyhedron edges from that
+// vertex, which visits few vertices for coherent directions and falls back
+// to the BSP tree when the direction has changed substantially.
+//
+// The BSP tree is built using the Real type, which is double when T is
+// float. The arcs, their split points and the side tests are then computed
+// accurately enough for the tree to be consistent, and only the node
+// normals are rounded to T for the queries.
 
 #include <GTL/Mathematics/Geometry/3D/ExtremalQuery3.h>
 #include <GTL/Mathematics/Arithmetic/IEEEFunctions.h>
-#include <GTL/Mathematics/Meshes/DynamicVETManifoldMesh.h>
-#include <GTL/Utility/RangeIteration.h>
+#include <GTL/Mathematics/Meshes/StaticVETManifoldMesh.h>
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
-#include <map>
-#include <set>
-#include <stack>
 #include <queue>
-#include <unordered_set>
+#include <stack>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -35,31 +63,43 @@ namespace gtl
         ExtremalQuery3BSP(ConvexPolyhedron3<T> const& polytope)
             :
             ExtremalQuery3<T>(polytope),
-            mTriToNormal{},
             mNodes{},
-            mTreeDepth(0)
+            mTreeDepth(0),
+            mAdjacentOffsets{},
+            mAdjacentVertices{},
+            mNormals{},
+            mFaces{}
         {
-            // Create the adjacency information for the polytope.
-            DynamicVETManifoldMesh mesh{};
+            std::size_t const numVertices = this->mPolytope.vertices.size();
             std::size_t const numTriangles = this->mPolytope.indices.size() / 3;
+            GTL_LENGTH_ASSERT(
+                numVertices < static_cast<std::size_t>(leafBit),
+                "The number of vertices exceeds the range of the node indices.");
+
+            // Create the adjacency information for the polytope. The
+            // triangle indices are the indices into mFaceNormals.
+            std::vector<std::array<std::size_t, 3>> triangles(numTriangles);
             for (std::size_t t = 0; t < numTriangles; ++t)
             {
-                std::array<std::size_t, 3> V = { 0, 0, 0 };
                 for (std::size_t j = 0; j < 3; ++j)
                 {
-                    V[j] = this->mPolytope.indices[3 * t + j];
+                    triangles[t][j] = this->mPolytope.indices[3 * t + j];
                 }
-                auto* triangle = mesh.Insert(V[0], V[1], V[2]);
-                mTriToNormal.insert(std::make_pair(triangle, t));
             }
+            StaticVETManifoldMesh mesh(numVertices, triangles, 1);
+
+            // Group the triangles into the planar faces of the polyhedron.
+            CreateFaces(mesh);
 
             // Create the set of unique arcs which are used to create the BSP
             // tree.
-            std::multiset<SphericalArc> arcs{};
+            std::vector<SphericalArc> arcs{};
             CreateSphericalArcs(mesh, arcs);
 
             // Create the BSP tree to be used in the extremal query.
             CreateBSPTree(arcs);
+            std::vector<Vector3<Real>>().swap(mNormals);
+            std::vector<std::size_t>().swap(mFaces);
         }
 
         // Disallow copying and assignment.
@@ -71,63 +111,114 @@ namespace gtl
         virtual void GetExtremeVertices(Vector3<T> const& direction,
             std::size_t& positiveDirection, std::size_t& negativeDirection) override
         {
-            // Do a nonrecursive depth-first search of the BSP tree to
-            // determine spherical polygon contains the incoming direction D.
-            // Index 0 is the root of the BSP tree.
-            std::size_t current = 0;
-            while (current != SphericalArc::invalid)
+            positiveDirection = Climb(direction, Descend(direction, 0));
+            negativeDirection = Climb(-direction, Descend(direction, 1));
+        }
+
+        // Get the index of a vertex V that maximizes Dot(direction,V). The
+        // BSP tree determines the spherical polygon that contains the
+        // direction, and the climb from its vertex finishes the query.
+        inline std::size_t GetExtremeVertex(Vector3<T> const& direction) const
+        {
+            return Climb(direction, Descend(direction, 0));
+        }
+
+        // Get the index of a vertex V that maximizes Dot(direction,V) by a
+        // search that starts at the specified vertex, typically the result
+        // of the previous query for the same polyhedron. The search moves
+        // along polyhedron edges to the neighbor with the largest dot
+        // product until no neighbor improves it, which finds a maximum
+        // because the polyhedron is convex. If the search has not finished
+        // after computing as many dot products as the depth of the BSP tree,
+        // the query is completed by GetExtremeVertex(direction). When
+        // several vertices attain the maximum, the returned vertex can
+        // differ from that returned by the BSP tree.
+        std::size_t GetExtremeVertex(Vector3<T> const& direction, std::size_t start) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                start + 1 < mAdjacentOffsets.size() &&
+                mAdjacentOffsets[start] < mAdjacentOffsets[start + 1],
+                "The start must be a vertex of a polyhedron triangle.");
+
+            std::vector<Vector3<T>> const& vertices = this->mPolytope.vertices;
+            std::uint32_t v = static_cast<std::uint32_t>(start);
+            T maxDot = Dot(direction, vertices[v]);
+            std::size_t budget = mTreeDepth;
+            for (;;)
             {
-                SphericalArc& node = mNodes[current];
-                std::int32_t sign = isign(Dot(direction, node.normal));
-                if (sign >= 0)
-                {
-                    current = node.posChild;
-                    if (current == SphericalArc::invalid)
-                    {
-                        // At a leaf node.
-                        positiveDirection = node.posVertex;
-                    }
-                }
-                else
+                std::uint32_t best = v;
+                std::uint32_t const imax = mAdjacentOffsets[v + 1];
+                for (std::uint32_t i = mAdjacentOffsets[v]; i < imax; ++i)
                 {
-                    current = node.negChild;
-                    if (current == SphericalArc::invalid)
+                    std::uint32_t const neighbor = mAdjacentVertices[i];
+                    T const dot = Dot(direction, vertices[neighbor]);
+                    if (dot > maxDot)
                     {
-                        // At a leaf node.
-                        positiveDirection = node.negVertex;
+                        maxDot = dot;
+                        best = neighbor;
                     }
                 }
-            }
 
-            // Do a nonrecursive depth-first search of the BSP tree to
-            // determine spherical polygon contains the reverse incoming
-            // direction -D.
-            current = 0;  // the root of the BSP tree
-            while (current != SphericalArc::invalid)
-            {
-                SphericalArc& node = mNodes[current];
-                std::int32_t sign = isign(Dot(direction, node.normal));
-                if (sign <= 0)
+                if (best == v)
                 {
-                    current = node.posChild;
-                    if (current == SphericalArc::invalid)
-                    {
-                        // At a leaf node.
-                        negativeDirection = node.posVertex;
-                    }
+                    return v;
                 }
-                else
+
+                std::size_t const cost = static_cast<std::size_t>(imax - mAdjacentOffsets[v]);
+                if (cost >= budget)
                 {
-                    current = node.negChild;
-                    if (current == SphericalArc::invalid)
-                    {
-                        // At a leaf node.
-                        negativeDirection = node.negVertex;
-                    }
+                    return GetExtremeVertex(direction);
                 }
+                budget -= cost;
+                v = best;
             }
         }
 
+        // Compute the extreme vertices for a batch of directions. The
+        // negativeDirections pointer may be null when only the vertices
+        // that maximize Dot(direction,V) are needed. The directions are
+        // partitioned into numThreads contiguous subsets. When pool is not
+        // null, the subsets are processed by the pool; otherwise, a
+        // std::thread is launched for each subset.
+        void GetExtremeVertices(std::size_t numDirections, Vector3<T> const* directions,
+            std::size_t* positiveDirections, std::size_t* negativeDirections,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                numDirections == 0 || (directions != nullptr && positiveDirections != nullptr),
+                "Invalid argument.");
+
+            if (numThreads <= 1 || numDirections < numThreads)
+            {
+                GetExtremeVerticesSubset(0, numDirections, directions,
+                    positiveDirections, negativeDirections);
+                return;
+            }
+
+            std::size_t const load = numDirections / numThreads;
+            ForkJoin(pool, numThreads,
+                [this, numDirections, numThreads, load, directions,
+                positiveDirections, negativeDirections](std::size_t t)
+                {
+                    std::size_t const imin = t * load;
+                    std::size_t const isup = (t + 1 < numThreads ? imin + load : numDirections);
+                    GetExtremeVerticesSubset(imin, isup, directions,
+                        positiveDirections, negativeDirections);
+                });
+        }
+
+        void GetExtremeVertices(std::vector<Vector3<T>> const& directions,
+            std::vector<std::size_t>& positiveDirections,
+            std::vector<std::size_t>& negativeDirections,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr) const
+        {
+            positiveDirections.resize(directions.size());
+            negativeDirections.resize(directions.size());
+            GetExtremeVertices(directions.size(), directions.data(),
+                positiveDirections.data(), negativeDirections.data(),
+                numThreads, pool);
+        }
+
         // Tree statistics.
         inline std::size_t GetNumNodes() const
         {
@@ -140,6 +231,28 @@ namespace gtl
         }
 
     private:
+        using Real = typename std::conditional<(sizeof(T) < sizeof(double)), double, T>::type;
+
+        static Vector3<Real> ToReal(Vector3<T> const& v)
+        {
+            return Vector3<Real>{ static_cast<Real>(v[0]), static_cast<Real>(v[1]),
+                static_cast<Real>(v[2]) };
+        }
+
+        // A child index with this bit set refers to a leaf, and the other
+        // bits are the index of the extreme vertex for the region.
+        static std::uint32_t constexpr leafBit = 0x80000000u;
+
+        // The node of the BSP tree that is used in the queries. The child[0]
+        // subtree is selected when Dot(D,normal) >= 0 for the query
+        // direction D and the child[1] subtree is selected otherwise.
+        struct Node
+        {
+            Vector3<T> normal;
+            std::array<std::uint32_t, 2> child;
+        };
+
+        // The arc used during construction of the BSP tree.
         class SphericalArc
         {
         public:
@@ -151,6 +264,8 @@ namespace gtl
                 nIndex{ invalid, invalid },
                 separation(0),
                 normal{},
+                eIndex{ invalid, invalid },
+                endpoint{},
                 posVertex(invalid),
                 negVertex(invalid),
                 posChild(invalid),
@@ -158,16 +273,6 @@ namespace gtl
             {
             }
 
-            // The arcs are stored in a multiset ordered by increasing
-            // separation. The multiset will be traversed in reverse order.
-            // This heuristic is designed to create BSP trees whose top-most
-            // nodes can eliminate as many arcs as possible during an extremal
-            // query.
-            bool operator<(SphericalArc const& arc) const
-            {
-                return separation < arc.separation;
-            }
-
             // Indices N[] into the face normal array for the endpoints of the
             // arc.
             std::array<std::size_t, 2> nIndex;
@@ -177,8 +282,18 @@ namespace gtl
             // or larger for bisector arcs of the spherical polygon.
             std::size_t separation;
 
-            // The normal is Cross(FaceNormal[N[0]],FaceNormal[N[1]]).
-            Vector3<T> normal;
+            // The normal is Cross(FaceNormal[N[0]],FaceNormal[N[1]]) scaled
+            // to unit length.
+            Vector3<Real> normal;
+
+            // An arc that straddles the great circle of a BSP node is split
+            // at the circle, and each piece is propagated to the child on
+            // its side. The pieces have the N[], separation and normal of
+            // the arc. The endpoints of a piece are either face normals, in
+            // which case eIndex[] stores their indices, or points on the
+            // great circles of BSP nodes, in which case eIndex[] is invalid.
+            std::array<std::size_t, 2> eIndex;
+            std::array<Vector3<Real>, 2> endpoint;
 
             // Indices into the vertex array for the extremal points for the
             // two regions sharing the arc. As the arc is traversed from
@@ -191,126 +306,387 @@ namespace gtl
             std::size_t posChild, negChild;
         };
 
-        typedef DynamicVETManifoldMesh::Triangle Triangle;
-
-        void SortAdjacentTriangles(std::size_t vIndex,
-            std::unordered_set<Triangle*> const& tAdj,
-            std::vector<Triangle*>& tAdjSorted)
+        // Do a nonrecursive depth-first search of the BSP tree to determine
+        // the spherical polygon that contains the direction D (select 0) or
+        // the reverse direction -D (select 1). Index 0 is the root of the
+        // BSP tree. A direction on an arc is assigned to the positive side
+        // of the arc.
+        inline std::size_t Descend(Vector3<T> const& direction, std::size_t select) const
         {
-            // Copy the set of adjacent triangles into a vector container.
-            std::size_t const numTriangles = tAdj.size();
-            tAdjSorted.resize(numTriangles);
+            std::uint32_t current = 0;
+            for (;;)
+            {
+                Node const& node = mNodes[current];
+                T const dot = Dot(direction, node.normal);
+                bool const negativeSide = (select == 0 ? dot < C_<T>(0) : dot > C_<T>(0));
+                current = node.child[negativeSide ? 1 : 0];
+                if ((current & leafBit) != 0)
+                {
+                    return static_cast<std::size_t>(current & ~leafBit);
+                }
+            }
+        }
 
-            // Traverse the triangles adjacent to vertex V using edge-triangle
-            // adjacency information to produce a sorted array of adjacent
-            // triangles.
-            Triangle* tri = *tAdj.begin();
-            for (std::size_t i = 0; i < numTriangles; ++i)
+        // Move along the polyhedron edges from vertex v to the neighbor
+        // with the largest dot product until no neighbor increases it.
+        std::size_t Climb(Vector3<T> const& direction, std::size_t v) const
+        {
+            std::vector<Vector3<T>> const& vertices = this->mPolytope.vertices;
+            T maxDot = Dot(direction, vertices[v]);
+            for (;;)
             {
-                for (std::size_t prev = 2, curr = 0; curr < 3; prev = curr++)
+                std::size_t best = v;
+                std::uint32_t const imax = mAdjacentOffsets[v + 1];
+                for (std::uint32_t i = mAdjacentOffsets[v]; i < imax; ++i)
                 {
-                    if (tri->V[curr] == vIndex)
+                    std::uint32_t const neighbor = mAdjacentVertices[i];
+                    T const dot = Dot(direction, vertices[neighbor]);
+                    if (dot > maxDot)
                     {
-                        tAdjSorted[i] = tri;
-                        tri = tri->T[prev];
-                        break;
+                        maxDot = dot;
+                        best = neighbor;
                     }
                 }
+
+                if (best == v)
+                {
+                    return v;
+                }
+                v = best;
             }
         }
 
-        void CreateSphericalArcs(DynamicVETManifoldMesh& mesh, std::multiset<SphericalArc>& arcs)
+        // Each descent is a chain of dependent loads and dot products, so
+        // the descents for numLanes directions are interleaved to allow the
+        // processor to overlap them. The climbs follow the descents.
+        void GetExtremeVerticesSubset(std::size_t imin, std::size_t isup,
+            Vector3<T> const* directions, std::size_t* positiveDirections,
+            std::size_t* negativeDirections) const
         {
-            std::size_t const prev[3] = { 2, 0, 1 };
-            std::size_t const next[3] = { 1, 2, 0 };
+            DescendInterleaved(imin, isup, directions, 0, positiveDirections);
+            if (negativeDirections != nullptr)
+            {
+                DescendInterleaved(imin, isup, directions, 1, negativeDirections);
+            }
+        }
 
-            for (auto const& element : mesh.GetEdges())
+        void DescendInterleaved(std::size_t imin, std::size_t isup,
+            Vector3<T> const* directions, std::size_t select, std::size_t* vertices) const
+        {
+            std::size_t constexpr numLanes = 8;
+            std::array<std::uint32_t, numLanes> current{};
+            for (std::size_t i = imin; i < isup; i += numLanes)
             {
-                auto const& edge = element.second;
+                std::size_t const numActive = std::min(numLanes, isup - i);
+                std::fill(current.begin(), current.end(), 0);
+                std::size_t numLeaves = 0;
+                while (numLeaves < numActive)
+                {
+                    for (std::size_t lane = 0; lane < numActive; ++lane)
+                    {
+                        if ((current[lane] & leafBit) == 0)
+                        {
+                            Node const& node = mNodes[current[lane]];
+                            T const dot = Dot(directions[i + lane], node.normal);
+                            bool const negativeSide = (select == 0 ? dot < C_<T>(0) : dot > C_<T>(0));
+                            current[lane] = node.child[negativeSide ? 1 : 0];
+                            if ((current[lane] & leafBit) != 0)
+                            {
+                                ++numLeaves;
+                            }
+                        }
+                    }
+                }
 
-                SphericalArc arc{};
+                for (std::size_t lane = 0; lane < numActive; ++lane)
+                {
+                    Vector3<T> const& direction = directions[i + lane];
+                    std::size_t const v = static_cast<std::size_t>(current[lane] & ~leafBit);
+                    vertices[i + lane] = Climb(select == 0 ? direction : -direction, v);
+                }
+            }
+        }
 
-                auto iter = mTriToNormal.find(edge->T[0]);
-                GTL_RUNTIME_ASSERT(
-                    iter != mTriToNormal.end(),
-                    "Unexpected condition.");
-                arc.nIndex[0] = iter->second;
+        // Get the triangles sharing vertex v, sorted counterclockwise when
+        // viewed from outside the polyhedron. Triangle tAdjSorted[i+1]
+        // shares the edge <V,v> with tAdjSorted[i], where V precedes v in
+        // tAdjSorted[i].
+        void SortAdjacentTriangles(StaticVETManifoldMesh const& mesh, std::size_t v,
+            std::vector<std::size_t>& tAdjSorted)
+        {
+            auto const& vertex = mesh.GetVertices()[v];
+            auto const& triangles = mesh.GetTriangles();
+            auto const& adjacents = mesh.GetAdjacents();
+            std::size_t const numTriangles = vertex.GetNumAdjacents();
+            tAdjSorted.resize(numTriangles);
+
+            std::size_t t = vertex.GetAdjacents()[0][2];
+            for (std::size_t i = 0; i < numTriangles; ++i)
+            {
+                auto const& tri = triangles[t];
+                std::size_t const j = (tri[0] == v ? 0 : (tri[1] == v ? 1 : 2));
+                tAdjSorted[i] = t;
 
-                iter = mTriToNormal.find(edge->T[1]);
+                // The triangle adjacent to edge <V[(j+2)%3],V[j]> is
+                // adjacents[t][(j+1)%3].
+                t = adjacents[t][(j + 1) % 3];
                 GTL_RUNTIME_ASSERT(
-                    iter != mTriToNormal.end(),
-                    "Unexpected condition.");
-                arc.nIndex[1] = iter->second;
+                    t != StaticVETManifoldMesh::invalid,
+                    "The polyhedron must be a closed manifold mesh.");
+            }
+        }
 
-                arc.separation = 1;
-                arc.normal = Cross(this->mFaceNormals[arc.nIndex[0]], this->mFaceNormals[arc.nIndex[1]]);
+        // The triangles of a planar face of the polyhedron have the same
+        // normal, up to rounding errors, and the BSP tree must treat them as
+        // one spherical point. The face normals are computed in the Real
+        // type, from the vertices when Real is more precise than T. The
+        // triangles are visited in the order of decreasing area, and each
+        // triangle not yet in a face starts a new face. The face grows over
+        // the adjacent triangles whose normals are within sqrt(epsilon) of
+        // that of the starting triangle, which then represents the face.
+        void CreateFaces(StaticVETManifoldMesh const& mesh)
+        {
+            std::vector<Vector3<T>> const& vertices = this->mPolytope.vertices;
+            auto const& triangles = mesh.GetTriangles();
+            auto const& adjacents = mesh.GetAdjacents();
+            std::size_t const numTriangles = triangles.size();
+            std::vector<Real> areas(numTriangles);
+            mNormals.resize(numTriangles);
+            for (std::size_t t = 0; t < numTriangles; ++t)
+            {
+                Vector3<Real> const v0 = ToReal(vertices[triangles[t][0]]);
+                Vector3<Real> const v1 = ToReal(vertices[triangles[t][1]]);
+                Vector3<Real> const v2 = ToReal(vertices[triangles[t][2]]);
+                Vector3<Real> cross = Cross(v1 - v0, v2 - v0);
+                areas[t] = Normalize(cross);
+                mNormals[t] = (sizeof(Real) > sizeof(T) ? cross : ToReal(this->mFaceNormals[t]));
+            }
+
+            std::vector<std::size_t> order(numTriangles);
+            for (std::size_t t = 0; t < numTriangles; ++t)
+            {
+                order[t] = t;
+            }
+            std::stable_sort(order.begin(), order.end(),
+                [&areas](std::size_t t0, std::size_t t1)
+                {
+                    return areas[t0] > areas[t1];
+                });
+
+            Real const tolerance = static_cast<Real>(std::sqrt(std::numeric_limits<T>::epsilon()));
+            std::size_t const invalid = SphericalArc::invalid;
+            mFaces.assign(numTriangles, invalid);
+            std::vector<std::size_t> stack{};
+            for (auto const& face : order)
+            {
+                if (mFaces[face] != invalid)
+                {
+                    continue;
+                }
 
-                Triangle* adj = edge->T[0];
-                std::size_t j{};
-                for (j = 0; j < 3; ++j)
+                Vector3<Real> const& normal = mNormals[face];
+                mFaces[face] = face;
+                stack.push_back(face);
+                while (!stack.empty())
                 {
-                    if (adj->V[j] != edge->V[0] && adj->V[j] != edge->V[1])
+                    std::size_t const t = stack.back();
+                    stack.pop_back();
+                    for (std::size_t j = 0; j < 3; ++j)
                     {
-                        arc.posVertex = adj->V[prev[j]];
-                        arc.negVertex = adj->V[next[j]];
-                        break;
+                        std::size_t const adj = adjacents[t][j];
+                        if (adj != StaticVETManifoldMesh::invalid &&
+                            mFaces[adj] == invalid &&
+                            Dot(normal, mNormals[adj]) > C_<Real>(0) &&
+                            Length(Cross(normal, mNormals[adj])) <= tolerance)
+                        {
+                            mFaces[adj] = face;
+                            stack.push_back(adj);
+                        }
                     }
                 }
-                GTL_RUNTIME_ASSERT(
-                    j < 3,
-                    "Unexpected condition.");
+            }
+        }
+
+        // Append the arc from the normal of the face containing triangle t0
+        // to the normal of the face containing triangle t1. An arc between
+        // triangles of the same face is a point, so it is not appended.
+        void AppendArc(std::size_t t0, std::size_t t1, std::size_t separation,
+            std::size_t posVertex, std::size_t negVertex, std::vector<SphericalArc>& arcs) const
+        {
+            std::size_t const n0 = mFaces[t0], n1 = mFaces[t1];
+            if (n0 == n1)
+            {
+                return;
+            }
+
+            SphericalArc arc{};
+            arc.nIndex = { n0, n1 };
+            arc.separation = separation;
+            arc.normal = UnitCross(mNormals[n0], mNormals[n1]);
+            arc.eIndex = { n0, n1 };
+            arc.endpoint = { mNormals[n0], mNormals[n1] };
+            arc.posVertex = posVertex;
+            arc.negVertex = negVertex;
+            arcs.push_back(arc);
+        }
 
-                arcs.insert(arc);
+        // The vertex at which an arc is created is not necessarily extreme
+        // for the directions near the arc. For example, a vertex in the
+        // interior of an edge of the polyhedron has no region of its own,
+        // and the hull of nearly coplanar points can have sliver triangles
+        // along the edge whose normals are between those of the faces
+        // sharing the edge. The extreme vertex on
+        // a side of an arc is therefore computed from the geometry. Let M
+        // be the midpoint of the arc and let N be its normal. The extreme
+        // vertices in direction M are those of a face of the polyhedron,
+        // and the extreme vertex for the directions M + e * N with small
+        // e > 0 is the one of these with largest Dot(N, V). It is found by
+        // a search over the vertex adjacencies that starts at vertex v and
+        // visits only vertices whose projections onto M are within the
+        // tolerance of that for v.
+        std::size_t GetArcVertex(std::size_t v, Vector3<Real> const& midpoint,
+            Vector3<Real> const& normal, Real const& tolerance) const
+        {
+            // The projections are of differences of vertices to avoid the
+            // rounding errors of projecting vertices far from the origin.
+            std::vector<Vector3<T>> const& vertices = this->mPolytope.vertices;
+            Vector3<Real> const start = ToReal(vertices[v]);
+            for (;;)
+            {
+                Vector3<Real> const current = ToReal(vertices[v]);
+                std::size_t next = v;
+                Real maxDot = C_<Real>(0);
+                for (std::uint32_t i = mAdjacentOffsets[v]; i < mAdjacentOffsets[v + 1]; ++i)
+                {
+                    std::size_t const w = mAdjacentVertices[i];
+                    Vector3<Real> const vertex = ToReal(vertices[w]);
+                    if (Dot(midpoint, vertex - start) >= -tolerance)
+                    {
+                        Real const dot = Dot(normal, vertex - current);
+                        if (dot > maxDot)
+                        {
+                            maxDot = dot;
+                            next = w;
+                        }
+                    }
+                }
+                if (next == v)
+                {
+                    return v;
+                }
+                v = next;
             }
+        }
+
+        void CreateSphericalArcs(StaticVETManifoldMesh const& mesh, std::vector<SphericalArc>& arcs)
+        {
+            auto const& triangles = mesh.GetTriangles();
+            auto const& adjacents = mesh.GetAdjacents();
 
             CreateSphericalBisectors(mesh, arcs);
+
+            // Each edge is shared by two triangles and is visited from the
+            // triangle with the smaller index. For triangle t, the edge
+            // <V[(j+1)%3],V[(j+2)%3]> is opposite V[j].
+            for (std::size_t t = 0; t < triangles.size(); ++t)
+            {
+                auto const& tri = triangles[t];
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    std::size_t const adj = adjacents[t][j];
+                    GTL_RUNTIME_ASSERT(
+                        adj != StaticVETManifoldMesh::invalid,
+                        "The polyhedron must be a closed manifold mesh.");
+
+                    if (t < adj)
+                    {
+                        std::size_t const v0 = tri[(j + 1) % 3];
+                        std::size_t const v1 = tri[(j + 2) % 3];
+                        AppendArc(t, adj, 1, v1, v0, arcs);
+                    }
+                }
+            }
+
+            // The arcs store the vertices at which to start the searches
+            // for their extreme vertices. The tolerance is relative to the
+            // size of the polyhedron.
+            std::vector<Vector3<T>> const& vertices = this->mPolytope.vertices;
+            Real scale = C_<Real>(0);
+            for (auto const& vertex : vertices)
+            {
+                scale = std::max(scale, Length(ToReal(vertex) - ToReal(vertices[0])));
+            }
+            Real const tolerance = static_cast<Real>(64 * std::numeric_limits<T>::epsilon()) * scale;
+            for (auto& arc : arcs)
+            {
+                Vector3<Real> midpoint = arc.endpoint[0] + arc.endpoint[1];
+                Normalize(midpoint);
+                arc.posVertex = GetArcVertex(arc.posVertex, midpoint, arc.normal, tolerance);
+                arc.negVertex = GetArcVertex(arc.negVertex, midpoint, -arc.normal, tolerance);
+            }
         }
 
-        void CreateSphericalBisectors(DynamicVETManifoldMesh& mesh, std::multiset<SphericalArc>& arcs)
+        void CreateSphericalBisectors(StaticVETManifoldMesh const& mesh,
+            std::vector<SphericalArc>& arcs)
         {
+            auto const& triangles = mesh.GetTriangles();
+            std::size_t const numVertices = mesh.GetVertices().size();
+            mAdjacentOffsets.resize(numVertices + 1);
+            mAdjacentVertices.resize(3 * triangles.size());
+            mAdjacentOffsets[0] = 0;
+
             std::queue<std::pair<std::size_t, std::size_t>> queue{};
-            for (auto const& element : mesh.GetVertices())
+            std::vector<std::size_t> tAdjSorted{}, polygon{};
+            for (std::size_t vIndex = 0; vIndex < numVertices; ++vIndex)
             {
+                std::uint32_t const offset = mAdjacentOffsets[vIndex];
+                std::size_t const numTriangles = mesh.GetVertices()[vIndex].GetNumAdjacents();
+                mAdjacentOffsets[vIndex + 1] = offset + static_cast<std::uint32_t>(numTriangles);
+                if (numTriangles == 0)
+                {
+                    continue;
+                }
+
                 // Sort the normals into a counterclockwise spherical polygon
-                // when viewed from outside the sphere.
-                auto const& vertex = element.second;
-                std::size_t const vIndex = vertex->V;
-                std::vector<Triangle*> tAdjSorted{};
-                SortAdjacentTriangles(vIndex, vertex->TAdjacent, tAdjSorted);
-                std::size_t const numTriangles = vertex->TAdjacent.size();
-                queue.push(std::make_pair(0, numTriangles));
+                // when viewed from outside the sphere. The vertex that
+                // follows vIndex in tAdjSorted[i] is stored in
+                // mAdjacentVertices[offset+i] for the searches that start
+                // at a vertex. It is the vertex shared by tAdjSorted[i-1]
+                // and tAdjSorted[i].
+                SortAdjacentTriangles(mesh, vIndex, tAdjSorted);
+                for (std::size_t i = 0; i < numTriangles; ++i)
+                {
+                    auto const& tri = triangles[tAdjSorted[i]];
+                    std::size_t const j = (tri[0] == vIndex ? 0 : (tri[1] == vIndex ? 1 : 2));
+                    mAdjacentVertices[offset + i] = static_cast<std::uint32_t>(tri[(j + 1) % 3]);
+                }
+
+                // The vertices of the spherical polygon are the distinct
+                // normals.
+                polygon.clear();
+                for (std::size_t i = 0; i < numTriangles; ++i)
+                {
+                    std::size_t const iPrev = (i > 0 ? i - 1 : numTriangles - 1);
+                    if (mFaces[tAdjSorted[iPrev]] != mFaces[tAdjSorted[i]])
+                    {
+                        polygon.push_back(tAdjSorted[i]);
+                    }
+                }
+
+                std::size_t const numNormals = polygon.size();
+                queue.push(std::make_pair(0, numNormals));
                 while (!queue.empty())
                 {
                     std::pair<std::size_t, std::size_t> item = queue.front();
                     queue.pop();
                     std::size_t i0 = item.first, i1 = item.second;
                     std::size_t separation = i1 - i0;
-                    if (separation > 1 && separation + 1 != numTriangles)
+                    if (separation > 1 && separation + 1 != numNormals)
                     {
-                        if (i1 < numTriangles)
+                        if (i1 < numNormals)
                         {
-                            SphericalArc arc{};
-
-                            auto iter = mTriToNormal.find(tAdjSorted[i0]);
-                            GTL_RUNTIME_ASSERT(
-                                iter != mTriToNormal.end(),
-                                "Unexpected condition.");
-                            arc.nIndex[0] = iter->second;
-
-                            iter = mTriToNormal.find(tAdjSorted[i1]);
-                            GTL_RUNTIME_ASSERT(
-                                iter != mTriToNormal.end(),
-                                "Unexpected condition.");
-                            arc.nIndex[1] = iter->second;
-
-                            arc.separation = separation;
-
-                            arc.normal = Cross(this->mFaceNormals[arc.nIndex[0]],
-                                this->mFaceNormals[arc.nIndex[1]]);
-
-                            arc.posVertex = vIndex;
-                            arc.negVertex = vIndex;
-                            arcs.insert(arc);
+                            AppendArc(polygon[i0], polygon[i1], separation,
+                                vIndex, vIndex, arcs);
                         }
                         std::size_t imid = (i0 + i1 + 1) / 2;
                         if (imid != i1)
@@ -323,140 +699,202 @@ namespace gtl
             }
         }
 
-        void CreateBSPTree(std::multiset<SphericalArc>& arcs)
+        void CreateBSPTree(std::vector<SphericalArc>& arcs)
         {
-            // The tree has at least a root.
-            mTreeDepth = 1;
+            // The arcs are inserted in order of decreasing separation. This
+            // heuristic is designed to create BSP trees whose top-most nodes
+            // can eliminate as many arcs as possible during an extremal
+            // query.
+            std::stable_sort(arcs.begin(), arcs.end(),
+                [](SphericalArc const& arc0, SphericalArc const& arc1)
+                {
+                    return arc0.separation > arc1.separation;
+                });
 
-            for (auto const& arc : gtl::reverse(arcs))
+            std::vector<SphericalArc> nodes{};
+            for (auto const& arc : arcs)
             {
-                InsertArc(arc);
+                InsertArc(arc, nodes);
             }
 
-            // The leaf nodes are not counted in the traversal of InsertArc.
-            // The depth must be incremented to account for leaves.
-            ++mTreeDepth;
+            CreateCompactNodes(nodes);
         }
 
-        void InsertArc(SphericalArc const& arc)
+        void InsertArc(SphericalArc const& arc, std::vector<SphericalArc>& nodes)
         {
             // The incoming arc is stored at the end of the nodes array.
-            if (mNodes.size() > 0)
+            if (nodes.size() > 0)
             {
                 // Do a nonrecursive depth-first search of the current BSP
                 // tree to place the incoming arc. Index 0 is the root of the
                 // BSP tree.
-                std::stack<std::size_t> candidates{};
-                candidates.push(0);
+                Real const tolerance = static_cast<Real>(64) * std::numeric_limits<Real>::epsilon();
+                std::stack<std::pair<std::size_t, SphericalArc>> candidates{};
+                candidates.push(std::make_pair(0, arc));
                 while (!candidates.empty())
                 {
-                    std::size_t current = candidates.top();
+                    std::size_t current = candidates.top().first;
+                    SphericalArc piece = candidates.top().second;
                     candidates.pop();
-                    SphericalArc* node = &mNodes[current];
-
-                    std::int32_t sign0{};
-                    if (arc.nIndex[0] == node->nIndex[0] || arc.nIndex[0] == node->nIndex[1])
-                    {
-                        sign0 = 0;
-                    }
-                    else
-                    {
-                        T dot = Dot(this->mFaceNormals[arc.nIndex[0]], node->normal);
-                        sign0 = isign(dot);
-                    }
-
-                    std::int32_t sign1{};
-                    if (arc.nIndex[1] == node->nIndex[0] || arc.nIndex[1] == node->nIndex[1])
+                    SphericalArc* node = &nodes[current];
+
+                    // An endpoint that is a face normal of the current arc
+                    // is on its great circle. The endpoints and the normal
+                    // are unit length, so the dot product is the sine of
+                    // the angle from the endpoint to the great circle.
+                    std::array<Real, 2> dot{};
+                    std::array<std::int32_t, 2> sign{};
+                    for (std::size_t k = 0; k < 2; ++k)
                     {
-                        sign1 = 0;
-                    }
-                    else
-                    {
-                        T dot = Dot(this->mFaceNormals[arc.nIndex[1]], node->normal);
-                        sign1 = isign(dot);
+                        if (piece.eIndex[k] == node->nIndex[0] || piece.eIndex[k] == node->nIndex[1])
+                        {
+                            dot[k] = C_<Real>(0);
+                            sign[k] = 0;
+                        }
+                        else
+                        {
+                            dot[k] = Dot(piece.endpoint[k], node->normal);
+                            sign[k] = (std::fabs(dot[k]) <= tolerance ? 0 : isign(dot[k]));
+                        }
                     }
 
-                    std::size_t doTest = 0;
-                    if (sign0 * sign1 < 0)
+                    if (sign[0] * sign[1] < 0)
                     {
-                        // The new arc straddles the current arc, so propagate
-                        // it to both child nodes.
-                        doTest = 3;
+                        // The new arc straddles the great circle of the
+                        // current arc. Split it at the circle and propagate
+                        // the pieces to the child nodes on their sides. The
+                        // split point is a positive combination of the
+                        // endpoints, so it is on the arc.
+                        Vector3<Real> split = dot[0] * piece.endpoint[1] - dot[1] * piece.endpoint[0];
+                        if (sign[0] < 0)
+                        {
+                            split = -split;
+                        }
+                        Normalize(split);
+
+                        std::size_t const kPos = (sign[0] > 0 ? 0 : 1);
+                        SphericalArc posPiece = piece;
+                        posPiece.eIndex[1 - kPos] = SphericalArc::invalid;
+                        posPiece.endpoint[1 - kPos] = split;
+                        SphericalArc negPiece = piece;
+                        negPiece.eIndex[kPos] = SphericalArc::invalid;
+                        negPiece.endpoint[kPos] = split;
+
+                        PropagateArc(current, 0, posPiece, nodes, candidates);
+                        PropagateArc(current, 1, negPiece, nodes, candidates);
                     }
-                    else if (sign0 > 0 || sign1 > 0)
+                    else if (sign[0] > 0 || sign[1] > 0)
                     {
                         // The new arc is on the positive side of the current
                         // arc.
-                        doTest = 1;
+                        PropagateArc(current, 0, piece, nodes, candidates);
                     }
-                    else if (sign0 < 0 || sign1 < 0)
+                    else if (sign[0] < 0 || sign[1] < 0)
                     {
                         // The new arc is on the negative side of the current
                         // arc.
-                        doTest = 2;
-                    }
-                    // else: sign0 = sign1 = 0, in which case no propagation
-                    // is needed because the current BSP node will handle the
-                    // correct partitioning of the arcs during extremal
-                    // queries.
-
-                    std::size_t depth{};
-
-                    if (doTest & 1)
-                    {
-                        if (node->posChild != SphericalArc::invalid)
-                        {
-                            candidates.push(node->posChild);
-                            depth = candidates.size();
-                            if (depth > mTreeDepth)
-                            {
-                                mTreeDepth = depth;
-                            }
-                        }
-                        else
-                        {
-                            node->posChild = mNodes.size();
-                            mNodes.push_back(arc);
-
-                            // The push_back can cause a reallocation, so the
-                            // current pointer must be refreshed.
-                            node = &mNodes[current];
-                        }
-                    }
-
-                    if (doTest & 2)
-                    {
-                        if (node->negChild != SphericalArc::invalid)
-                        {
-                            candidates.push(node->negChild);
-                            depth = candidates.size();
-                            if (depth > mTreeDepth)
-                            {
-                                mTreeDepth = depth;
-                            }
-                        }
-                        else
-                        {
-                            node->negChild = mNodes.size();
-                            mNodes.push_back(arc);
-                        }
+                        PropagateArc(current, 1, piece, nodes, candidates);
                     }
+                    // else: sign[0] = sign[1] = 0, in which case no
+                    // propagation is needed because the current BSP node
+                    // will handle the correct partitioning of the arcs
+                    // during extremal queries.
                 }
             }
             else
             {
                 // root node
-                mNodes.push_back(arc);
+                nodes.push_back(arc);
+            }
+        }
+
+        // Propagate the piece of an arc to the positive (side 0) or negative
+        // (side 1) child of the current node. If the child does not exist,
+        // the piece becomes that child.
+        void PropagateArc(std::size_t current, std::size_t side, SphericalArc const& piece,
+            std::vector<SphericalArc>& nodes,
+            std::stack<std::pair<std::size_t, SphericalArc>>& candidates)
+        {
+            std::size_t& child = (side == 0 ? nodes[current].posChild : nodes[current].negChild);
+            if (child != SphericalArc::invalid)
+            {
+                candidates.push(std::make_pair(child, piece));
+            }
+            else
+            {
+                // The push_back can cause a reallocation, so the child index
+                // is assigned before the push_back.
+                child = nodes.size();
+                nodes.push_back(piece);
             }
         }
 
-        // Lookup table for indexing into mFaceNormals.
-        std::map<Triangle*, std::size_t> mTriToNormal;
+        // Copy the BSP tree to mNodes in depth-first order with the positive
+        // child of a node immediately after the node. The positive side is
+        // taken for directions on the arcs, so this order improves the
+        // locality of the descents.
+        void CreateCompactNodes(std::vector<SphericalArc> const& nodes)
+        {
+            GTL_LENGTH_ASSERT(
+                nodes.size() < static_cast<std::size_t>(leafBit),
+                "The number of nodes exceeds the range of the node indices.");
+
+            // The stack stores the node indices and their depths. The depth
+            // of the tree includes the leaves.
+            std::vector<std::size_t> order{};
+            order.reserve(nodes.size());
+            std::vector<std::uint32_t> compactIndex(nodes.size());
+            std::vector<std::pair<std::size_t, std::size_t>> stack{};
+            stack.push_back(std::make_pair(0, 1));
+            mTreeDepth = 0;
+            while (!stack.empty())
+            {
+                std::size_t current = stack.back().first;
+                std::size_t depth = stack.back().second;
+                stack.pop_back();
+                compactIndex[current] = static_cast<std::uint32_t>(order.size());
+                order.push_back(current);
+                mTreeDepth = std::max(mTreeDepth, depth + 1);
+                if (nodes[current].negChild != SphericalArc::invalid)
+                {
+                    stack.push_back(std::make_pair(nodes[current].negChild, depth + 1));
+                }
+                if (nodes[current].posChild != SphericalArc::invalid)
+                {
+                    stack.push_back(std::make_pair(nodes[current].posChild, depth + 1));
+                }
+            }
 
-        // Fixed-size storage for the BSP nodes.
-        std::vector<SphericalArc> mNodes;
+            mNodes.resize(order.size());
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                SphericalArc const& arc = nodes[order[i]];
+                Node& node = mNodes[i];
+                node.normal = Vector3<T>{ static_cast<T>(arc.normal[0]),
+                    static_cast<T>(arc.normal[1]), static_cast<T>(arc.normal[2]) };
+                node.child[0] = (arc.posChild != SphericalArc::invalid ?
+                    compactIndex[arc.posChild] :
+                    (leafBit | static_cast<std::uint32_t>(arc.posVertex)));
+                node.child[1] = (arc.negChild != SphericalArc::invalid ?
+                    compactIndex[arc.negChild] :
+                    (leafBit | static_cast<std::uint32_t>(arc.negVertex)));
+            }
+        }
+
+        // Storage for the BSP nodes.
+        std::vector<Node> mNodes;
         std::size_t mTreeDepth;
 
+        // The vertices adjacent to vertex v are mAdjacentVertices[i] for
+        // mAdjacentOffsets[v] <= i < mAdjacentOffsets[v+1].
+        std::vector<std::uint32_t> mAdjacentOffsets;
+        std::vector<std::uint32_t> mAdjacentVertices;
+
+        // The triangle normals and the faces used during construction. The
+        // triangle t is in the face represented by triangle mFaces[t].
+        std::vector<Vector3<Real>> mNormals;
+        std::vector<std::size_t> mFaces;
+
     private:
         friend class UnitTestExtremalQuery3BSP;
     };
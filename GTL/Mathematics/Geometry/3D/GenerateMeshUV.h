@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.17
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -27,6 +27,7 @@
 
 #include <GTL/Mathematics/Algebra/Vector.h>
 #include <GTL/Mathematics/Meshes/DynamicETManifoldMesh.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -34,7 +35,6 @@
 #include <functional>
 #include <limits>
 #include <set>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -51,12 +51,17 @@ namespace gtl
         // Provide a callback when you want to monitor each iteration of the
         // uv-solver. The input to the progress callback is the current
         // iteration; it starts at 1 and increases to the numIterations input
-        // to the operator() member function.
+        // to the operator() member function. The Gauss-Seidel iterations
+        // launch numThreads tasks per iteration. If 'pool' is not null, the
+        // tasks are executed by the pool workers, which avoids creating and
+        // joining threads on every iteration.
         GenerateMeshUV(std::size_t numThreads,
-            std::function<void(std::size_t)> const* progress = nullptr)
+            std::function<void(std::size_t)> const* progress = nullptr,
+            ThreadPool* pool = nullptr)
             :
             mNumThreads(numThreads),
             mProgress(progress),
+            mPool(pool),
             mNumVertices(0),
             mVertices(nullptr),
             mTCoords(nullptr),
@@ -143,6 +148,7 @@ namespace gtl
         // Constructor inputs.
         std::size_t mNumThreads;
         std::function<void(std::size_t)> const* mProgress;
+        ThreadPool* mPool;
 
         // Convenience members that store the input parameters to operator().
         std::size_t mNumVertices;
@@ -633,10 +639,8 @@ namespace gtl
                 }
 
                 // Execute Gauss-Seidel iterations in multiple threads.
-                std::vector<std::thread> process(mNumThreads);
-                for (std::size_t t = 0; t < mNumThreads; ++t)
-                {
-                    process[t] = std::thread([this, t, &vmin, &vmax, inTCoords, outTCoords]()
+                ForkJoin(mPool, mNumThreads,
+                    [this, &vmin, &vmax, inTCoords, outTCoords](std::size_t t)
                     {
                         for (std::size_t j = vmin[t]; j <= vmax[t]; ++j)
                         {
@@ -657,13 +661,6 @@ namespace gtl
                             outTCoords[v0] = tcoord;
                         }
                     });
-                }
-
-                // Wait for all threads to finish.
-                for (std::size_t t = 0; t < mNumThreads; ++t)
-                {
-                    process[t].join();
-                }
 
                 std::swap(inTCoords, outTCoords);
             }
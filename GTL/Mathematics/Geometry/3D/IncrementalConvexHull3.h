@@ -0,0 +1,1155 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// Maintain the convex hull of 3D points that arrive in batches. The hull is
+// updated by randomized incremental insertion with a conflict graph, which
+// is described in
+//   Kenneth L. Clarkson and Peter W. Shor, Applications of random sampling
+//   in computational geometry, II, Discrete & Computational Geometry 4,
+//   387-421, 1989
+// and in Chapter 11 of
+//   Mark de Berg, Otfried Cheong, Marc van Kreveld and Mark Overmars,
+//   Computational Geometry: Algorithms and Applications, 3rd edition,
+//   Springer, 2008.
+// Each uninserted point of a batch stores the hull triangles it can see and
+// each triangle stores the points that can see it. Inserting a point
+// removes the triangles it sees and connects the point to the horizon
+// edges. The points that can see a new triangle are among the points that
+// can see the two triangles sharing its horizon edge, so only the triangles
+// affected by an insertion are touched.
+//
+// The triangles that were ever part of the hull are kept in a history graph
+// (the influence graph of
+//   Jean-Daniel Boissonnat, Olivier Devillers, Rene Schott, Monique Teillaud
+//   and Mariette Yvinec, Applications of random sampling to on-line
+//   algorithms in computational geometry, Discrete & Computational Geometry
+//   8, 51-71, 1992).
+// A new triangle is the child of the removed triangle and of the kept
+// triangle that share its horizon edge. A point that sees a triangle sees
+// one of its parents, so the triangles seen by a point are found by
+// descending the graph from the 4 triangles of the first tetrahedron
+// through the triangles the point sees. The graph locates the points of a
+// new batch and answers containment queries. When the points are inserted
+// in random order, the expected number of visited triangles is O(log n).
+// The points of each batch are inserted in a biased randomized insertion
+// order (SpatialSort::BRIO) with a seed that depends only on the constructor
+// seed and the number of points inserted so far, so the results are
+// reproducible. The bound does not hold for an adversarial sequence of
+// batches, for example, small batches of points sorted along a line.
+//
+// The sign tests use the same exact predicate as ConvexHull3, so GetHull
+// is a triangulation of the exact convex hull of the points inserted so
+// far, which is the polyhedron triangulated by ConvexHull3 applied to the
+// same points. In particular, every corner of the polyhedron is a vertex
+// of both. The outputs are not identical in general:
+//   1. When no 4 hull points are coplanar, GetVertices and GetHull produce
+//      the same vertices and triangles as ConvexHull3.
+//   2. Otherwise, the triangulations of the planar faces can differ, and
+//      so can the subsets of the points on the faces or edges that are
+//      vertices. These depend on the insertion order.
+// Of a set of equal points, only the one with the smallest index can be a
+// hull vertex, which is the representative ConvexHull3 uses.
+//
+// While the points are coplanar, the hull is the 0-, 1- or 2-dimensional
+// hull with the vertices ConvexHull3 produces for all the points inserted
+// so far. The 2-dimensional hull is recomputed by ConvexHull3 for each
+// batch, so inserting many coplanar points one at a time is expensive. The
+// containment queries require a 3-dimensional hull.
+
+#include <GTL/Mathematics/Geometry/3D/ConvexHull3.h>
+#include <GTL/Mathematics/Geometry/3D/ExactColinear3.h>
+#include <GTL/Mathematics/Geometry/3D/ExactToPlane3.h>
+#include <GTL/Mathematics/Geometry/ND/SpatialSort.h>
+#include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtl
+{
+    template <typename T>
+    class IncrementalConvexHull3
+    {
+    public:
+        // The seed controls the insertion order of the points of each batch.
+        IncrementalConvexHull3(std::uint64_t seed = 0)
+            :
+            mSeed(seed),
+            mPoints{},
+            mDimension(0),
+            mVertices{},
+            mFacets{},
+            mLinks{},
+            mVertexFacet{},
+            mStartFacet{},
+            mConflictHead{},
+            mPendingPoints{},
+            mPendingHead{},
+            mPendingMark{},
+            mConflicts{},
+            mVisible{},
+            mNewFacets{},
+            mQuery{},
+            mStatistics{},
+            mNumCandidates(0),
+            mNumExamined(0),
+            mNumForwarded(0),
+            mCoarse{},
+            mCoarseIndex{}
+        {
+            static_assert(
+                std::is_floating_point<T>::value,
+                "The input type must be a floating-point type.");
+        }
+
+        // Remove all points.
+        void Clear()
+        {
+            mPoints.clear();
+            mDimension = 0;
+            mVertices.clear();
+            mFacets.clear();
+            mLinks.clear();
+            mVertexFacet.clear();
+            mStartFacet.clear();
+            mConflictHead.clear();
+            mStatistics = PredicateStatistics{};
+            mNumCandidates = 0;
+            mNumExamined = 0;
+            mNumForwarded = 0;
+            mCoarse.reset();
+            mCoarseIndex.clear();
+        }
+
+        // Insert a batch of points. The points are copied, and the point
+        // inserted k-th over all batches has index k. If numThreads > 1,
+        // the points of the batch are located in the history graph by
+        // numThreads tasks. If 'pool' is not null, the tasks are executed
+        // by the pool workers; otherwise, std::thread objects are launched.
+        // The hull does not depend on the number of threads.
+        void Insert(std::size_t numPoints, Vector3<T> const* points,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                numPoints == 0 || points != nullptr,
+                "Invalid argument.");
+
+            GTL_LENGTH_ASSERT(
+                numPoints < static_cast<std::size_t>(invalid32) - mPoints.size(),
+                "The number of points exceeds the range of 32-bit indices.");
+
+            if (numPoints == 0)
+            {
+                return;
+            }
+
+            std::size_t const first = mPoints.size();
+            mQuery.ResetStatistics();
+            mPoints.insert(mPoints.end(), points, points + numPoints);
+            std::uint32_t const invalid = invalid32;
+            mVertexFacet.resize(mPoints.size(), invalid);
+            mStartFacet.resize(mPoints.size(), invalid);
+
+            std::vector<std::size_t> pending{};
+            if (mDimension < 3)
+            {
+                // The candidates are the vertices of the lower-dimensional
+                // hull and the new points, in increasing index order.
+                pending.reserve(mVertices.size() + numPoints);
+                pending.insert(pending.end(), mVertices.begin(), mVertices.end());
+                std::sort(pending.begin(), pending.end());
+                for (std::size_t i = first; i < mPoints.size(); ++i)
+                {
+                    pending.push_back(i);
+                }
+
+                if (!CreateTetrahedron(pending))
+                {
+                    mStatistics += mQuery.GetStatistics();
+                    return;
+                }
+            }
+            else
+            {
+                pending.resize(numPoints);
+                std::iota(pending.begin(), pending.end(), first);
+            }
+
+            RemoveDuplicates(pending);
+            SpatialSort<T, 3>::BRIO(mPoints.data(), pending, mSeed + first);
+            InsertPending(pending, numThreads, pool);
+            mStatistics += mQuery.GetStatistics();
+            UpdateCoarse(numThreads, pool);
+        }
+
+        void Insert(std::vector<Vector3<T>> const& points,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            Insert(points.size(), points.data(), numThreads, pool);
+        }
+
+        // Access to the inserted points.
+        inline std::size_t GetNumPoints() const
+        {
+            return mPoints.size();
+        }
+
+        inline std::vector<Vector3<T>> const& GetPoints() const
+        {
+            return mPoints;
+        }
+
+        // The dimension is 0 (hull is a single point), 1 (hull is a line
+        // segment), 2 (hull is a convex polygon in 3D) or 3 (hull is a
+        // convex polyhedron). The dimension is 0 when no points have been
+        // inserted.
+        inline std::size_t GetDimension() const
+        {
+            return mDimension;
+        }
+
+        // Get the indices of the hull vertices. For dimension 3, the
+        // indices are increasing. For dimensions 0, 1 and 2, the vertices
+        // are those of ConvexHull3::GetVertices, in the same order.
+        void GetVertices(std::vector<std::size_t>& vertices) const
+        {
+            vertices.clear();
+            if (mDimension < 3)
+            {
+                vertices = mVertices;
+                return;
+            }
+
+            for (std::size_t v = 0; v < mVertexFacet.size(); ++v)
+            {
+                if (IsHullVertex(v))
+                {
+                    vertices.push_back(v);
+                }
+            }
+        }
+
+        // Get the triangles of the hull when the dimension is 3. The
+        // triangles are counterclockwise when viewed from outside the hull.
+        // Each triple starts with its smallest index, which is the
+        // convention of ConvexHull3::GetHull, and the triples are sorted
+        // lexicographically, so the output depends only on the triangles.
+        // The return value is 'true' iff the dimension is 3.
+        bool GetHull(std::vector<std::size_t>& hull) const
+        {
+            hull.clear();
+            if (mDimension != 3)
+            {
+                return false;
+            }
+
+            std::vector<std::array<std::uint32_t, 3>> triangles{};
+            for (auto const& facet : mFacets)
+            {
+                if (facet.killer == invalid32)
+                {
+                    std::array<std::uint32_t, 3> const& V = facet.V;
+                    if (V[0] < V[1] && V[0] < V[2])
+                    {
+                        triangles.push_back({ V[0], V[1], V[2] });
+                    }
+                    else if (V[1] < V[2])
+                    {
+                        triangles.push_back({ V[1], V[2], V[0] });
+                    }
+                    else
+                    {
+                        triangles.push_back({ V[2], V[0], V[1] });
+                    }
+                }
+            }
+            std::sort(triangles.begin(), triangles.end());
+
+            hull.reserve(3 * triangles.size());
+            for (auto const& triangle : triangles)
+            {
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    hull.push_back(triangle[j]);
+                }
+            }
+            return true;
+        }
+
+        // The number of triangles ever created, which is the size of the
+        // history graph.
+        inline std::size_t GetNumHistoryTriangles() const
+        {
+            return mFacets.size();
+        }
+
+        // Test whether the point is inside the hull or on its boundary. The
+        // dimension must be 3.
+        bool Contains(Vector3<T> const& point)
+        {
+            GTL_RUNTIME_ASSERT(
+                mDimension == 3,
+                "The hull must be 3-dimensional.");
+
+            std::vector<std::uint32_t> stack{};
+            return Locate(point, mQuery, stack) == invalid32;
+        }
+
+        // Test a batch of points for containment, contained[i] is 1 when
+        // points[i] is inside the hull or on its boundary, 0 otherwise. The
+        // points are partitioned into numThreads chunks that are tested
+        // concurrently.
+        void Contains(std::size_t numPoints, Vector3<T> const* points,
+            std::uint8_t* contained, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                numPoints == 0 || (points != nullptr && contained != nullptr),
+                "Invalid argument.");
+
+            GTL_RUNTIME_ASSERT(
+                mDimension == 3,
+                "The hull must be 3-dimensional.");
+
+            ForEachChunk(numPoints, numThreads, pool,
+                [this, points, contained](std::size_t, std::size_t imin, std::size_t isup)
+                {
+                    ExactToPlane3<T> query{};
+                    std::vector<std::uint32_t> stack{};
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        contained[i] = (Locate(points[i], query, stack) == invalid32 ? 1 : 0);
+                    }
+                });
+        }
+
+        void Contains(std::vector<Vector3<T>> const& points,
+            std::vector<std::uint8_t>& contained, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr) const
+        {
+            contained.resize(points.size());
+            Contains(points.size(), points.data(), contained.data(), numThreads, pool);
+        }
+
+        // Get the index of a hull vertex V that maximizes Dot(direction,V).
+        // For dimension 3, the search moves along hull edges to the
+        // neighbor with the largest dot product until no neighbor improves
+        // it, which finds a maximum because the hull is convex. The search
+        // starts at the extreme vertex of a coarser hull (see the comments
+        // for mCoarse), which is usually a few edges from the maximum.
+        // Unlike the containment queries, this has no O(log n) bound; a
+        // climb can visit O(n) vertices, for example around a vertex of
+        // high degree. When a logarithmic query is required, build an
+        // ExtremalQuery3BSP from GetHull after the insertions. For
+        // dimensions 0, 1 and 2, the hull vertices are searched
+        // exhaustively. At least one point must have been inserted.
+        std::size_t GetExtremeVertex(Vector3<T> const& direction) const
+        {
+            GTL_RUNTIME_ASSERT(
+                mPoints.size() > 0,
+                "The hull has no points.");
+
+            if (mDimension < 3)
+            {
+                return GetExtremeVertexLowDimension(direction);
+            }
+
+            std::size_t start = mFacets.back().V[0];
+            if (mCoarse && mCoarse->GetDimension() == 3)
+            {
+                start = GetLiveVertex(mCoarseIndex[mCoarse->GetExtremeVertex(direction)]);
+            }
+            return Climb(direction, start);
+        }
+
+        // Get the extreme vertex by a search that starts at the specified
+        // hull vertex. When the directions of consecutive queries are
+        // nearby, which is typical when tracking an object, the previous
+        // result is a good start and few vertices are visited. The
+        // dimension must be 3.
+        std::size_t GetExtremeVertex(Vector3<T> const& direction, std::size_t start) const
+        {
+            GTL_RUNTIME_ASSERT(
+                mDimension == 3,
+                "The hull must be 3-dimensional.");
+
+            GTL_ARGUMENT_ASSERT(
+                start < mPoints.size() && IsHullVertex(start),
+                "The start must be a hull vertex.");
+
+            return Climb(direction, start);
+        }
+
+        // Get the extreme vertices for a batch of directions. The
+        // directions are partitioned into numThreads chunks that are
+        // searched concurrently.
+        void GetExtremeVertices(std::size_t numDirections, Vector3<T> const* directions,
+            std::size_t* vertices, std::size_t numThreads = 1, ThreadPool* pool = nullptr) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                numDirections == 0 || (directions != nullptr && vertices != nullptr),
+                "Invalid argument.");
+
+            ForEachChunk(numDirections, numThreads, pool,
+                [this, directions, vertices](std::size_t, std::size_t imin, std::size_t isup)
+                {
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        vertices[i] = GetExtremeVertex(directions[i]);
+                    }
+                });
+        }
+
+        void GetExtremeVertices(std::vector<Vector3<T>> const& directions,
+            std::vector<std::size_t>& vertices, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr) const
+        {
+            vertices.resize(directions.size());
+            GetExtremeVertices(directions.size(), directions.data(), vertices.data(),
+                numThreads, pool);
+        }
+
+        // The number of to-plane queries whose sign was determined by the
+        // floating-point filter, by interval arithmetic and by rational
+        // arithmetic during the insertions, summed over all threads. The
+        // statistics are reset by Clear().
+        inline PredicateStatistics const& GetPredicateStatistics() const
+        {
+            return mStatistics;
+        }
+
+    private:
+        static std::uint32_t constexpr invalid32 = std::numeric_limits<std::uint32_t>::max();
+
+        // A triangle of the history graph. The vertices V[] are
+        // counterclockwise when viewed from outside the hull. While the
+        // triangle is on the hull, S[i] is the triangle sharing the edge
+        // <V[i],V[(i+1)%3]>. The parents are the removed triangle and the
+        // kept triangle that shared the horizon edge <V[0],V[1]> when the
+        // triangle was created; they are invalid32 for the triangles of the
+        // first tetrahedron. The children are in a singly linked list of
+        // mLinks. The killer is the point whose insertion removed the
+        // triangle, or invalid32 while the triangle is on the hull.
+        struct Facet
+        {
+            std::array<std::uint32_t, 3> V;
+            std::array<std::uint32_t, 3> S;
+            std::array<std::uint32_t, 2> parents;
+            std::uint32_t firstChild;
+            std::uint32_t killer;
+        };
+
+        struct Link
+        {
+            std::uint32_t facet;
+            std::uint32_t next;
+        };
+
+        // An edge of the conflict graph of a batch. The pending point
+        // 'slot' sees triangle 'facet'. The edge is in the list of the
+        // triangle and in the list of the point.
+        struct Conflict
+        {
+            std::uint32_t slot;
+            std::uint32_t facet;
+            std::uint32_t nextOfFacet;
+            std::uint32_t nextOfSlot;
+        };
+
+        inline bool IsHullVertex(std::size_t v) const
+        {
+            std::uint32_t const f = mVertexFacet[v];
+            return f != invalid32 && mFacets[f].killer == invalid32;
+        }
+
+        template <typename Function>
+        static void ForEachChunk(std::size_t numItems, std::size_t numThreads,
+            ThreadPool* pool, Function const& function)
+        {
+            std::size_t const numChunks = std::max(std::min(numThreads, numItems),
+                static_cast<std::size_t>(1));
+            if (numChunks == 1)
+            {
+                function(0, 0, numItems);
+                return;
+            }
+
+            std::size_t const load = numItems / numChunks;
+            ForkJoin(pool, numChunks,
+                [&function, numItems, numChunks, load](std::size_t chunk)
+                {
+                    std::size_t const imin = chunk * load;
+                    std::size_t const isup = (chunk + 1 < numChunks ? imin + load : numItems);
+                    function(chunk, imin, isup);
+                });
+        }
+
+        // For a plane with origin V0 and normal N = Cross(V1-V0, V2-V0),
+        // ToPlane returns +1 when P is on the positive side of the plane,
+        // -1 when P is on the negative side and 0 when P is on the plane.
+        // The rational arithmetic, when needed, converts the points
+        // locally, so concurrent calls with different queries are safe.
+        inline std::int32_t ToPlane(ExactToPlane3<T>& query, Vector3<T> const& P,
+            std::uint32_t f) const
+        {
+            std::array<std::uint32_t, 3> const& V = mFacets[f].V;
+            return query(P, mPoints[V[0]], mPoints[V[1]], mPoints[V[2]]);
+        }
+
+        // Find a hull triangle that the point sees, which is a triangle
+        // whose plane has the point strictly on its positive side. The
+        // return value is invalid32 when the point sees no hull triangle,
+        // in which case it is inside the hull or on its boundary. A child
+        // is visited from its first parent when the point sees that parent
+        // and from its second parent otherwise, so every triangle is
+        // visited at most once.
+        std::uint32_t Locate(Vector3<T> const& point, ExactToPlane3<T>& query,
+            std::vector<std::uint32_t>& stack) const
+        {
+            stack.clear();
+            for (std::uint32_t f = 0; f < 4; ++f)
+            {
+                if (ToPlane(query, point, f) > 0)
+                {
+                    stack.push_back(f);
+                }
+            }
+
+            while (stack.size() > 0)
+            {
+                std::uint32_t const f = stack.back();
+                stack.pop_back();
+                Facet const& facet = mFacets[f];
+                if (facet.killer == invalid32)
+                {
+                    return f;
+                }
+
+                for (std::uint32_t link = facet.firstChild; link != invalid32; link = mLinks[link].next)
+                {
+                    std::uint32_t const child = mLinks[link].facet;
+                    if (ToPlane(query, point, child) > 0)
+                    {
+                        std::uint32_t const removed = mFacets[child].parents[0];
+                        if (removed == f || ToPlane(query, point, removed) <= 0)
+                        {
+                            stack.push_back(child);
+                        }
+                    }
+                }
+            }
+            return invalid32;
+        }
+
+        std::uint32_t CreateFacet(std::uint32_t v0, std::uint32_t v1, std::uint32_t v2,
+            std::uint32_t removed, std::uint32_t kept)
+        {
+            GTL_LENGTH_ASSERT(
+                mFacets.size() < static_cast<std::size_t>(invalid32),
+                "The number of triangles exceeds the range of 32-bit indices.");
+
+            std::uint32_t const f = static_cast<std::uint32_t>(mFacets.size());
+            Facet facet{};
+            facet.V = { v0, v1, v2 };
+            facet.S = { invalid32, invalid32, invalid32 };
+            facet.parents = { removed, kept };
+            facet.firstChild = invalid32;
+            facet.killer = invalid32;
+            mFacets.push_back(facet);
+            mConflictHead.push_back(facet.killer);
+
+            if (removed != invalid32)
+            {
+                AddChild(removed, f);
+                AddChild(kept, f);
+            }
+
+            mVertexFacet[v0] = f;
+            mVertexFacet[v1] = f;
+            mVertexFacet[v2] = f;
+            return f;
+        }
+
+        void AddChild(std::uint32_t parent, std::uint32_t child)
+        {
+            std::uint32_t const link = static_cast<std::uint32_t>(mLinks.size());
+            mLinks.push_back({ child, mFacets[parent].firstChild });
+            mFacets[parent].firstChild = link;
+        }
+
+        // Search the candidates, which are in increasing index order, for
+        // 4 points that are not coplanar. If they exist, the tetrahedron
+        // they span becomes the initial hull, its vertices are removed from
+        // the candidates and the function returns 'true'. Otherwise, the
+        // lower-dimensional hull is computed and the function returns
+        // 'false'. The 0- and 1-dimensional hulls are computed here,
+        // because ConvexHull3 requires at least 3 distinct points, and the
+        // 2-dimensional hull is computed by ConvexHull3. The vertices are
+        // those ConvexHull3 produces for all the points inserted so far.
+        bool CreateTetrahedron(std::vector<std::size_t>& candidates)
+        {
+            std::size_t const invalid = std::numeric_limits<std::size_t>::max();
+            std::array<std::size_t, 4> tetra = { candidates[0], invalid, invalid, invalid };
+            ExactColinear3<T> colinearQuery{};
+            for (auto c : candidates)
+            {
+                Vector3<T> const& P = mPoints[c];
+                if (tetra[1] == invalid)
+                {
+                    if (P != mPoints[tetra[0]])
+                    {
+                        tetra[1] = c;
+                    }
+                }
+                else if (tetra[2] == invalid)
+                {
+                    if (!colinearQuery(mPoints[tetra[0]], mPoints[tetra[1]], P))
+                    {
+                        tetra[2] = c;
+                    }
+                }
+                else if (mQuery(P, mPoints[tetra[0]], mPoints[tetra[1]], mPoints[tetra[2]]) != 0)
+                {
+                    tetra[3] = c;
+                    break;
+                }
+            }
+
+            if (tetra[1] == invalid)
+            {
+                mDimension = 0;
+                mVertices.assign(1, tetra[0]);
+                return false;
+            }
+
+            if (tetra[2] == invalid)
+            {
+                // The vertices are the first and last distinct points in
+                // lexicographic order. The first candidate of a set of
+                // equal points has the smallest index.
+                std::size_t vmin = tetra[0], vmax = tetra[0];
+                for (auto c : candidates)
+                {
+                    if (mPoints[c] < mPoints[vmin])
+                    {
+                        vmin = c;
+                    }
+                    else if (mPoints[vmax] < mPoints[c])
+                    {
+                        vmax = c;
+                    }
+                }
+                mDimension = 1;
+                mVertices = { vmin, vmax };
+                return false;
+            }
+
+            if (tetra[3] == invalid)
+            {
+                // The order of the polygon vertices produced by ConvexHull3
+                // depends on the points inside the polygon, so the hull is
+                // computed for all the points.
+                ConvexHull3<T> hull{};
+                hull(mPoints, 0);
+                mDimension = hull.GetDimension();
+                mVertices = hull.GetVertices();
+                mStatistics += hull.GetPredicateStatistics();
+                return false;
+            }
+
+            // The triangle <tetra[0],tetra[1],tetra[2]> must have tetra[3]
+            // on its negative side.
+            if (mQuery(mPoints[tetra[3]], mPoints[tetra[0]], mPoints[tetra[1]], mPoints[tetra[2]]) > 0)
+            {
+                std::swap(tetra[1], tetra[2]);
+            }
+
+            std::array<std::uint32_t, 4> V{};
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                V[i] = static_cast<std::uint32_t>(tetra[i]);
+            }
+
+            // The triangle i is opposite vertex 3-i. The adjacent triangle
+            // S[j] shares the edge <V[j],V[(j+1)%3]>.
+            std::uint32_t const f0 = CreateFacet(V[0], V[1], V[2], invalid32, invalid32);
+            std::uint32_t const f1 = CreateFacet(V[1], V[0], V[3], invalid32, invalid32);
+            std::uint32_t const f2 = CreateFacet(V[2], V[1], V[3], invalid32, invalid32);
+            std::uint32_t const f3 = CreateFacet(V[0], V[2], V[3], invalid32, invalid32);
+            mFacets[f0].S = { f1, f2, f3 };
+            mFacets[f1].S = { f0, f3, f2 };
+            mFacets[f2].S = { f0, f1, f3 };
+            mFacets[f3].S = { f0, f2, f1 };
+
+            mDimension = 3;
+            mVertices.clear();
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                [&tetra](std::size_t c)
+                {
+                    return c == tetra[0] || c == tetra[1] || c == tetra[2] || c == tetra[3];
+                }),
+                candidates.end());
+            return true;
+        }
+
+        // ConvexHull3 keeps the point with the smallest index of a set of
+        // equal points. A point equal to a point of an earlier batch is not
+        // outside the hull when it is inserted, but equal points in the
+        // same batch are inserted in the BRIO order. The points of the
+        // batch that are equal to a point with smaller index are removed.
+        void RemoveDuplicates(std::vector<std::size_t>& pending) const
+        {
+            std::vector<std::size_t> sorted = pending;
+            std::sort(sorted.begin(), sorted.end(),
+                [this](std::size_t i0, std::size_t i1)
+                {
+                    return mPoints[i0] < mPoints[i1] ||
+                        (mPoints[i0] == mPoints[i1] && i0 < i1);
+                });
+
+            std::vector<std::size_t> duplicates{};
+            for (std::size_t i = 1; i < sorted.size(); ++i)
+            {
+                if (mPoints[sorted[i]] == mPoints[sorted[i - 1]])
+                {
+                    duplicates.push_back(sorted[i]);
+                }
+            }
+
+            if (duplicates.size() > 0)
+            {
+                std::sort(duplicates.begin(), duplicates.end());
+                pending.erase(std::remove_if(pending.begin(), pending.end(),
+                    [&duplicates](std::size_t i)
+                    {
+                        return std::binary_search(duplicates.begin(), duplicates.end(), i);
+                    }),
+                    pending.end());
+            }
+        }
+
+        // Insert the pending points, in order, into the 3-dimensional hull.
+        void InsertPending(std::vector<std::size_t> const& pending,
+            std::size_t numThreads, ThreadPool* pool)
+        {
+            std::size_t const numPending = pending.size();
+            std::size_t const numChunks = std::max(std::min(numThreads, numPending),
+                static_cast<std::size_t>(1));
+
+            // Locate the pending points in the history graph.
+            std::vector<std::uint32_t> located(numPending);
+            std::vector<PredicateStatistics> statistics(numChunks);
+            ForEachChunk(numPending, numChunks, pool,
+                [this, &pending, &located, &statistics](std::size_t chunk,
+                    std::size_t imin, std::size_t isup)
+                {
+                    ExactToPlane3<T> query{};
+                    std::vector<std::uint32_t> stack{};
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        located[i] = Locate(mPoints[pending[i]], query, stack);
+                    }
+                    statistics[chunk] = query.GetStatistics();
+                });
+
+            for (auto const& s : statistics)
+            {
+                mStatistics += s;
+            }
+
+            // The triangles seen by a point form a connected region of the
+            // hull, so they are found by a search that starts at the
+            // located triangle. The most recent conflict of a triangle
+            // seen by the current point is for that point.
+            mPendingPoints.resize(numPending);
+            std::uint32_t const invalid = invalid32;
+            mPendingHead.assign(numPending, invalid);
+            mPendingMark.assign(numPending, invalid);
+            mConflicts.clear();
+            for (std::uint32_t slot = 0; slot < static_cast<std::uint32_t>(numPending); ++slot)
+            {
+                mPendingPoints[slot] = static_cast<std::uint32_t>(pending[slot]);
+                if (located[slot] == invalid32)
+                {
+                    continue;
+                }
+
+                Vector3<T> const& P = mPoints[pending[slot]];
+                mVisible.clear();
+                mVisible.push_back(located[slot]);
+                AddConflict(slot, located[slot]);
+                for (std::size_t k = 0; k < mVisible.size(); ++k)
+                {
+                    for (auto adj : mFacets[mVisible[k]].S)
+                    {
+                        std::uint32_t const c = mConflictHead[adj];
+                        if ((c == invalid32 || mConflicts[c].slot != slot) &&
+                            ToPlane(mQuery, P, adj) > 0)
+                        {
+                            mVisible.push_back(adj);
+                            AddConflict(slot, adj);
+                        }
+                    }
+                }
+            }
+            located.clear();
+
+            // The conflicts of removed triangles and of inserted points
+            // are not unlinked from the lists. When the conflict array has
+            // doubled in size since it was last compacted, the conflicts
+            // that are still needed are copied to a new array.
+            std::size_t const minCompactSize = 65536;
+            std::size_t compactSize = std::max(2 * mConflicts.size(), minCompactSize);
+            for (std::uint32_t slot = 0; slot < static_cast<std::uint32_t>(numPending); ++slot)
+            {
+                // The triangles seen by the point are the ones in its
+                // list that are still on the hull.
+                std::uint32_t const p = mPendingPoints[slot];
+                mVisible.clear();
+                for (std::uint32_t c = mPendingHead[slot]; c != invalid32; c = mConflicts[c].nextOfSlot)
+                {
+                    std::uint32_t const f = mConflicts[c].facet;
+                    if (mFacets[f].killer == invalid32)
+                    {
+                        mVisible.push_back(f);
+                    }
+                }
+
+                if (mVisible.size() > 0)
+                {
+                    InsertPoint(p, slot);
+                    if (mConflicts.size() >= compactSize)
+                    {
+                        CompactConflicts(slot);
+                        compactSize = std::max(2 * mConflicts.size(), minCompactSize);
+                    }
+                }
+            }
+
+            // Remove the conflict lists of the batch.
+            for (auto const& conflict : mConflicts)
+            {
+                mConflictHead[conflict.facet] = invalid32;
+            }
+            mConflicts.clear();
+        }
+
+        // Rebuild the conflict lists from the conflicts of the points that
+        // follow the specified slot and of the triangles on the hull.
+        void CompactConflicts(std::uint32_t slot)
+        {
+            std::vector<Conflict> conflicts{};
+            conflicts.swap(mConflicts);
+            for (auto const& conflict : conflicts)
+            {
+                mConflictHead[conflict.facet] = invalid32;
+            }
+
+            std::uint32_t const numPending = static_cast<std::uint32_t>(mPendingHead.size());
+            for (std::uint32_t s = slot + 1; s < numPending; ++s)
+            {
+                std::uint32_t c = mPendingHead[s];
+                mPendingHead[s] = invalid32;
+                for (; c != invalid32; c = conflicts[c].nextOfSlot)
+                {
+                    if (mFacets[conflicts[c].facet].killer == invalid32)
+                    {
+                        AddConflict(s, conflicts[c].facet);
+                    }
+                }
+            }
+        }
+
+        void AddConflict(std::uint32_t slot, std::uint32_t f)
+        {
+            GTL_LENGTH_ASSERT(
+                mConflicts.size() < static_cast<std::size_t>(invalid32),
+                "The number of conflicts exceeds the range of 32-bit indices.");
+
+            std::uint32_t const c = static_cast<std::uint32_t>(mConflicts.size());
+            mConflicts.push_back({ slot, f, mConflictHead[f], mPendingHead[slot] });
+            mConflictHead[f] = c;
+            mPendingHead[slot] = c;
+        }
+
+        // Replace the triangles in mVisible, which are those seen by the
+        // point p, by the triangles connecting p to the horizon edges.
+        void InsertPoint(std::uint32_t p, std::uint32_t slot)
+        {
+            for (auto f : mVisible)
+            {
+                mFacets[f].killer = p;
+            }
+
+            // Each horizon edge <V[i],V[(i+1)%3]> of a removed triangle is
+            // shared with a kept triangle. The new triangle <V[i],V[i+1],p>
+            // is adjacent to the kept triangle across the horizon edge.
+            std::uint32_t const firstNew = static_cast<std::uint32_t>(mFacets.size());
+            mNewFacets.clear();
+            for (auto f : mVisible)
+            {
+                for (std::size_t i0 = 0; i0 < 3; ++i0)
+                {
+                    std::uint32_t const kept = mFacets[f].S[i0];
+                    if (mFacets[kept].killer != invalid32)
+                    {
+                        continue;
+                    }
+
+                    std::size_t const i1 = (i0 + 1) % 3;
+                    std::uint32_t const v0 = mFacets[f].V[i0];
+                    std::uint32_t const v1 = mFacets[f].V[i1];
+                    GTL_RUNTIME_ASSERT(
+                        mStartFacet[v0] == invalid32 || mStartFacet[v0] < firstNew,
+                        "The horizon is not a simple cycle.");
+
+                    std::uint32_t const nf = CreateFacet(v0, v1, p, f, kept);
+                    mStartFacet[v0] = nf;
+                    mNewFacets.push_back(nf);
+
+                    Facet& keptFacet = mFacets[kept];
+                    std::size_t j = 0;
+                    while (j < 3 && keptFacet.S[j] != f)
+                    {
+                        ++j;
+                    }
+                    GTL_RUNTIME_ASSERT(
+                        j < 3,
+                        "Unexpected condition.");
+                    keptFacet.S[j] = nf;
+                    mFacets[nf].S[0] = kept;
+                }
+            }
+
+            // The new triangle <v0,v1,p> shares the edge <v1,p> with the new
+            // triangle that starts at v1.
+            for (auto nf : mNewFacets)
+            {
+                std::uint32_t const next = mStartFacet[mFacets[nf].V[1]];
+                GTL_RUNTIME_ASSERT(
+                    next != invalid32 && next >= firstNew,
+                    "The horizon is not a simple cycle.");
+                mFacets[nf].S[1] = next;
+                mFacets[next].S[2] = nf;
+            }
+
+            // The points that see a new triangle are among the points that
+            // see its parents. The points inserted before p, including p,
+            // are skipped.
+            for (auto nf : mNewFacets)
+            {
+                for (auto parent : mFacets[nf].parents)
+                {
+                    for (std::uint32_t c = mConflictHead[parent]; c != invalid32; c = mConflicts[c].nextOfFacet)
+                    {
+                        std::uint32_t const s = mConflicts[c].slot;
+                        if (s > slot && mPendingMark[s] != nf)
+                        {
+                            mPendingMark[s] = nf;
+                            if (ToPlane(mQuery, mPoints[mPendingPoints[s]], nf) > 0)
+                            {
+                                AddConflict(s, nf);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Send the sampled candidates to the coarse hull.
+        void UpdateCoarse(std::size_t numThreads, ThreadPool* pool)
+        {
+            if (!mCoarse)
+            {
+                for (; mNumExamined < mPoints.size(); ++mNumExamined)
+                {
+                    if (mVertexFacet[mNumExamined] != invalid32)
+                    {
+                        ++mNumCandidates;
+                    }
+                }
+                if (mNumCandidates < coarseThreshold)
+                {
+                    return;
+                }
+                mCoarse = std::make_unique<IncrementalConvexHull3>(mSeed + 1);
+            }
+
+            std::vector<Vector3<T>> sample{};
+            for (std::size_t v = mNumForwarded; v < mPoints.size(); ++v)
+            {
+                if (mVertexFacet[v] != invalid32 && IsSampled(v))
+                {
+                    sample.push_back(mPoints[v]);
+                    mCoarseIndex.push_back(static_cast<std::uint32_t>(v));
+                }
+            }
+            mNumForwarded = mPoints.size();
+            mCoarse->Insert(sample, numThreads, pool);
+        }
+
+        // A hash of the index and the seed (the finalizer of SplitMix64)
+        // selects 1/coarseRatio of the candidates.
+        inline bool IsSampled(std::size_t v) const
+        {
+            std::uint64_t z = mSeed + 0x9E3779B97F4A7C15ull * (static_cast<std::uint64_t>(v) + 1);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z = z ^ (z >> 31);
+            return z % coarseRatio == 0;
+        }
+
+        // A candidate that is no longer a hull vertex is replaced by the
+        // point that removed its last triangle, which is a hull vertex
+        // after its insertion, until a hull vertex is reached.
+        std::size_t GetLiveVertex(std::size_t v) const
+        {
+            while (!IsHullVertex(v))
+            {
+                v = mFacets[mVertexFacet[v]].killer;
+            }
+            return v;
+        }
+
+        std::size_t GetExtremeVertexLowDimension(Vector3<T> const& direction) const
+        {
+            std::size_t extreme = mVertices[0];
+            T maxDot = Dot(direction, mPoints[extreme]);
+            for (std::size_t i = 1; i < mVertices.size(); ++i)
+            {
+                T const dot = Dot(direction, mPoints[mVertices[i]]);
+                if (dot > maxDot)
+                {
+                    maxDot = dot;
+                    extreme = mVertices[i];
+                }
+            }
+            return extreme;
+        }
+
+        // Move from the hull vertex to the neighbor with the largest dot
+        // product while the dot product increases. The neighbors of v are
+        // visited by rotating around v through the triangle adjacencies.
+        std::size_t Climb(Vector3<T> const& direction, std::size_t vertex) const
+        {
+            std::uint32_t v = static_cast<std::uint32_t>(vertex);
+            T maxDot = Dot(direction, mPoints[v]);
+            for (;;)
+            {
+                std::uint32_t const start = mVertexFacet[v];
+                std::uint32_t f = start;
+                std::uint32_t best = v;
+                do
+                {
+                    Facet const& facet = mFacets[f];
+                    std::size_t i = (facet.V[0] == v ? 0 : (facet.V[1] == v ? 1 : 2));
+                    std::uint32_t const neighbor = facet.V[(i + 1) % 3];
+                    T const dot = Dot(direction, mPoints[neighbor]);
+                    if (dot > maxDot)
+                    {
+                        maxDot = dot;
+                        best = neighbor;
+                    }
+
+                    // The next triangle around v shares <V[i+2],V[i]>.
+                    f = facet.S[(i + 2) % 3];
+                } while (f != start);
+
+                if (best == v)
+                {
+                    return v;
+                }
+                v = best;
+            }
+        }
+
+        // The seed for the insertion order.
+        std::uint64_t mSeed;
+
+        // The inserted points.
+        std::vector<Vector3<T>> mPoints;
+
+        // The hull dimension. While it is smaller than 3, mVertices stores
+        // the hull vertices computed by ConvexHull3.
+        std::size_t mDimension;
+        std::vector<std::size_t> mVertices;
+
+        // The history graph. The first 4 triangles are those of the initial
+        // tetrahedron, which are the roots of the graph.
+        std::vector<Facet> mFacets;
+        std::vector<Link> mLinks;
+
+        // For each point, a triangle that was created with the point as a
+        // vertex. The point is a hull vertex iff the most recently created
+        // one is on the hull, because a hull vertex whose triangles are
+        // removed is on the horizon and receives new triangles.
+        std::vector<std::uint32_t> mVertexFacet;
+
+        // Temporary storage for linking the new triangles of an insertion.
+        // mStartFacet[v] is the most recently created triangle whose horizon
+        // edge starts at v.
+        std::vector<std::uint32_t> mStartFacet;
+
+        // The conflict graph of the batch being inserted. The pending
+        // points are mPendingPoints in insertion order. The lists are
+        // singly linked through mConflicts; mConflictHead has an element
+        // for each triangle of the history graph and mPendingHead has an
+        // element for each pending point. mPendingMark prevents testing a
+        // point twice against the same new triangle.
+        std::vector<std::uint32_t> mConflictHead;
+        std::vector<std::uint32_t> mPendingPoints;
+        std::vector<std::uint32_t> mPendingHead;
+        std::vector<std::uint32_t> mPendingMark;
+        std::vector<Conflict> mConflicts;
+        std::vector<std::uint32_t> mVisible;
+        std::vector<std::uint32_t> mNewFacets;
+
+        // The predicate for the insertions and for single queries.
+        ExactToPlane3<T> mQuery;
+
+        // Statistics about the stages of the to-plane predicates.
+        PredicateStatistics mStatistics;
+
+        // The hull of a random sample of the points, which provides the
+        // starting vertices for the extremal queries. A point is a
+        // candidate for the sample when it is a hull vertex after its
+        // insertion, and a candidate is in the sample with probability
+        // 1/coarseRatio, decided by a hash of its index. The hull vertices
+        // are candidates, so when the extreme vertex of the sample is not
+        // extreme for the points, the vertices that are more extreme are
+        // the candidates on the far side of the plane through it, whose
+        // expected number is O(coarseRatio). The coarse hull has its own
+        // coarse hull, so the query visits O(log n) levels. This is a
+        // heuristic for the starting vertex, not a bound on the query,
+        // because the climb at each level is not bounded. The coarse
+        // hull is created when there are coarseThreshold candidates among
+        // the first mNumExamined points. The first mNumForwarded points
+        // have been sent to the coarse hull, and mCoarseIndex[i] is the
+        // index of the i-th point of the coarse hull.
+        static std::size_t constexpr coarseRatio = 8;
+        static std::size_t constexpr coarseThreshold = 256;
+        std::size_t mNumCandidates;
+        std::size_t mNumExamined;
+        std::size_t mNumForwarded;
+        std::unique_ptr<IncrementalConvexHull3> mCoarse;
+        std::vector<std::uint32_t> mCoarseIndex;
+
+    private:
+        friend class UnitTestIncrementalConvexHull3;
+    };
+}
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.17
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -34,12 +34,12 @@
 #include <GTL/Mathematics/Meshes/DynamicVETManifoldMesh.h>
 #include <GTL/Mathematics/Meshes/UniqueVerticesSimplices.h>
 #include <GTL/Mathematics/Primitives/ND/AlignedBox.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <limits>
 #include <map>
-#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -165,10 +165,14 @@ namespace gtl
     public:
         // Construction and destruction. To execute in the main thread, set
         // numThreads to 0. To run multithreaded on the CPU, set numThreads
-        // to a positive number.
-        MinimumVolumeBox3(std::size_t numThreads = 0)
+        // to a positive number. The edge pairs are partitioned into
+        // numThreads subsets. If 'pool' is not null, the subsets are
+        // processed by the pool workers; otherwise, std::thread objects are
+        // launched for the subsets. The box is the same in either case.
+        MinimumVolumeBox3(std::size_t numThreads = 0, ThreadPool* pool = nullptr)
             :
             mNumThreads(numThreads),
+            mPool(pool),
             mDomainIndex{},
             mZero(C_<ComputeType>(0)),
             mOne(C_<ComputeType>(1)),
@@ -746,23 +750,18 @@ namespace gtl
                 imax.back() = mEdgeIndices.size();
 
                 std::vector<Candidate> candidates(mNumThreads);
-                std::vector<std::thread> process(mNumThreads);
-                for (std::size_t t = 0; t < mNumThreads; ++t)
-                {
-                    process[t] = std::thread(
-                        [this, t, &imin, &imax, &candidates]()
+                ForkJoin(mPool, mNumThreads,
+                    [this, &imin, &imax, &candidates](std::size_t t)
+                    {
+                        candidates[t] = mAlignedCandidate;
+                        for (std::size_t i = imin[t]; i < imax[t]; ++i)
                         {
-                            candidates[t] = mAlignedCandidate;
-                            for (std::size_t i = imin[t]; i < imax[t]; ++i)
-                            {
-                                ProcessEdgePair(mEdgeIndices[i], candidates[t]);
-                            }
-                        });
-                }
+                            ProcessEdgePair(mEdgeIndices[i], candidates[t]);
+                        }
+                    });
 
                 for (std::size_t t = 0; t < mNumThreads; ++t)
                 {
-                    process[t].join();
                     if (candidates[t].volume < mMinimumVolumeObject.volume)
                     {
                         mMinimumVolumeObject = candidates[t];
@@ -827,8 +826,10 @@ namespace gtl
         }
 
         // The number of threads to use for computing. If 0, the main thread
-        // is used. If positive, std::thread objects are used.
+        // is used. If positive, the pool workers are used when mPool is not
+        // null and std::thread objects are used otherwise.
         std::size_t mNumThreads;
+        ThreadPool* mPool;
 
         // The maximum sample index used to search each level curve for
         // non-face-supporting boxes (mMaxSample + 1 values). The samples are
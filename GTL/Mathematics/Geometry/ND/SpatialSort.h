@@ -0,0 +1,246 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// Spatial orderings of points for incremental geometric algorithms. An
+// incremental Delaunay algorithm locates each new point by walking through
+// the mesh from the most recently created simplex. When consecutive points
+// are close, the walks are short and touch memory that is already in the
+// cache.
+//
+// HilbertSort orders points along a Hilbert space-filling curve. The
+// bounding box of the points is quantized to a grid with 2^b cells per
+// dimension, where b = floor(64/N) (but at most 32), and the points are
+// sorted by the 64-bit indices of their cells along the curve. The
+// conversion from cell coordinates to curve index is the algorithm in
+//   John Skilling, Programming the Hilbert curve,
+//   AIP Conference Proceedings 707, 381-387, 2004.
+//
+// BRIO is the biased randomized insertion order of
+//   Nina Amenta, Sunghee Choi and Gunter Rote, Incremental constructions
+//   con BRIO, Proceedings of the 19th Annual Symposium on Computational
+//   Geometry, 211-219, 2003.
+// Each point is assigned to the last round with probability 1/2, to the
+// next-to-last round with probability 1/4 and so on, so the rounds have
+// geometrically increasing sizes. The rounds are inserted in order and the
+// points of each round are sorted by HilbertSort. The randomization keeps
+// the expected size of the structural changes as small as for a random
+// insertion order; the sorting within a round provides the locality. The
+// random numbers are generated from a caller-specified seed, so the order
+// is reproducible.
+
+#include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Utility/Exceptions.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtl
+{
+    template <typename T, std::size_t N>
+    class SpatialSort
+    {
+    public:
+        // Reorder indices[] so that points[indices[i]] are in Hilbert curve
+        // order. The indices must be smaller than the number of points.
+        // Ties, which occur for points in the same grid cell, are broken by
+        // index, so the order depends only on the inputs.
+        static void HilbertSort(Vector<T, N> const* points,
+            std::size_t numIndices, std::size_t* indices)
+        {
+            static_assert(
+                std::is_floating_point<T>::value && N >= 2 && N <= 8,
+                "Invalid type or dimension.");
+
+            GTL_ARGUMENT_ASSERT(
+                points != nullptr && (numIndices == 0 || indices != nullptr),
+                "Invalid argument.");
+
+            if (numIndices <= 1)
+            {
+                return;
+            }
+
+            // Compute the bounding box of the points.
+            Vector<T, N> vmin = points[indices[0]], vmax = vmin;
+            for (std::size_t i = 1; i < numIndices; ++i)
+            {
+                Vector<T, N> const& point = points[indices[i]];
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    vmin[d] = std::min(vmin[d], point[d]);
+                    vmax[d] = std::max(vmax[d], point[d]);
+                }
+            }
+
+            // Map each point to the index of its grid cell along the curve.
+            std::size_t const numBits = std::min(64 / N, static_cast<std::size_t>(32));
+            double const maxCell = static_cast<double>((static_cast<std::uint64_t>(1) << numBits) - 1);
+            std::array<double, N> scale{};
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                double const range = static_cast<double>(vmax[d]) - static_cast<double>(vmin[d]);
+                scale[d] = (range > 0.0 ? maxCell / range : 0.0);
+            }
+
+            std::vector<std::pair<std::uint64_t, std::size_t>> keys(numIndices);
+            for (std::size_t i = 0; i < numIndices; ++i)
+            {
+                Vector<T, N> const& point = points[indices[i]];
+                std::array<std::uint64_t, N> cell{};
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    double const u = (static_cast<double>(point[d]) - static_cast<double>(vmin[d])) * scale[d];
+                    cell[d] = static_cast<std::uint64_t>(std::min(u, maxCell));
+                }
+                keys[i] = std::make_pair(GetHilbertIndex(numBits, cell), indices[i]);
+            }
+
+            std::sort(keys.begin(), keys.end());
+            for (std::size_t i = 0; i < numIndices; ++i)
+            {
+                indices[i] = keys[i].second;
+            }
+        }
+
+        static void HilbertSort(Vector<T, N> const* points, std::vector<std::size_t>& indices)
+        {
+            HilbertSort(points, indices.size(), indices.data());
+        }
+
+        // Reorder indices[] to a biased randomized insertion order. The
+        // first round has at least minRoundSize points (or all of them) so
+        // that the first simplices are not built from a handful of points
+        // whose sorting is wasted effort.
+        static void BRIO(Vector<T, N> const* points, std::vector<std::size_t>& indices,
+            std::uint64_t seed = 0, std::size_t minRoundSize = 64)
+        {
+            GTL_ARGUMENT_ASSERT(
+                points != nullptr,
+                "Invalid argument.");
+
+            std::size_t const numIndices = indices.size();
+            if (numIndices <= 1)
+            {
+                return;
+            }
+
+            // The number of rounds r satisfies minRoundSize * 2^(r-1) >=
+            // numIndices, so the expected size of the first round is at
+            // least minRoundSize.
+            std::size_t numRounds = 1;
+            for (std::size_t size = std::max(minRoundSize, static_cast<std::size_t>(1));
+                size < numIndices; size *= 2)
+            {
+                ++numRounds;
+            }
+
+            // Assign the points to rounds. Round numRounds-1 is the last
+            // one. A point is in round numRounds-1-k when its random bits
+            // have k trailing ones, and round 0 absorbs the remainder.
+            std::mt19937_64 generator(seed);
+            std::vector<std::uint8_t> round(numIndices);
+            std::vector<std::size_t> count(numRounds + 1, 0);
+            for (std::size_t i = 0; i < numIndices; ++i)
+            {
+                std::uint64_t bits = generator();
+                std::size_t k = 0;
+                while ((bits & 1) != 0 && k + 1 < numRounds)
+                {
+                    bits >>= 1;
+                    ++k;
+                }
+                std::size_t const r = numRounds - 1 - k;
+                round[i] = static_cast<std::uint8_t>(r);
+                ++count[r + 1];
+            }
+
+            // Distribute the indices to the rounds, preserving their order
+            // within each round, and sort each round along the curve.
+            for (std::size_t r = 1; r <= numRounds; ++r)
+            {
+                count[r] += count[r - 1];
+            }
+            std::vector<std::size_t> ordered(numIndices);
+            std::vector<std::size_t> next(count.begin(), count.end() - 1);
+            for (std::size_t i = 0; i < numIndices; ++i)
+            {
+                ordered[next[round[i]]++] = indices[i];
+            }
+            for (std::size_t r = 0; r < numRounds; ++r)
+            {
+                HilbertSort(points, count[r + 1] - count[r], ordered.data() + count[r]);
+            }
+            indices = std::move(ordered);
+        }
+
+    private:
+        // Convert the cell coordinates, each with numBits bits, to the
+        // index of the cell along the Hilbert curve. The coordinates are
+        // transformed in place to the transposed form of the index, whose
+        // bits are then interleaved with the most significant bits first.
+        static std::uint64_t GetHilbertIndex(std::size_t numBits, std::array<std::uint64_t, N>& X)
+        {
+            std::uint64_t const M = static_cast<std::uint64_t>(1) << (numBits - 1);
+
+            // Inverse undo.
+            for (std::uint64_t Q = M; Q > 1; Q >>= 1)
+            {
+                std::uint64_t const P = Q - 1;
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if ((X[i] & Q) != 0)
+                    {
+                        X[0] ^= P;
+                    }
+                    else
+                    {
+                        std::uint64_t const t = (X[0] ^ X[i]) & P;
+                        X[0] ^= t;
+                        X[i] ^= t;
+                    }
+                }
+            }
+
+            // Gray encode.
+            for (std::size_t i = 1; i < N; ++i)
+            {
+                X[i] ^= X[i - 1];
+            }
+            std::uint64_t t = 0;
+            for (std::uint64_t Q = M; Q > 1; Q >>= 1)
+            {
+                if ((X[N - 1] & Q) != 0)
+                {
+                    t ^= Q - 1;
+                }
+            }
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                X[i] ^= t;
+            }
+
+            std::uint64_t index = 0;
+            for (std::size_t bit = numBits; bit-- > 0; )
+            {
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    index = (index << 1) | ((X[i] >> bit) & 1);
+                }
+            }
+            return index;
+        }
+
+        friend class UnitTestSpatialSort;
+    };
+}
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -29,28 +29,52 @@ namespace gtl
         virtual ~CurvatureFlow2() = default;
 
     protected:
-        virtual void OnUpdateSingle(std::size_t x, std::size_t y) override
+        // The update of a pixel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
         {
-            this->LookUp9(x, y);
-
-            T ux = this->mHalfInvDx * (this->mUpz - this->mUmz);
-            T uy = this->mHalfInvDy * (this->mUzp - this->mUzm);
-            T uxx = this->mInvDxDx * (this->mUpz - C_<T>(2) * this->mUzz + this->mUmz);
-            T uxy = this->mFourthInvDxDy * (this->mUmm + this->mUpp - this->mUmp - this->mUpm);
-            T uyy = this->mInvDyDy * (this->mUzp - C_<T>(2) * this->mUzz + this->mUzm);
-
-            T sqrUx = ux * ux;
-            T sqrUy = uy * uy;
-            T denom = sqrUx + sqrUy;
-            if (denom > C_<T>(0))
+            inline T operator()(typename PDEFilter2<T>::Rows const& u, std::size_t x) const
             {
+                T ux = halfInvDx * (u.uz[x + 1] - u.uz[x - 1]);
+                T uy = halfInvDy * (u.up[x] - u.um[x]);
+                T uxx = invDxDx * (u.uz[x + 1] - C_<T>(2) * u.uz[x] + u.uz[x - 1]);
+                T uxy = fourthInvDxDy * (u.um[x - 1] + u.up[x + 1] - u.up[x - 1] - u.um[x + 1]);
+                T uyy = invDyDy * (u.up[x] - C_<T>(2) * u.uz[x] + u.um[x]);
+
+                T sqrUx = ux * ux;
+                T sqrUy = uy * uy;
+                T denom = sqrUx + sqrUy;
                 T numer = uxx * sqrUy + uyy * sqrUx - C_<T>(1, 2) * uxy * ux * uy;
-                this->mBuffer[this->mDst](x, y) = this->mUzz + this->mTimeStep * numer / denom;
+                T update = u.uz[x] + timeStep * numer / denom;
+                // The update for denom = 0 is discarded rather than
+                // skipped, which avoids a branch in the row loop.
+                return (denom > C_<T>(0) ? update : u.uz[x]);
             }
-            else
+
+            T halfInvDx, halfInvDy;
+            T invDxDx, invDyDy;
+            T fourthInvDxDy;
+            T timeStep;
+        };
+
+        inline Kernel GetKernel() const
+        {
+            return Kernel
             {
-                this->mBuffer[this->mDst](x, y) = this->mUzz;
-            }
+                this->mHalfInvDx, this->mHalfInvDy,
+                this->mInvDxDx, this->mInvDyDy,
+                this->mFourthInvDxDy,
+                this->mTimeStep
+            };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
+        virtual void OnUpdateSingle(std::size_t x, std::size_t y) override
+        {
+            this->mBuffer[this->mDst](x, y) = GetKernel()(this->GetRows(y), x);
         }
 
     private:
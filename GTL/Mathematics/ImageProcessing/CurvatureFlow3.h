@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -29,33 +29,57 @@ namespace gtl
         virtual ~CurvatureFlow3() = default;
 
     protected:
-        virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) override
+        // The update of a voxel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
         {
-            this->LookUp27(x, y, z);
-
-            T ux = this->mHalfInvDx * (this->mUpzz - this->mUmzz);
-            T uy = this->mHalfInvDy * (this->mUzpz - this->mUzmz);
-            T uz = this->mHalfInvDz * (this->mUzzp - this->mUzzm);
-            T uxx = this->mInvDxDx * (this->mUpzz - C_<T>(2) * this->mUzzz + this->mUmzz);
-            T uxy = this->mFourthInvDxDy * (this->mUmmz + this->mUppz - this->mUpmz - this->mUmpz);
-            T uxz = this->mFourthInvDxDz * (this->mUmzm + this->mUpzp - this->mUpzm - this->mUmzp);
-            T uyy = this->mInvDyDy * (this->mUzpz - C_<T>(2) * this->mUzzz + this->mUzmz);
-            T uyz = this->mFourthInvDyDz * (this->mUzmm + this->mUzpp - this->mUzpm - this->mUzmp);
-            T uzz = this->mInvDzDz * (this->mUzzp - C_<T>(2) * this->mUzzz + this->mUzzm);
-
-            T denom = ux * ux + uy * uy + uz * uz;
-            if (denom > C_<T>(0))
+            inline T operator()(typename PDEFilter3<T>::Rows const& u, std::size_t x) const
             {
+                T ux = halfInvDx * (u.uzz[x + 1] - u.uzz[x - 1]);
+                T uy = halfInvDy * (u.upz[x] - u.umz[x]);
+                T uz = halfInvDz * (u.uzp[x] - u.uzm[x]);
+                T uxx = invDxDx * (u.uzz[x + 1] - C_<T>(2) * u.uzz[x] + u.uzz[x - 1]);
+                T uxy = fourthInvDxDy * (u.umz[x - 1] + u.upz[x + 1] - u.umz[x + 1] - u.upz[x - 1]);
+                T uxz = fourthInvDxDz * (u.uzm[x - 1] + u.uzp[x + 1] - u.uzm[x + 1] - u.uzp[x - 1]);
+                T uyy = invDyDy * (u.upz[x] - C_<T>(2) * u.uzz[x] + u.umz[x]);
+                T uyz = fourthInvDyDz * (u.umm[x] + u.upp[x] - u.upm[x] - u.ump[x]);
+                T uzz = invDzDz * (u.uzp[x] - C_<T>(2) * u.uzz[x] + u.uzm[x]);
+
+                T denom = ux * ux + uy * uy + uz * uz;
                 T numer0 = uy * (uxx * uy - uxy * ux) + ux * (uyy * ux - uxy * uy);
                 T numer1 = uz * (uxx * uz - uxz * ux) + ux * (uzz * ux - uxz * uz);
                 T numer2 = uz * (uyy * uz - uyz * uy) + uy * (uzz * uy - uyz * uz);
                 T numer = numer0 + numer1 + numer2;
-                this->mBuffer[this->mDst](x, y, z) = this->mUzzz + this->mTimeStep * numer / denom;
+                T update = u.uzz[x] + timeStep * numer / denom;
+                // The update for denom = 0 is discarded rather than
+                // skipped, which avoids a branch in the row loop.
+                return (denom > C_<T>(0) ? update : u.uzz[x]);
             }
-            else
+
+            T halfInvDx, halfInvDy, halfInvDz;
+            T invDxDx, invDyDy, invDzDz;
+            T fourthInvDxDy, fourthInvDxDz, fourthInvDyDz;
+            T timeStep;
+        };
+
+        inline Kernel GetKernel() const
+        {
+            return Kernel
             {
-                this->mBuffer[this->mDst](x, y, z) = this->mUzzz;
-            }
+                this->mHalfInvDx, this->mHalfInvDy, this->mHalfInvDz,
+                this->mInvDxDx, this->mInvDyDy, this->mInvDzDz,
+                this->mFourthInvDxDy, this->mFourthInvDxDz, this->mFourthInvDyDz,
+                this->mTimeStep
+            };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
+        virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) override
+        {
+            this->mBuffer[this->mDst](x, y, z) = GetKernel()(this->GetRows(y, z), x);
         }
 
     private:
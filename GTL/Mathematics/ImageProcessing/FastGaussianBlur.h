@@ -0,0 +1,361 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// FastGaussianBlur is the base class for FastGaussianBlur2 and
+// FastGaussianBlur3. The finite differences along each axis use samples of
+// the image at distance 'scale' from the pixel, which are obtained by linear
+// interpolation. The interpolation indices and weights depend only on the
+// coordinate along the axis, so they are computed once per axis rather than
+// once per pixel. The images are processed one row at a time; in the
+// interior of a row the x-samples are at fixed offsets from the pixel, so
+// the row loop reads contiguous memory and is vectorized by the compiler.
+//
+// The planes of the image (rows for 2D, slices for 3D) are partitioned among
+// the threads. When the input and output are the same array, the original
+// values of the planes that are still needed after they are overwritten are
+// copied to small per-thread buffers, so the blur is computed in place
+// without a full-size copy of the image.
+
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace gtl
+{
+    template <typename T>
+    class FastGaussianBlur
+    {
+    protected:
+        // A run of consecutive coordinates along an axis, begin <= c < end.
+        // In a regular run, the samples at c+scale and c-scale are not
+        // boundary values and their indices are c+pOffset and c+mOffset.
+        struct Run
+        {
+            std::size_t begin, end;
+            bool regular;
+        };
+
+        // The samples at c+scale and c-scale along an axis with values
+        // u[0] through u[bound-1] are
+        //   plus(c)  = u[p0[c]] + wp[c] * (u[p1[c]] - u[p0[c]])
+        //   minus(c) = u[m0[c]] + wm[c] * (u[m0[c]] - u[m1[c]])
+        // A sample beyond the boundary is the boundary value, in which case
+        // the two indices are the same and the weight is zero.
+        template <typename Real>
+        struct Axis
+        {
+            std::vector<std::size_t> p0, p1, m0, m1;
+            std::vector<Real> wp, wm;
+            std::int64_t pOffset, mOffset;
+            std::vector<Run> runs;
+        };
+
+        // The samples of a row along the y- or z-axis are those of rows of
+        // the image, so the indices and weights are the same for all x.
+        template <typename Real>
+        struct Neighbors
+        {
+            T const* p0;
+            T const* p1;
+            T const* m0;
+            T const* m1;
+            Real wp, wm;
+        };
+
+        static void ValidateType()
+        {
+            static_assert(
+                std::is_same<T, std::int16_t>::value ||
+                std::is_same<T, std::int32_t>::value ||
+                std::is_same<T, float>::value ||
+                std::is_same<T, double>::value,
+                "The template type must be 'std::int16_t', 'std::int32_t', 'float' or 'double'.");
+        }
+
+        template <typename Real>
+        static void CreateAxis(std::size_t bound, double scale, Axis<Real>& axis)
+        {
+            static_assert(
+                std::is_same<Real, float>::value || std::is_same<Real, double>::value,
+                "The computation type must be 'float' or 'double'.");
+
+            axis.p0.resize(bound);
+            axis.p1.resize(bound);
+            axis.m0.resize(bound);
+            axis.m1.resize(bound);
+            axis.wp.resize(bound);
+            axis.wm.resize(bound);
+            axis.pOffset = static_cast<std::int64_t>(std::floor(scale));
+            axis.mOffset = static_cast<std::int64_t>(std::ceil(-scale));
+            axis.runs.clear();
+
+            std::int64_t const iBound = static_cast<std::int64_t>(bound);
+            std::int64_t const iBoundM1 = iBound - 1;
+            for (std::int64_t c = 0; c < iBound; ++c)
+            {
+                std::size_t const i = static_cast<std::size_t>(c);
+                double rps = static_cast<double>(c) + scale;
+                double rms = static_cast<double>(c) - scale;
+                std::int64_t p = static_cast<std::int64_t>(std::floor(rps));
+                std::int64_t m = static_cast<std::int64_t>(std::ceil(rms));
+
+                if (p >= iBoundM1)  // use boundary value
+                {
+                    axis.p0[i] = static_cast<std::size_t>(iBoundM1);
+                    axis.p1[i] = axis.p0[i];
+                    axis.wp[i] = static_cast<Real>(0);
+                }
+                else  // linearly interpolate
+                {
+                    axis.p0[i] = static_cast<std::size_t>(p);
+                    axis.p1[i] = axis.p0[i] + 1;
+                    axis.wp[i] = static_cast<Real>(rps - static_cast<double>(p));
+                }
+
+                if (m <= 0)  // use boundary value
+                {
+                    axis.m0[i] = 0;
+                    axis.m1[i] = 0;
+                    axis.wm[i] = static_cast<Real>(0);
+                }
+                else  // linearly interpolate
+                {
+                    axis.m0[i] = static_cast<std::size_t>(m);
+                    axis.m1[i] = axis.m0[i] - 1;
+                    axis.wm[i] = static_cast<Real>(rms - static_cast<double>(m));
+                }
+
+                bool regular =
+                    axis.p0[i] != axis.p1[i] && p == c + axis.pOffset &&
+                    axis.m0[i] != axis.m1[i] && m == c + axis.mOffset;
+
+                if (axis.runs.size() > 0 && axis.runs.back().regular == regular)
+                {
+                    axis.runs.back().end = i + 1;
+                }
+                else
+                {
+                    axis.runs.push_back({ i, i + 1, regular });
+                }
+            }
+        }
+
+        template <typename Real>
+        static Neighbors<Real> GetNeighbors(Axis<Real> const& axis, std::size_t c,
+            T const* base, std::size_t stride)
+        {
+            Neighbors<Real> neighbors{};
+            neighbors.p0 = base + axis.p0[c] * stride;
+            neighbors.p1 = base + axis.p1[c] * stride;
+            neighbors.m0 = base + axis.m0[c] * stride;
+            neighbors.m1 = base + axis.m1[c] * stride;
+            neighbors.wp = axis.wp[c];
+            neighbors.wm = axis.wm[c];
+            return neighbors;
+        }
+
+        // Blur the row u[0] through u[xBound-1]. The neighbors[i] are the
+        // samples of the rows along the remaining axes. The sums of the
+        // second differences are accumulated in the order x, y, z.
+        template <typename Real, std::size_t N>
+        static void EvaluateRow(Axis<Real> const& xAxis, T const* u,
+            std::array<Neighbors<Real>, N> const& neighbors, Real logBase, T* output)
+        {
+            Real const minusTwo = static_cast<Real>(-2);
+            for (auto const& run : xAxis.runs)
+            {
+                if (run.regular)
+                {
+                    std::size_t const length = run.end - run.begin;
+                    T const* center = u + run.begin;
+                    T const* uP0 = u + (static_cast<std::int64_t>(run.begin) + xAxis.pOffset);
+                    T const* uP1 = uP0 + 1;
+                    T const* uM0 = u + (static_cast<std::int64_t>(run.begin) + xAxis.mOffset);
+                    T const* uM1 = uM0 - 1;
+                    Real const* wp = &xAxis.wp[run.begin];
+                    Real const* wm = &xAxis.wm[run.begin];
+                    T* target = output + run.begin;
+
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        Real c = static_cast<Real>(center[i]);
+                        Real p0 = static_cast<Real>(uP0[i]);
+                        Real m0 = static_cast<Real>(uM0[i]);
+                        Real sum = minusTwo * c;
+                        sum += p0 + wp[i] * (static_cast<Real>(uP1[i]) - p0);
+                        sum += m0 + wm[i] * (m0 - static_cast<Real>(uM1[i]));
+                        std::size_t const x = run.begin + i;
+                        for (std::size_t j = 0; j < N; ++j)
+                        {
+                            sum += GetSum(neighbors[j], x, minusTwo * c);
+                        }
+                        target[i] = static_cast<T>(c + logBase * sum);
+                    }
+                }
+                else
+                {
+                    for (std::size_t x = run.begin; x < run.end; ++x)
+                    {
+                        Real c = static_cast<Real>(u[x]);
+                        Real p0 = static_cast<Real>(u[xAxis.p0[x]]);
+                        Real m0 = static_cast<Real>(u[xAxis.m0[x]]);
+                        Real sum = minusTwo * c;
+                        sum += p0 + xAxis.wp[x] * (static_cast<Real>(u[xAxis.p1[x]]) - p0);
+                        sum += m0 + xAxis.wm[x] * (m0 - static_cast<Real>(u[xAxis.m1[x]]));
+                        for (std::size_t j = 0; j < N; ++j)
+                        {
+                            sum += GetSum(neighbors[j], x, minusTwo * c);
+                        }
+                        output[x] = static_cast<T>(c + logBase * sum);
+                    }
+                }
+            }
+        }
+
+        // Blur the planes 0 <= q < qBound of the outermost axis, each plane
+        // having planeSize elements. The function evaluatePlane(center,
+        // neighbors, target) blurs one plane, where 'center' contains the
+        // original values of the plane and 'neighbors' are the samples
+        // along the outermost axis.
+        template <typename Real, typename EvaluatePlane>
+        static void ExecutePlanes(Axis<Real> const& qAxis, std::size_t planeSize,
+            T const* input, T* output, EvaluatePlane const& evaluatePlane,
+            std::size_t numThreads, ThreadPool* pool)
+        {
+            std::size_t const qBound = qAxis.p0.size();
+            numThreads = std::max(std::min(numThreads, qBound), static_cast<std::size_t>(1));
+            auto GetRange = [qBound, numThreads](std::size_t t, std::size_t& qmin, std::size_t& qsup)
+            {
+                qmin = (t * qBound) / numThreads;
+                qsup = ((t + 1) * qBound) / numThreads;
+            };
+
+            if (input != output)
+            {
+                RunTasks(pool, numThreads,
+                    [&](std::size_t t)
+                    {
+                        std::size_t qmin{}, qsup{};
+                        GetRange(t, qmin, qsup);
+                        for (std::size_t q = qmin; q < qsup; ++q)
+                        {
+                            evaluatePlane(input + q * planeSize,
+                                GetNeighbors(qAxis, q, input, planeSize),
+                                output + q * planeSize);
+                        }
+                    });
+                return;
+            }
+
+            // The blur is in place. The planes of the range of a thread that
+            // are needed by the thread after they are overwritten are kept
+            // in a ring buffer. The planes outside the range that are needed
+            // by the thread are copied before any plane is overwritten.
+            struct Cache
+            {
+                std::size_t qmin, qsup, qlow, qhigh, ringSize;
+                std::vector<T> lower, upper, ring;
+            };
+            std::vector<Cache> caches(numThreads);
+
+            RunTasks(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    Cache& cache = caches[t];
+                    GetRange(t, cache.qmin, cache.qsup);
+                    cache.qlow = cache.qmin;
+                    cache.qhigh = cache.qsup;
+                    cache.ringSize = 1;
+                    for (std::size_t q = cache.qmin; q < cache.qsup; ++q)
+                    {
+                        std::size_t qneed = std::min(qAxis.m1[q], qAxis.m0[q]);
+                        cache.qlow = std::min(cache.qlow, qneed);
+                        cache.qhigh = std::max(cache.qhigh, std::max(qAxis.p0[q], qAxis.p1[q]) + 1);
+                        qneed = std::max(qneed, cache.qmin);
+                        cache.ringSize = std::max(cache.ringSize, q - qneed + 1);
+                    }
+
+                    cache.lower.assign(input + cache.qlow * planeSize,
+                        input + cache.qmin * planeSize);
+                    cache.upper.assign(input + cache.qsup * planeSize,
+                        input + cache.qhigh * planeSize);
+                    cache.ring.resize(cache.ringSize * planeSize);
+                });
+
+            RunTasks(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    Cache& cache = caches[t];
+                    for (std::size_t q = cache.qmin; q < cache.qsup; ++q)
+                    {
+                        T* slot = cache.ring.data() + (q % cache.ringSize) * planeSize;
+                        std::copy(output + q * planeSize, output + (q + 1) * planeSize, slot);
+
+                        auto GetPlane = [&cache, &output, planeSize, q](std::size_t qs)
+                        {
+                            if (qs < cache.qmin)
+                            {
+                                return static_cast<T const*>(cache.lower.data() + (qs - cache.qlow) * planeSize);
+                            }
+                            if (qs <= q)
+                            {
+                                return static_cast<T const*>(cache.ring.data() + (qs % cache.ringSize) * planeSize);
+                            }
+                            if (qs < cache.qsup)
+                            {
+                                return static_cast<T const*>(output + qs * planeSize);
+                            }
+                            return static_cast<T const*>(cache.upper.data() + (qs - cache.qsup) * planeSize);
+                        };
+
+                        Neighbors<Real> neighbors{};
+                        neighbors.p0 = GetPlane(qAxis.p0[q]);
+                        neighbors.p1 = GetPlane(qAxis.p1[q]);
+                        neighbors.m0 = GetPlane(qAxis.m0[q]);
+                        neighbors.m1 = GetPlane(qAxis.m1[q]);
+                        neighbors.wp = qAxis.wp[q];
+                        neighbors.wm = qAxis.wm[q];
+                        evaluatePlane(static_cast<T const*>(slot), neighbors,
+                            output + q * planeSize);
+                    }
+                });
+        }
+
+    private:
+        template <typename Real>
+        static inline Real GetSum(Neighbors<Real> const& v, std::size_t x, Real minusTwoCenter)
+        {
+            Real p0 = static_cast<Real>(v.p0[x]);
+            Real m0 = static_cast<Real>(v.m0[x]);
+            Real sum = minusTwoCenter;
+            sum += p0 + v.wp * (static_cast<Real>(v.p1[x]) - p0);
+            sum += m0 + v.wm * (m0 - static_cast<Real>(v.m1[x]));
+            return sum;
+        }
+
+        template <typename Task>
+        static void RunTasks(ThreadPool* pool, std::size_t numThreads, Task const& task)
+        {
+            if (numThreads > 1)
+            {
+                ForkJoin(pool, numThreads, task);
+            }
+            else
+            {
+                task(0);
+            }
+        }
+    };
+}
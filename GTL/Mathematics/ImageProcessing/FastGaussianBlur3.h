@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -43,153 +43,78 @@
 // difference method used to approximate the partial differential equation.
 // The method assumes a pixel size of h = 1.
 
-#include <GTL/Utility/MultiarrayAdapter.h>
-#include <cmath>
+#include <GTL/Mathematics/ImageProcessing/FastGaussianBlur.h>
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 
 namespace gtl
 {
-    // The image type must be one of std::int16_t, std::int32_t, float or double.  The
-    // computations are performed using double. The input and output images
-    // must both have xBound*yBound elements and be stored in lexicographical
-    // order. The indexing is i = x + xBound * (y + yBound * z).
+    // The image type must be one of std::int16_t, std::int32_t, float or
+    // double. The computations are performed using type Real, which is
+    // double by default. Choosing float is faster, especially for
+    // std::int16_t images, at the cost of precision. The input and output
+    // images must both have xBound*yBound*zBound elements and be stored in
+    // lexicographical order. The indexing is
+    // i = x + xBound * (y + yBound * z). The input and output can be the
+    // same array, in which case the blur is computed in place. If
+    // numThreads > 1, the slices are partitioned among the threads; the
+    // output does not depend on the number of threads. If 'pool' is not
+    // null, the tasks are executed by the pool; otherwise, std::thread
+    // objects are launched.
 
     template <typename T>
-    class FastGaussianBlur3
+    class FastGaussianBlur3 : public FastGaussianBlur<T>
     {
     public:
-        static void Execute(std::size_t inXBound, std::size_t inYBound, std::size_t inZBound,
-            T const* input, T* output, double scale, double logBase)
+        template <typename Real = double>
+        static void Execute(std::size_t xBound, std::size_t yBound,
+            std::size_t zBound,
+            T const* input, T* output, double scale, double logBase,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
         {
-            static_assert(
-                std::is_same<T, std::int16_t>::value ||
-                std::is_same<T, std::int32_t>::value ||
-                std::is_same<T, float>::value ||
-                std::is_same<T, double>::value,
-                "The template type must be 'std::int16_t', 'std::int32_t', 'float' or 'double'.");
+            Base::ValidateType();
 
-            MultiarrayAdapter<T, true> inImage(
-                { inXBound, inYBound, inZBound }, const_cast<T*>(input));
+            GTL_ARGUMENT_ASSERT(
+                input != nullptr && output != nullptr && scale > 0.0,
+                "Invalid input.");
 
-            MultiarrayAdapter<T, true> outImage(
-                { inXBound, inYBound, inZBound }, output);
+            Axis<Real> xAxis{}, yAxis{}, zAxis{};
+            Base::CreateAxis(xBound, scale, xAxis);
+            Base::CreateAxis(yBound, scale, yAxis);
+            Base::CreateAxis(zBound, scale, zAxis);
+            Real const realLogBase = static_cast<Real>(logBase);
 
-            std::int64_t xBound = static_cast<std::int64_t>(inXBound);
-            std::int64_t yBound = static_cast<std::int64_t>(inYBound);
-            std::int64_t zBound = static_cast<std::int64_t>(inZBound);
-            std::int64_t xBoundM1 = xBound - 1;
-            std::int64_t yBoundM1 = yBound - 1;
-            std::int64_t zBoundM1 = zBound - 1;
-
-            for (std::int64_t z = 0; z < zBound; ++z)
+            auto EvaluatePlane = [&](T const* center, Neighbors<Real> const& zNeighbors, T* target)
             {
-                double rzps = static_cast<double>(z) + scale;
-                double rzms = static_cast<double>(z) - scale;
-                std::int64_t zp1 = static_cast<std::int64_t>(std::floor(rzps));
-                std::int64_t zm1 = static_cast<std::int64_t>(std::ceil(rzms));
-
-                for (std::int64_t y = 0; y < yBound; ++y)
+                std::array<Neighbors<Real>, 2> neighbors{};
+                for (std::size_t y = 0, offset = 0; y < yBound; ++y, offset += xBound)
                 {
-                    double ryps = static_cast<double>(y) + scale;
-                    double ryms = static_cast<double>(y) - scale;
-                    std::int64_t yp1 = static_cast<std::int64_t>(std::floor(ryps));
-                    std::int64_t ym1 = static_cast<std::int64_t>(std::ceil(ryms));
-
-                    for (std::int64_t x = 0; x < xBound; ++x)
-                    {
-                        double rxps = static_cast<double>(x) + scale;
-                        double rxms = static_cast<double>(x) - scale;
-                        std::int64_t xp1 = static_cast<std::int64_t>(std::floor(rxps));
-                        std::int64_t xm1 = static_cast<std::int64_t>(std::ceil(rxms));
-
-                        double center = static_cast<double>(inImage(x, y, z));
-                        double xsum = -2.0 * center;
-                        double ysum = xsum;
-                        double zsum = xsum;
-
-                        // x portion of second central difference
-                        if (xp1 >= xBoundM1)  // use boundary value
-                        {
-                            xsum += static_cast<double>(inImage(xBoundM1, y, z));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgXp1 = static_cast<double>(inImage(xp1, y, z));
-                            double imgXp2 = static_cast<double>(inImage(xp1 + 1, y, z));
-                            double delta = rxps - static_cast<double>(xp1);
-                            xsum += imgXp1 + delta * (imgXp2 - imgXp1);
-                        }
-
-                        if (xm1 <= 0)  // use boundary value
-                        {
-                            xsum += static_cast<double>(inImage(0, y, z));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgXm1 = static_cast<double>(inImage(xm1, y, z));
-                            double imgXm2 = static_cast<double>(inImage(xm1 - 1, y, z));
-                            double delta = rxms - static_cast<double>(xm1);
-                            xsum += imgXm1 + delta * (imgXm1 - imgXm2);
-                        }
-
-                        // y portion of second central difference
-                        if (yp1 >= yBoundM1)  // use boundary value
-                        {
-                            ysum += static_cast<double>(inImage(x, yBoundM1, z));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgYp1 = static_cast<double>(inImage(x, yp1, z));
-                            double imgYp2 = static_cast<double>(inImage(x, yp1 + 1, z));
-                            double delta = ryps - static_cast<double>(yp1);
-                            ysum += imgYp1 + delta * (imgYp2 - imgYp1);
-                        }
+                    neighbors[0] = Base::GetNeighbors(yAxis, y, center, xBound);
+                    neighbors[1].p0 = zNeighbors.p0 + offset;
+                    neighbors[1].p1 = zNeighbors.p1 + offset;
+                    neighbors[1].m0 = zNeighbors.m0 + offset;
+                    neighbors[1].m1 = zNeighbors.m1 + offset;
+                    neighbors[1].wp = zNeighbors.wp;
+                    neighbors[1].wm = zNeighbors.wm;
+                    Base::EvaluateRow(xAxis, center + offset, neighbors, realLogBase, target + offset);
+                }
+            };
 
-                        if (ym1 <= 0)  // use boundary value
-                        {
-                            ysum += static_cast<double>(inImage(x, 0, z));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgYm1 = static_cast<double>(inImage(x, ym1, z));
-                            double imgYm2 = static_cast<double>(inImage(x, ym1 - 1, z));
-                            double delta = ryms - static_cast<double>(ym1);
-                            ysum += imgYm1 + delta * (imgYm1 - imgYm2);
-                        }
+            Base::ExecutePlanes(zAxis, xBound * yBound, input, output, EvaluatePlane, numThreads, pool);
+        }
 
-                        // z portion of second central difference
-                        if (zp1 >= zBoundM1)  // use boundary value
-                        {
-                            zsum += static_cast<double>(inImage(x, y, zBoundM1));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgZp1 = static_cast<double>(inImage(x, y, zp1));
-                            double imgZp2 = static_cast<double>(inImage(x, y, zp1 + 1));
-                            double delta = rzps - static_cast<double>(zp1);
-                            zsum += imgZp1 + delta * (imgZp2 - imgZp1);
-                        }
+    private:
+        using Base = FastGaussianBlur<T>;
 
-                        if (zm1 <= 0)  // use boundary value
-                        {
-                            zsum += static_cast<double>(inImage(x, y, 0));
-                        }
-                        else  // linearly interpolate
-                        {
-                            double imgZm1 = static_cast<double>(inImage(x, y, zm1));
-                            double imgZm2 = static_cast<double>(inImage(x, y, zm1 - 1));
-                            double delta = rzms - static_cast<double>(zm1);
-                            zsum += imgZm1 + delta * (imgZm1 - imgZm2);
-                        }
+        template <typename Real>
+        using Axis = typename Base::template Axis<Real>;
 
-                        outImage(x, y, z) = static_cast<T>(center + logBase * (xsum + ysum + zsum));
-                    }
-                }
-            }
-        }
+        template <typename Real>
+        using Neighbors = typename Base::template Neighbors<Real>;
 
-    private:
         friend class UnitTestFastGaussianBlur3;
     };
 }
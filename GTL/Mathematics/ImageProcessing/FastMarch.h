@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -169,6 +169,13 @@ namespace gtl
             return mTimes[i] == -std::numeric_limits<T>::max();
         }
 
+        // The fast marching iterations are complete when there are no trial
+        // elements.
+        inline std::size_t GetNumTrials() const
+        {
+            return mHeap.GetNumElements();
+        }
+
         inline bool IsInterior(std::size_t i) const
         {
             return IsValid(i) && !IsTrial(i);
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -39,14 +39,33 @@ namespace gtl
         }
 
     protected:
-        virtual void OnUpdateSingle(std::size_t x, std::size_t y) override
+        // The update of a pixel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
         {
-            this->LookUp5(x, y);
+            inline T operator()(typename PDEFilter2<T>::Rows const& u, std::size_t x) const
+            {
+                T uzz = u.uz[x];
+                T uxx = invDxDx * (u.uz[x + 1] - C_<T>(2) * uzz + u.uz[x - 1]);
+                T uyy = invDyDy * (u.up[x] - C_<T>(2) * uzz + u.um[x]);
+                return uzz + timeStep * (uxx + uyy);
+            }
 
-            T uxx = this->mInvDxDx * (this->mUpz - C_<T>(2) * this->mUzz + this->mUmz);
-            T uyy = this->mInvDyDy * (this->mUzp - C_<T>(2) * this->mUzz + this->mUzm);
+            T invDxDx, invDyDy, timeStep;
+        };
 
-            this->mBuffer[this->mDst](x, y) = this->mUzz + this->mTimeStep * (uxx + uyy);
+        inline Kernel GetKernel() const
+        {
+            return Kernel{ this->mInvDxDx, this->mInvDyDy, this->mTimeStep };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
+        virtual void OnUpdateSingle(std::size_t x, std::size_t y) override
+        {
+            this->mBuffer[this->mDst](x, y) = GetKernel()(this->GetRows(y), x);
         }
 
         T mMaximumTimeStep;
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -39,15 +39,34 @@ namespace gtl
         }
 
     protected:
-        virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) override
+        // The update of a voxel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
         {
-            this->LookUp7(x, y, z);
+            inline T operator()(typename PDEFilter3<T>::Rows const& u, std::size_t x) const
+            {
+                T uzzz = u.uzz[x];
+                T uxx = invDxDx * (u.uzz[x + 1] - C_<T>(2) * uzzz + u.uzz[x - 1]);
+                T uyy = invDyDy * (u.upz[x] - C_<T>(2) * uzzz + u.umz[x]);
+                T uzz = invDzDz * (u.uzp[x] - C_<T>(2) * uzzz + u.uzm[x]);
+                return uzzz + timeStep * (uxx + uyy + uzz);
+            }
 
-            T uxx = this->mInvDxDx * (this->mUpzz - C_<T>(2) * this->mUzzz + this->mUmzz);
-            T uyy = this->mInvDyDy * (this->mUzpz - C_<T>(2) * this->mUzzz + this->mUzmz);
-            T uzz = this->mInvDzDz * (this->mUzzp - C_<T>(2) * this->mUzzz + this->mUzzm);
+            T invDxDx, invDyDy, invDzDz, timeStep;
+        };
 
-            this->mBuffer[this->mDst](x, y, z) = this->mUzzz + this->mTimeStep * (uxx + uyy + uzz);
+        inline Kernel GetKernel() const
+        {
+            return Kernel{ this->mInvDxDx, this->mInvDyDy, this->mInvDzDz, this->mTimeStep };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
+        virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) override
+        {
+            this->mBuffer[this->mDst](x, y, z) = GetKernel()(this->GetRows(y, z), x);
         }
 
         T mMaximumTimeStep;
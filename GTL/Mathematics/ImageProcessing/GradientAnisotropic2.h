@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -43,13 +43,16 @@ namespace gtl
     protected:
         void ComputeParameter()
         {
+            // The centered differences are those of GetUx and GetUy, which
+            // use unpadded coordinates, for the pixels in padded coordinates.
             T gradMagSqr = C_<T>(0);
             for (std::size_t y = 1; y <= this->mYBound; ++y)
             {
+                auto const u = this->GetRows(y);
                 for (std::size_t x = 1; x <= this->mXBound; ++x)
                 {
-                    T ux = this->GetUx(x, y);
-                    T uy = this->GetUy(x, y);
+                    T ux = this->mHalfInvDx * (u.uz[x + 1] - u.uz[x - 1]);
+                    T uy = this->mHalfInvDy * (u.up[x] - u.um[x]);
                     gradMagSqr += ux * ux + uy * uy;
                 }
             }
@@ -64,51 +67,79 @@ namespace gtl
             ComputeParameter();
         }
 
+        // The update of a pixel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
+        {
+            inline T operator()(typename PDEFilter2<T>::Rows const& u, std::size_t x) const
+            {
+                // one-sided U-derivative estimates
+                T uxFwd = invDx * (u.uz[x + 1] - u.uz[x]);
+                T uxBwd = invDx * (u.uz[x] - u.uz[x - 1]);
+                T uyFwd = invDy * (u.up[x] - u.uz[x]);
+                T uyBwd = invDy * (u.uz[x] - u.um[x]);
+
+                // centered U-derivative estimates
+                T uxCenM = halfInvDx * (u.um[x + 1] - u.um[x - 1]);
+                T uxCenZ = halfInvDx * (u.uz[x + 1] - u.uz[x - 1]);
+                T uxCenP = halfInvDx * (u.up[x + 1] - u.up[x - 1]);
+                T uyCenM = halfInvDy * (u.up[x - 1] - u.um[x - 1]);
+                T uyCenZ = halfInvDy * (u.up[x] - u.um[x]);
+                T uyCenP = halfInvDy * (u.up[x + 1] - u.um[x + 1]);
+
+                T uxCenZSqr = uxCenZ * uxCenZ;
+                T uyCenZSqr = uyCenZ * uyCenZ;
+                T gradMagSqr{};
+
+                // estimate for C(x+1,y)
+                T uyEstP = C_<T>(1, 2) * (uyCenZ + uyCenP);
+                gradMagSqr = uxCenZSqr + uyEstP * uyEstP;
+                T cxp = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x-1,y)
+                T uyEstM = C_<T>(1, 2) * (uyCenZ + uyCenM);
+                gradMagSqr = uxCenZSqr + uyEstM * uyEstM;
+                T cxm = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y+1)
+                T uxEstP = C_<T>(1, 2) * (uxCenZ + uxCenP);
+                gradMagSqr = uyCenZSqr + uxEstP * uxEstP;
+                T cyp = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y-1)
+                T uxEstM = C_<T>(1, 2) * (uxCenZ + uxCenM);
+                gradMagSqr = uyCenZSqr + uxEstM * uxEstM;
+                T cym = std::exp(minusHalfParameter * gradMagSqr);
+
+                return u.uz[x] + timeStep * (
+                    cxp * uxFwd - cxm * uxBwd +
+                    cyp * uyFwd - cym * uyBwd);
+            }
+
+            T invDx, invDy;
+            T halfInvDx, halfInvDy;
+            T minusHalfParameter;
+            T timeStep;
+        };
+
+        inline Kernel GetKernel() const
+        {
+            return Kernel
+            {
+                this->mInvDx, this->mInvDy,
+                this->mHalfInvDx, this->mHalfInvDy,
+                mMHalfParameter,
+                this->mTimeStep
+            };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
         virtual void OnUpdateSingle(std::size_t x, std::size_t y) override
         {
-            this->LookUp9(x, y);
-
-            // one-sided U-derivative estimates
-            T uxFwd = this->mInvDx * (this->mUpz - this->mUzz);
-            T uxBwd = this->mInvDx * (this->mUzz - this->mUmz);
-            T uyFwd = this->mInvDy * (this->mUzp - this->mUzz);
-            T uyBwd = this->mInvDy * (this->mUzz - this->mUzm);
-
-            // centered U-derivative estimates
-            T uxCenM = this->mHalfInvDx * (this->mUpm - this->mUmm);
-            T uxCenZ = this->mHalfInvDx * (this->mUpz - this->mUmz);
-            T uxCenP = this->mHalfInvDx * (this->mUpp - this->mUmp);
-            T uyCenM = this->mHalfInvDy * (this->mUmp - this->mUmm);
-            T uyCenZ = this->mHalfInvDy * (this->mUzp - this->mUzm);
-            T uyCenP = this->mHalfInvDy * (this->mUpp - this->mUpm);
-
-            T uxCenZSqr = uxCenZ * uxCenZ;
-            T uyCenZSqr = uyCenZ * uyCenZ;
-            T gradMagSqr{};
-
-            // estimate for C(x+1,y)
-            T uyEstP = C_<T>(1, 2) * (uyCenZ + uyCenP);
-            gradMagSqr = uxCenZSqr + uyEstP * uyEstP;
-            T cxp = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x-1,y)
-            T uyEstM = C_<T>(1, 2) * (uyCenZ + uyCenM);
-            gradMagSqr = uxCenZSqr + uyEstM * uyEstM;
-            T cxm = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y+1)
-            T uxEstP = C_<T>(1, 2) * (uxCenZ + uxCenP);
-            gradMagSqr = uyCenZSqr + uxEstP * uxEstP;
-            T cyp = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y-1)
-            T uxEstM = C_<T>(1, 2) * (uxCenZ + uxCenM);
-            gradMagSqr = uyCenZSqr + uxEstM * uxEstM;
-            T cym = std::exp(mMHalfParameter * gradMagSqr);
-
-            this->mBuffer[this->mDst](x, y) = this->mUzz + this->mTimeStep * (
-                cxp * uxFwd - cxm * uxBwd +
-                cyp * uyFwd - cym * uyBwd);
+            this->mBuffer[this->mDst](x, y) = GetKernel()(this->GetRows(y), x);
         }
 
         // These are updated on each iteration, since they depend on the
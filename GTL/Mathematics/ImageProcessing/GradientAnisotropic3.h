@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -43,16 +43,20 @@ namespace gtl
     protected:
         void ComputeParameter()
         {
+            // The centered differences are those of GetUx, GetUy and GetUz,
+            // which use unpadded coordinates, for the voxels in padded
+            // coordinates.
             T gradMagSqr = C_<T>(0);
             for (std::size_t z = 1; z <= this->mZBound; ++z)
             {
                 for (std::size_t y = 1; y <= this->mYBound; ++y)
                 {
+                    auto const u = this->GetRows(y, z);
                     for (std::size_t x = 1; x <= this->mXBound; ++x)
                     {
-                        T ux = this->GetUx(x, y, z);
-                        T uy = this->GetUy(x, y, z);
-                        T uz = this->GetUz(x, y, z);
+                        T ux = this->mHalfInvDx * (u.uzz[x + 1] - u.uzz[x - 1]);
+                        T uy = this->mHalfInvDy * (u.upz[x] - u.umz[x]);
+                        T uz = this->mHalfInvDz * (u.uzp[x] - u.uzm[x]);
                         gradMagSqr += ux * ux + uy * uy + uz * uz;
                     }
                 }
@@ -68,82 +72,110 @@ namespace gtl
             ComputeParameter();
         }
 
+        // The update of a voxel, which is shared by OnUpdate and OnUpdateSingle.
+        struct Kernel
+        {
+            inline T operator()(typename PDEFilter3<T>::Rows const& u, std::size_t x) const
+            {
+                // one-sided U-derivative estimates
+                T uxFwd = invDx * (u.uzz[x + 1] - u.uzz[x]);
+                T uxBwd = invDx * (u.uzz[x] - u.uzz[x - 1]);
+                T uyFwd = invDy * (u.upz[x] - u.uzz[x]);
+                T uyBwd = invDy * (u.uzz[x] - u.umz[x]);
+                T uzFwd = invDz * (u.uzp[x] - u.uzz[x]);
+                T uzBwd = invDz * (u.uzz[x] - u.uzm[x]);
+
+                // centered U-derivative estimates
+                T duvzz = halfInvDx * (u.uzz[x + 1] - u.uzz[x - 1]);
+                T duvpz = halfInvDx * (u.upz[x + 1] - u.upz[x - 1]);
+                T duvmz = halfInvDx * (u.umz[x + 1] - u.umz[x - 1]);
+                T duvzp = halfInvDx * (u.uzp[x + 1] - u.uzp[x - 1]);
+                T duvzm = halfInvDx * (u.uzm[x + 1] - u.uzm[x - 1]);
+
+                T duzvz = halfInvDy * (u.upz[x] - u.umz[x]);
+                T dupvz = halfInvDy * (u.upz[x + 1] - u.umz[x + 1]);
+                T dumvz = halfInvDy * (u.upz[x - 1] - u.umz[x - 1]);
+                T duzvp = halfInvDy * (u.upp[x] - u.ump[x]);
+                T duzvm = halfInvDy * (u.upm[x] - u.umm[x]);
+
+                T duzzv = halfInvDz * (u.uzp[x] - u.uzm[x]);
+                T dupzv = halfInvDz * (u.uzp[x + 1] - u.uzm[x + 1]);
+                T dumzv = halfInvDz * (u.uzp[x - 1] - u.uzm[x - 1]);
+                T duzpv = halfInvDz * (u.upp[x] - u.upm[x]);
+                T duzmv = halfInvDz * (u.ump[x] - u.umm[x]);
+
+                T uxCenSqr = duvzz * duvzz;
+                T uyCenSqr = duzvz * duzvz;
+                T uzCenSqr = duzzv * duzzv;
+                T uxEst{}, uyEst{}, uzEst{}, gradMagSqr{};
+
+                // estimate for C(x+1,y,z)
+                uyEst = C_<T>(1, 2) * (duzvz + dupvz);
+                uzEst = C_<T>(1, 2) * (duzzv + dupzv);
+                gradMagSqr = uxCenSqr + uyEst * uyEst + uzEst * uzEst;
+                T cxp = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x-1,y,z)
+                uyEst = C_<T>(1, 2) * (duzvz + dumvz);
+                uzEst = C_<T>(1, 2) * (duzzv + dumzv);
+                gradMagSqr = uxCenSqr + uyEst * uyEst + uzEst * uzEst;
+                T cxm = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y+1,z)
+                uxEst = C_<T>(1, 2) * (duvzz + duvpz);
+                uzEst = C_<T>(1, 2) * (duzzv + duzpv);
+                gradMagSqr = uxEst * uxEst + uyCenSqr + uzEst * uzEst;
+                T cyp = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y-1,z)
+                uxEst = C_<T>(1, 2) * (duvzz + duvmz);
+                uzEst = C_<T>(1, 2) * (duzzv + duzmv);
+                gradMagSqr = uxEst * uxEst + uyCenSqr + uzEst * uzEst;
+                T cym = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y,z+1)
+                uxEst = C_<T>(1, 2) * (duvzz + duvzp);
+                uyEst = C_<T>(1, 2) * (duzvz + duzvp);
+                gradMagSqr = uxEst * uxEst + uyEst * uyEst + uzCenSqr;
+                T czp = std::exp(minusHalfParameter * gradMagSqr);
+
+                // estimate for C(x,y,z-1)
+                uxEst = C_<T>(1, 2) * (duvzz + duvzm);
+                uyEst = C_<T>(1, 2) * (duzvz + duzvm);
+                gradMagSqr = uxEst * uxEst + uyEst * uyEst + uzCenSqr;
+                T czm = std::exp(minusHalfParameter * gradMagSqr);
+
+                return u.uzz[x] + timeStep * (
+                    cxp * uxFwd - cxm * uxBwd +
+                    cyp * uyFwd - cym * uyBwd +
+                    czp * uzFwd - czm * uzBwd);
+            }
+
+            T invDx, invDy, invDz;
+            T halfInvDx, halfInvDy, halfInvDz;
+            T minusHalfParameter;
+            T timeStep;
+        };
+
+        inline Kernel GetKernel() const
+        {
+            return Kernel
+            {
+                this->mInvDx, this->mInvDy, this->mInvDz,
+                this->mHalfInvDx, this->mHalfInvDy, this->mHalfInvDz,
+                mMHalfParameter,
+                this->mTimeStep
+            };
+        }
+
+        virtual void OnUpdate() override
+        {
+            this->UpdateRows(GetKernel());
+        }
+
         virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) override
         {
-            this->LookUp27(x, y, z);
-
-            // one-sided U-derivative estimates
-            T uxFwd = this->mInvDx * (this->mUpzz - this->mUzzz);
-            T uxBwd = this->mInvDx * (this->mUzzz - this->mUmzz);
-            T uyFwd = this->mInvDy * (this->mUzpz - this->mUzzz);
-            T uyBwd = this->mInvDy * (this->mUzzz - this->mUzmz);
-            T uzFwd = this->mInvDz * (this->mUzzp - this->mUzzz);
-            T uzBwd = this->mInvDz * (this->mUzzz - this->mUzzm);
-
-            // centered U-derivative estimates
-            T duvzz = this->mHalfInvDx * (this->mUpzz - this->mUmzz);
-            T duvpz = this->mHalfInvDx * (this->mUppz - this->mUmpz);
-            T duvmz = this->mHalfInvDx * (this->mUpmz - this->mUmmz);
-            T duvzp = this->mHalfInvDx * (this->mUpzp - this->mUmzp);
-            T duvzm = this->mHalfInvDx * (this->mUpzm - this->mUmzm);
-
-            T duzvz = this->mHalfInvDy * (this->mUzpz - this->mUzmz);
-            T dupvz = this->mHalfInvDy * (this->mUppz - this->mUpmz);
-            T dumvz = this->mHalfInvDy * (this->mUmpz - this->mUmmz);
-            T duzvp = this->mHalfInvDy * (this->mUzpp - this->mUzmp);
-            T duzvm = this->mHalfInvDy * (this->mUzpm - this->mUzmm);
-
-            T duzzv = this->mHalfInvDz * (this->mUzzp - this->mUzzm);
-            T dupzv = this->mHalfInvDz * (this->mUpzp - this->mUpzm);
-            T dumzv = this->mHalfInvDz * (this->mUmzp - this->mUmzm);
-            T duzpv = this->mHalfInvDz * (this->mUzpp - this->mUzpm);
-            T duzmv = this->mHalfInvDz * (this->mUzmp - this->mUzmm);
-
-            T uxCenSqr = duvzz * duvzz;
-            T uyCenSqr = duzvz * duzvz;
-            T uzCenSqr = duzzv * duzzv;
-            T uxEst{}, uyEst{}, uzEst{}, gradMagSqr{};
-
-            // estimate for C(x+1,y,z)
-            uyEst = C_<T>(1, 2) * (duzvz + dupvz);
-            uzEst = C_<T>(1, 2) * (duzzv + dupzv);
-            gradMagSqr = uxCenSqr + uyEst * uyEst + uzEst * uzEst;
-            T cxp = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x-1,y,z)
-            uyEst = C_<T>(1, 2) * (duzvz + dumvz);
-            uzEst = C_<T>(1, 2) * (duzzv + dumzv);
-            gradMagSqr = uxCenSqr + uyEst * uyEst + uzEst * uzEst;
-            T cxm = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y+1,z)
-            uxEst = C_<T>(1, 2) * (duvzz + duvpz);
-            uzEst = C_<T>(1, 2) * (duzzv + duzpv);
-            gradMagSqr = uxEst * uxEst + uyCenSqr + uzEst * uzEst;
-            T cyp = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y-1,z)
-            uxEst = C_<T>(1, 2) * (duvzz + duvmz);
-            uzEst = C_<T>(1, 2) * (duzzv + duzmv);
-            gradMagSqr = uxEst * uxEst + uyCenSqr + uzEst * uzEst;
-            T cym = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y,z+1)
-            uxEst = C_<T>(1, 2) * (duvzz + duvzp);
-            uyEst = C_<T>(1, 2) * (duzvz + duzvp);
-            gradMagSqr = uxEst * uxEst + uyEst * uyEst + uzCenSqr;
-            T czp = std::exp(mMHalfParameter * gradMagSqr);
-
-            // estimate for C(x,y,z-1)
-            uxEst = C_<T>(1, 2) * (duvzz + duvzm);
-            uyEst = C_<T>(1, 2) * (duzvz + duzvm);
-            gradMagSqr = uxEst * uxEst + uyEst * uyEst + uzCenSqr;
-            T czm = std::exp(mMHalfParameter * gradMagSqr);
-
-            this->mBuffer[this->mDst](x, y, z) = this->mUzzz + this->mTimeStep * (
-                cxp * uxFwd - cxm * uxBwd +
-                cyp * uyFwd - cym * uyBwd +
-                czp * uzFwd - czm * uzBwd);
+            this->mBuffer[this->mDst](x, y, z) = GetKernel()(this->GetRows(y, z), x);
         }
 
         // These are updated on each iteration, since they depend on the
@@ -3,12 +3,14 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 #include <GTL/Mathematics/Arithmetic/Constants.h>
+#include <GTL/Mathematics/ImageProcessing/Image3.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
@@ -24,6 +26,16 @@ namespace gtl
     public:
         // In each Compute function you specify the number of buckets by
         // passing 'buckets' with the desired size().
+        //
+        // The functions that take a pointer to the samples and their number
+        // (or an Image3 whose pixels are the samples) support multithreading.
+        // If numThreads > 1, the samples are partitioned into numThreads
+        // contiguous blocks, each thread counts its block into a private
+        // array of buckets and the private arrays are summed at the end, so
+        // the threads never share a counter. The results do not depend on
+        // the number of threads. If 'pool' is not null, the tasks are
+        // executed by the pool; otherwise, std::thread objects are launched.
+        // The std::vector functions are single-threaded wrappers.
 
         // The UIntType must be one of the integer types: std::uint8_t, std::uint16_t,
         // std::uint32_t or std::uint64_t. The samples are mapped directly to the
@@ -34,6 +46,24 @@ namespace gtl
         template <typename UIntType>
         static void Compute(std::vector<std::size_t>& buckets,
             std::vector<UIntType> const& samples, std::size_t& excessGreater)
+        {
+            Compute(buckets, samples.data(), samples.size(), excessGreater);
+        }
+
+        template <typename UIntType>
+        static void Compute(std::vector<std::size_t>& buckets,
+            Image3<UIntType> const& image, std::size_t& excessGreater,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            Compute(buckets, image.data(), image.size(), excessGreater,
+                numThreads, pool);
+        }
+
+        template <typename UIntType>
+        static void Compute(std::vector<std::size_t>& buckets,
+            UIntType const* samples, std::size_t numSamples,
+            std::size_t& excessGreater, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             static_assert(
                 std::is_same<UIntType, std::uint8_t>::value ||
@@ -43,23 +73,11 @@ namespace gtl
                 "The sample type must be unsigned integer.");
 
             GTL_ARGUMENT_ASSERT(
-                buckets.size() > 0 && samples.size() > 0,
+                buckets.size() > 0 && samples != nullptr && numSamples > 0,
                 "Invalid input.");
 
-            std::fill(buckets.begin(), buckets.end(), static_cast<std::size_t>(0));
-            excessGreater = 0;
-            for (std::size_t i = 0; i < samples.size(); ++i)
-            {
-                std::size_t sample = static_cast<std::size_t>(samples[i]);
-                if (sample < buckets.size())
-                {
-                    ++buckets[sample];
-                }
-                else
-                {
-                    ++excessGreater;
-                }
-            }
+            excessGreater = Count(buckets, samples, numSamples,
+                static_cast<std::uint64_t>(0), numThreads, pool);
         }
 
         // The IntType must be one of the integer types: std::int8_t, std::int16_t,
@@ -81,6 +99,32 @@ namespace gtl
         static void Compute(std::vector<std::size_t>& buckets,
             std::vector<IntType> const& samples, IntType& minSample,
             std::size_t& excessGreater)
+        {
+            Compute(buckets, samples.data(), samples.size(), minSample,
+                excessGreater);
+        }
+
+        // The signed overloads that accept a thread count are restricted to
+        // signed types. Without the restriction, a call of the unsigned
+        // overload for std::uint64_t samples with an lvalue thread count
+        // would also match the signed overload.
+        template <typename IntType>
+        static typename std::enable_if<std::is_signed<IntType>::value>::type
+        Compute(std::vector<std::size_t>& buckets,
+            Image3<IntType> const& image, IntType& minSample,
+            std::size_t& excessGreater, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            Compute(buckets, image.data(), image.size(), minSample,
+                excessGreater, numThreads, pool);
+        }
+
+        template <typename IntType>
+        static typename std::enable_if<std::is_signed<IntType>::value>::type
+        Compute(std::vector<std::size_t>& buckets,
+            IntType const* samples, std::size_t numSamples, IntType& minSample,
+            std::size_t& excessGreater, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             static_assert(
                 std::is_same<IntType, std::int8_t>::value ||
@@ -90,37 +134,27 @@ namespace gtl
                 "The sample type must be signed integer.");
 
             GTL_ARGUMENT_ASSERT(
-                buckets.size() > 0 && samples.size() > 0,
+                buckets.size() > 0 && samples != nullptr && numSamples > 0,
                 "Invalid input.");
 
-            minSample = std::numeric_limits<IntType>::max();
-            for (std::size_t i = 0; i < samples.size(); ++i)
-            {
-                IntType sample = samples[i];
-                if (sample < minSample)
-                {
-                    minSample = sample;
-                }
-            }
-            if (minSample > 0)
+            numThreads = std::max(std::min(numThreads, numSamples), static_cast<std::size_t>(1));
+            std::vector<IntType> taskMinimum(numThreads);
+            RunTasks(pool, numThreads, [&](std::size_t t)
             {
-                minSample = 0;
-            }
+                std::size_t imin = 0, isup = 0;
+                GetRange(t, numThreads, numSamples, imin, isup);
+                taskMinimum[t] = *std::min_element(samples + imin, samples + isup);
+            });
 
-            std::fill(buckets.begin(), buckets.end(), static_cast<std::size_t>(0));
-            excessGreater = 0;
-            for (std::size_t i = 0; i < samples.size(); ++i)
-            {
-                std::size_t translatedSample = static_cast<std::size_t>(samples[i] + minSample);
-                if (translatedSample < buckets.size())
-                {
-                    ++buckets[translatedSample];
-                }
-                else
-                {
-                    ++excessGreater;
-                }
-            }
+            minSample = std::min(*std::min_element(taskMinimum.begin(), taskMinimum.end()),
+                static_cast<IntType>(0));
+
+            // The translation samples[i] - minSample is computed in unsigned
+            // 64-bit arithmetic. Because minSample <= samples[i], the result
+            // is the nonnegative difference even when it is not representable
+            // by IntType.
+            excessGreater = Count(buckets, samples, numSamples,
+                static_cast<std::uint64_t>(minSample), numThreads, pool);
         }
 
         // The FloatType must be a floating-point type: float, double or long
@@ -165,7 +199,7 @@ namespace gtl
                     FloatType unit = (samples[i] - smin) / denom;
                     unit = std::max(unit, C_<FloatType>(0));
                     unit = std::min(unit, C_<FloatType>(1));
-                    std::size_t index = static_cast<std::size_t>(numer * (samples[i] - smin));
+                    std::size_t index = static_cast<std::size_t>(numer * unit);
                     index = std::min(index, maxIndex);
                     ++buckets[index];
                 }
@@ -257,10 +291,10 @@ namespace gtl
             std::size_t hUpperSum = 0;
             for (std::size_t i = 0, j = buckets.size() - 1; i < buckets.size(); ++i, --j)
             {
-                hUpperSum += buckets[i];
+                hUpperSum += buckets[j];
                 if (hUpperSum >= hTailSum)
                 {
-                    pair.second = i;
+                    pair.second = j;
                     break;
                 }
             }
@@ -268,7 +302,153 @@ namespace gtl
             return pair;
         }
 
+        // The tail queries above sum the buckets on each call. For repeated
+        // queries of the same histogram, for example the lower and upper
+        // cutoffs of an auto-contrast window, compute the cumulative
+        // distribution once with cdf[i] = cdf(i) and then query it. Each
+        // query is a binary search over the buckets, so it costs
+        // O(log(B)) and never touches the samples.
+        static void ComputeCDF(std::vector<std::size_t> const& buckets,
+            std::vector<std::size_t>& cdf)
+        {
+            GTL_ARGUMENT_ASSERT(
+                buckets.size() > 0,
+                "Invalid input.");
+
+            cdf.resize(buckets.size());
+            std::size_t sum = 0;
+            for (std::size_t i = 0; i < buckets.size(); ++i)
+            {
+                sum += buckets[i];
+                cdf[i] = sum;
+            }
+        }
+
+        // Get the fraction of samples whose bucket index is at most i,
+        // cdf(i)/N, or 0 when N is 0.
+        static double GetCDF(std::vector<std::size_t> const& cdf, std::size_t i)
+        {
+            GTL_ARGUMENT_ASSERT(
+                cdf.size() > 0 && i < cdf.size(),
+                "Invalid input.");
+
+            std::size_t const total = cdf.back();
+            return (total > 0 ? static_cast<double>(cdf[i]) / static_cast<double>(total) : 0.0);
+        }
+
+        // Get the bucket index of a percentile, where 0 <= fraction <= 1.
+        // The returned index P is the smallest index for which
+        // cdf(P) >= floor(fraction*N), which is the index returned by
+        // GetLowerTail(buckets, fraction). The upper tail of amount t is
+        // obtained by GetPercentile(cdf, 1 - t).
+        static std::size_t GetPercentile(std::vector<std::size_t> const& cdf, double fraction)
+        {
+            GTL_ARGUMENT_ASSERT(
+                cdf.size() > 0 && fraction >= 0.0 && fraction <= 1.0,
+                "Invalid input.");
+
+            std::size_t const target = static_cast<std::size_t>(
+                fraction * static_cast<double>(cdf.back()));
+            auto iter = std::lower_bound(cdf.begin(), cdf.end(), target);
+            return static_cast<std::size_t>(iter - cdf.begin());
+        }
+
     private:
+        // Partition {0..numSamples-1} into numTasks contiguous blocks. Every
+        // block except the last has numSamples/numTasks samples.
+        static void GetRange(std::size_t t, std::size_t numTasks, std::size_t numSamples,
+            std::size_t& imin, std::size_t& isup)
+        {
+            std::size_t const load = numSamples / numTasks;
+            imin = t * load;
+            isup = (t + 1 < numTasks ? imin + load : numSamples);
+        }
+
+        template <typename Task>
+        static void RunTasks(ThreadPool* pool, std::size_t numTasks, Task const& task)
+        {
+            if (numTasks > 1)
+            {
+                ForkJoin(pool, numTasks, task);
+            }
+            else
+            {
+                task(0);
+            }
+        }
+
+        // Count samples[i] - offset into the buckets and return the number
+        // of out-of-range samples. Each task counts into a private array of
+        // buckets. Two interleaved arrays are used within a task, the even
+        // samples counted in one and the odd samples in the other.
+        // Consecutive samples of a volume often have the same value, and with
+        // a single array each increment would wait for the previous increment
+        // of the same counter to be stored. Two arrays halve the length of
+        // those dependency chains while keeping the counters for 12-bit data
+        // within the L1 cache.
+        template <typename SampleType>
+        static std::size_t Count(std::vector<std::size_t>& buckets,
+            SampleType const* samples, std::size_t numSamples,
+            std::uint64_t offset, std::size_t numThreads, ThreadPool* pool)
+        {
+            std::size_t const numBuckets = buckets.size();
+            std::uint64_t const maxIndex = static_cast<std::uint64_t>(numBuckets);
+            std::size_t const numTasks = std::max(std::min(numThreads, numSamples),
+                static_cast<std::size_t>(1));
+
+            std::vector<std::size_t> counters(2 * numTasks * numBuckets, 0);
+            std::vector<std::size_t> excess(numTasks, 0);
+            RunTasks(pool, numTasks, [&](std::size_t t)
+            {
+                std::size_t imin = 0, isup = 0;
+                GetRange(t, numTasks, numSamples, imin, isup);
+
+                std::size_t* even = counters.data() + 2 * t * numBuckets;
+                std::size_t* odd = even + numBuckets;
+                std::size_t numExcess = 0;
+                auto Increment = [offset, maxIndex, &numExcess](std::size_t* lane, SampleType sample)
+                {
+                    std::uint64_t index = static_cast<std::uint64_t>(sample) - offset;
+                    if (index < maxIndex)
+                    {
+                        ++lane[static_cast<std::size_t>(index)];
+                    }
+                    else
+                    {
+                        ++numExcess;
+                    }
+                };
+
+                std::size_t i = imin;
+                for (; i + 2 <= isup; i += 2)
+                {
+                    Increment(even, samples[i]);
+                    Increment(odd, samples[i + 1]);
+                }
+                if (i < isup)
+                {
+                    Increment(even, samples[i]);
+                }
+                excess[t] = numExcess;
+            });
+
+            std::copy(counters.begin(), counters.begin() + numBuckets, buckets.begin());
+            std::size_t excessGreater = excess[0];
+            for (std::size_t j = 1; j < 2 * numTasks; ++j)
+            {
+                std::size_t const* laneCounters = counters.data() + j * numBuckets;
+                for (std::size_t k = 0; k < numBuckets; ++k)
+                {
+                    buckets[k] += laneCounters[k];
+                }
+            }
+            for (std::size_t t = 1; t < numTasks; ++t)
+            {
+                excessGreater += excess[t];
+            }
+            return excessGreater;
+        }
+
         friend class UnitTestHistogram;
     };
 }
@@ -0,0 +1,214 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// An image whose pixels are stored in a raw file that is mapped into memory,
+// so the image does not need to be resident in RAM. The operating system
+// reads pages of the file on demand and writes modified pages back to it.
+// The file consists of an optional header of 'headerBytes' bytes followed by
+// the pixels in native byte order, stored in the same left-to-right order
+// used by Image2 and Image3. The pixel indexing is that of Lattice<true>,
+// which is the indexing of Multiarray<PixelType, true>, so algorithms that
+// accept raw pixel pointers can be passed data() without making a copy.
+//
+// Processing a volume that is larger than physical memory is efficient when
+// the algorithm sweeps through the volume in the order the pixels are
+// stored. Use Advise to tell the operating system about the sweep so that
+// it reads ahead and releases the pixels that were already processed.
+//
+// The header includes operating system headers through MappedFile.h. Read
+// the comments in that file about <windows.h>.
+
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/Lattice.h>
+#include <GTL/Utility/MappedFile.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtl
+{
+    template <typename PixelType>
+    class MappedImage : public Lattice<true>
+    {
+    public:
+        static_assert(
+            std::is_trivially_copyable<PixelType>::value,
+            "The pixels are stored as raw bytes.");
+
+        using Access = MappedFile::Access;
+        using Advice = MappedFile::Advice;
+
+        // The image is not mapped. Call Open to map a file.
+        MappedImage()
+            :
+            Lattice<true>{},
+            mFile{},
+            mPixels(nullptr)
+        {
+        }
+
+        ~MappedImage() = default;
+
+        // A mapping has a unique owner, so copy semantics are disabled.
+        MappedImage(MappedImage const&) = delete;
+        MappedImage& operator=(MappedImage const&) = delete;
+
+        // Move semantics.
+        MappedImage(MappedImage&& other) noexcept
+            :
+            Lattice<true>{},
+            mFile{},
+            mPixels(nullptr)
+        {
+            *this = std::move(other);
+        }
+
+        MappedImage& operator=(MappedImage&& other) noexcept
+        {
+            (void)Lattice<true>::operator=(std::move(other));
+            mFile = std::move(other.mFile);
+            mPixels = other.mPixels;
+            other.mPixels = nullptr;
+            return *this;
+        }
+
+        // Map the file for an image with the specified bounds. For CREATE,
+        // the file is created with headerBytes zero-valued header bytes and
+        // zero-valued pixels. Otherwise, the file must have at least
+        // headerBytes + size() * sizeof(PixelType) bytes. The header size
+        // must be a multiple of the alignment of PixelType.
+        void Open(std::string const& filename, Access access,
+            std::vector<std::size_t> const& sizes, std::size_t headerBytes = 0)
+        {
+            GTL_ARGUMENT_ASSERT(
+                headerBytes % alignof(PixelType) == 0,
+                "Invalid header size.");
+
+            Close();
+            Lattice<true>::resize(sizes);
+
+            std::size_t const numPixels = Lattice<true>::size();
+            GTL_ARGUMENT_ASSERT(
+                numPixels > 0,
+                "Invalid image bounds.");
+
+            GTL_LENGTH_ASSERT(
+                numPixels <= ((std::numeric_limits<std::size_t>::max)() - headerBytes) / sizeof(PixelType),
+                "The image is too large for the address space.");
+
+            std::size_t const numBytes = headerBytes + numPixels * sizeof(PixelType);
+            mFile.Open(filename, access, numBytes);
+            mPixels = reinterpret_cast<PixelType*>(mFile.data() + headerBytes);
+        }
+
+        // Unmap the file. Call Flush first if the file must be up to date
+        // when Close returns.
+        void Close() noexcept
+        {
+            mFile.Close();
+            mPixels = nullptr;
+            (void)Lattice<true>::operator=(Lattice<true>{});
+        }
+
+        inline bool IsOpen() const noexcept
+        {
+            return mPixels != nullptr;
+        }
+
+        inline bool IsWritable() const noexcept
+        {
+            return mFile.IsWritable();
+        }
+
+        // Get a pointer to the array of pixels. Writing through the pointer
+        // is allowed only when IsWritable() is true.
+        inline PixelType const* data() const noexcept
+        {
+            return mPixels;
+        }
+
+        inline PixelType* data() noexcept
+        {
+            return mPixels;
+        }
+
+        // Access the pixel at the specified index.
+        inline PixelType const& operator[](std::size_t i) const
+        {
+            return mPixels[i];
+        }
+
+        inline PixelType& operator[](std::size_t i)
+        {
+            return mPixels[i];
+        }
+
+        // Get the pixel corresponding to the tuple of indices.
+        template <typename... IndexTypes>
+        PixelType const& operator()(IndexTypes... ntuple) const
+        {
+            return mPixels[this->index(ntuple...)];
+        }
+
+        template <typename... IndexTypes>
+        PixelType& operator()(IndexTypes... ntuple)
+        {
+            return mPixels[this->index(ntuple...)];
+        }
+
+        // Set all pixels to the specified value.
+        inline void fill(PixelType const& value)
+        {
+            std::fill(mPixels, mPixels + Lattice<true>::size(), value);
+        }
+
+        // Write the modified pixels with indices in [iMin,iSup) to the file
+        // and wait for the writes to finish.
+        void Flush(std::size_t iMin, std::size_t iSup)
+        {
+            if (iMin < iSup)
+            {
+                mFile.Flush(GetOffset(iMin), (iSup - iMin) * sizeof(PixelType));
+            }
+        }
+
+        void Flush()
+        {
+            mFile.Flush();
+        }
+
+        // Give the operating system a hint about how the pixels with
+        // indices in [iMin,iSup) will be accessed.
+        void Advise(std::size_t iMin, std::size_t iSup, Advice advice)
+        {
+            if (iMin < iSup)
+            {
+                mFile.Advise(GetOffset(iMin), (iSup - iMin) * sizeof(PixelType), advice);
+            }
+        }
+
+    protected:
+        inline std::size_t GetOffset(std::size_t i) const
+        {
+            return static_cast<std::size_t>(
+                reinterpret_cast<std::uint8_t const*>(mPixels + i) - mFile.data());
+        }
+
+        MappedFile mFile;
+        PixelType* mPixels;
+
+    private:
+        friend class UnitTestMappedImage;
+    };
+}
@@ -0,0 +1,77 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// A 2D image whose pixels are stored in a memory-mapped raw file; see the
+// comments in MappedImage.h. The pixel (x,y) has index x + bound0 * y,
+// which is the indexing of Image2, so the functions that accept raw pixel
+// pointers (FastGaussianBlur2, Morphology and the CurveExtractor classes)
+// process the mapped pixels in place.
+
+#include <GTL/Mathematics/ImageProcessing/MappedImage.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace gtl
+{
+    template <typename PixelType>
+    class MappedImage2 : public MappedImage<PixelType>
+    {
+    public:
+        using Access = typename MappedImage<PixelType>::Access;
+        using Advice = typename MappedImage<PixelType>::Advice;
+
+        MappedImage2() = default;
+        ~MappedImage2() = default;
+
+        MappedImage2(std::string const& filename, Access access, std::size_t bound0,
+            std::size_t bound1, std::size_t headerBytes = 0)
+            :
+            MappedImage<PixelType>{}
+        {
+            Open(filename, access, bound0, bound1, headerBytes);
+        }
+
+        MappedImage2(MappedImage2&&) noexcept = default;
+        MappedImage2& operator=(MappedImage2&&) noexcept = default;
+
+        void Open(std::string const& filename, Access access, std::size_t bound0,
+            std::size_t bound1, std::size_t headerBytes = 0)
+        {
+            MappedImage<PixelType>::Open(filename, access, { bound0, bound1 },
+                headerBytes);
+        }
+
+        // Get a pointer to the first pixel of row y. The row has size(0)
+        // pixels.
+        inline PixelType const* GetRow(std::size_t y) const
+        {
+            return this->mPixels + y * this->size(0);
+        }
+
+        inline PixelType* GetRow(std::size_t y)
+        {
+            return this->mPixels + y * this->size(0);
+        }
+
+        // Hints and flushes for the rows y in [ymin,ysup).
+        void AdviseRows(std::size_t ymin, std::size_t ysup, Advice advice)
+        {
+            this->Advise(ymin * this->size(0), ysup * this->size(0), advice);
+        }
+
+        void FlushRows(std::size_t ymin, std::size_t ysup)
+        {
+            this->Flush(ymin * this->size(0), ysup * this->size(0));
+        }
+
+    private:
+        friend class UnitTestMappedImage2;
+    };
+}
@@ -0,0 +1,100 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// A 3D image whose voxels are stored in a memory-mapped raw file; see the
+// comments in MappedImage.h. The voxel (x,y,z) has index
+// x + bound0 * (y + bound1 * z), which is the indexing of Image3, so the
+// functions that accept raw voxel pointers (FastGaussianBlur3 and
+// Morphology) process the mapped voxels in place. SurfaceExtractor*::
+// ExtractSlabs reads the image one slice at a time, for which GetSlice is
+// the natural callback, and it stores only the slabs in memory. PDEFilter3
+// reads the voxels from the mapping, but it stores its padded working
+// images in memory. AdviseSlices releases or prefetches whole slices.
+
+#include <GTL/Mathematics/ImageProcessing/MappedImage.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace gtl
+{
+    template <typename PixelType>
+    class MappedImage3 : public MappedImage<PixelType>
+    {
+    public:
+        using Access = typename MappedImage<PixelType>::Access;
+        using Advice = typename MappedImage<PixelType>::Advice;
+
+        MappedImage3() = default;
+        ~MappedImage3() = default;
+
+        MappedImage3(std::string const& filename, Access access, std::size_t bound0,
+            std::size_t bound1, std::size_t bound2, std::size_t headerBytes = 0)
+            :
+            MappedImage<PixelType>{}
+        {
+            Open(filename, access, bound0, bound1, bound2, headerBytes);
+        }
+
+        MappedImage3(MappedImage3&&) noexcept = default;
+        MappedImage3& operator=(MappedImage3&&) noexcept = default;
+
+        void Open(std::string const& filename, Access access, std::size_t bound0,
+            std::size_t bound1, std::size_t bound2, std::size_t headerBytes = 0)
+        {
+            MappedImage<PixelType>::Open(filename, access, { bound0, bound1, bound2 },
+                headerBytes);
+        }
+
+        // Get a pointer to the first voxel of slice z. The slice has
+        // size(0) * size(1) voxels.
+        inline PixelType const* GetSlice(std::size_t z) const
+        {
+            return this->mPixels + z * GetSliceSize();
+        }
+
+        inline PixelType* GetSlice(std::size_t z)
+        {
+            return this->mPixels + z * GetSliceSize();
+        }
+
+        // Copy slice z to 'slice', which must have size(0) * size(1)
+        // elements. This has the signature of the GetSlice callback of
+        // SurfaceExtractor::ExtractSlabs after conversion of the voxels.
+        template <typename OutputType>
+        void GetSlice(std::size_t z, OutputType* slice) const
+        {
+            PixelType const* source = GetSlice(z);
+            std::size_t const sliceSize = GetSliceSize();
+            for (std::size_t i = 0; i < sliceSize; ++i)
+            {
+                slice[i] = static_cast<OutputType>(source[i]);
+            }
+        }
+
+        // Hints and flushes for the slices z in [zmin,zsup).
+        void AdviseSlices(std::size_t zmin, std::size_t zsup, Advice advice)
+        {
+            this->Advise(zmin * GetSliceSize(), zsup * GetSliceSize(), advice);
+        }
+
+        void FlushSlices(std::size_t zmin, std::size_t zsup)
+        {
+            this->Flush(zmin * GetSliceSize(), zsup * GetSliceSize());
+        }
+
+    private:
+        inline std::size_t GetSliceSize() const
+        {
+            return this->size(0) * this->size(1);
+        }
+
+        friend class UnitTestMappedImage3;
+    };
+}
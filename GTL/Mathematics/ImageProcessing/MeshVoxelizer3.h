@@ -0,0 +1,372 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// MeshVoxelizer3 rasterizes a triangle mesh into a 3D image. The vertices
+// are in voxel coordinates, where voxel (x,y,z) is the cube of side length 1
+// centered at (x,y,z). The voxels are reported as spans S(y, z, x0, x1) in
+// the form of the Rasterize3 span functions, which visit the voxels (x,y,z)
+// for x0 <= x <= x1. The spans are clipped to the image. The Draw functions
+// write the spans directly into the rows of an Image3.
+//
+// The surface voxels are those whose cubes intersect a triangle. For each
+// row (y,z) of voxels overlapped by the bounding box of a triangle, the
+// triangle is clipped to the slab |Y-y| <= 1/2, |Z-z| <= 1/2. The clipped
+// polygon is convex, so the voxels of the row that it intersects form a
+// single span. The spans of different triangles can overlap.
+//
+// The solid voxels are those whose centers are inside a closed mesh. The
+// line through the centers of the row (y,z) is parallel to the x-axis. Its
+// crossings with the triangles are sorted by x, and the voxels between
+// crossings 2k and 2k+1 are inside. A line that passes through an edge or a
+// vertex shared by triangles is counted once. The edge functions of the
+// triangles projected onto the yz-plane are computed with the endpoints in
+// a canonical order, so the triangles sharing an edge have edge functions
+// that are exact negations, and a zero edge function is resolved by the
+// top-left rule. The triangles need not be consistently ordered.
+//
+// The voxelizer shares the span interface of Rasterize3, so one visitor can
+// receive the spans of both, but it does not call the Rasterize3 drawing
+// functions. Those draw lines and boxes between integer voxel coordinates.
+// The mesh vertices are floating-point, and the voxels of a triangle cannot
+// be obtained from lines between rounded vertices: the rounding moves the
+// triangle, lines do not cover its interior without gaps, and the inside
+// test of a closed mesh needs the exact crossing positions.
+
+#include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Mathematics/ImageProcessing/Image3.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace gtl
+{
+    template <typename T>
+    class MeshVoxelizer3
+    {
+    public:
+        template <typename SpanVisitor>
+        static void GetSurfaceSpans(std::vector<Vector3<T>> const& vertices,
+            std::vector<std::array<std::size_t, 3>> const& triangles,
+            std::size_t xBound, std::size_t yBound, std::size_t zBound,
+            SpanVisitor const& S)
+        {
+            static_assert(std::is_floating_point<T>::value,
+                "The template type must be 'float' or 'double'.");
+
+            T const half = static_cast<T>(0.5);
+            Polygon triangle{}, temp{}, zClipped{}, yClipped{};
+            for (auto const& tri : triangles)
+            {
+                Vector3<T> vmin{}, vmax{};
+                GetExtremes(vertices, tri, vmin, vmax);
+
+                std::size_t x0{}, x1{}, y0{}, y1{}, z0{}, z1{};
+                if (!GetRange(vmin[0] - half, vmax[0] + half, xBound, x0, x1) ||
+                    !GetRange(vmin[1] - half, vmax[1] + half, yBound, y0, y1) ||
+                    !GetRange(vmin[2] - half, vmax[2] + half, zBound, z0, z1))
+                {
+                    continue;
+                }
+
+                triangle.numVertices = 3;
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    triangle.vertices[i] = vertices[tri[i]];
+                }
+
+                for (std::size_t z = z0; z <= z1; ++z)
+                {
+                    T zValue = static_cast<T>(z);
+                    Clip(triangle, 2, zValue - half, false, temp);
+                    Clip(temp, 2, zValue + half, true, zClipped);
+                    if (zClipped.numVertices == 0)
+                    {
+                        continue;
+                    }
+
+                    for (std::size_t y = y0; y <= y1; ++y)
+                    {
+                        T yValue = static_cast<T>(y);
+                        Clip(zClipped, 1, yValue - half, false, temp);
+                        Clip(temp, 1, yValue + half, true, yClipped);
+                        if (yClipped.numVertices == 0)
+                        {
+                            continue;
+                        }
+
+                        T xmin = yClipped.vertices[0][0], xmax = xmin;
+                        for (std::size_t i = 1; i < yClipped.numVertices; ++i)
+                        {
+                            xmin = std::min(xmin, yClipped.vertices[i][0]);
+                            xmax = std::max(xmax, yClipped.vertices[i][0]);
+                        }
+
+                        std::size_t xSpanMin{}, xSpanMax{};
+                        if (GetRange(xmin - half, xmax + half, xBound, xSpanMin, xSpanMax))
+                        {
+                            S(y, z, xSpanMin, xSpanMax);
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename SpanVisitor>
+        static void GetSolidSpans(std::vector<Vector3<T>> const& vertices,
+            std::vector<std::array<std::size_t, 3>> const& triangles,
+            std::size_t xBound, std::size_t yBound, std::size_t zBound,
+            SpanVisitor const& S)
+        {
+            static_assert(std::is_floating_point<T>::value,
+                "The template type must be 'float' or 'double'.");
+
+            // Compute the crossings of the rows with the triangles.
+            std::vector<Crossing> crossings{};
+            for (auto const& tri : triangles)
+            {
+                Vector3<T> vmin{}, vmax{};
+                GetExtremes(vertices, tri, vmin, vmax);
+
+                std::size_t y0{}, y1{}, z0{}, z1{};
+                if (!GetRange(vmin[1], vmax[1], yBound, y0, y1) ||
+                    !GetRange(vmin[2], vmax[2], zBound, z0, z1))
+                {
+                    continue;
+                }
+
+                // Order the vertices counterclockwise in the yz-plane.
+                std::array<Vector3<T> const*, 3> v =
+                {
+                    &vertices[tri[0]], &vertices[tri[1]], &vertices[tri[2]]
+                };
+                T area = Orient(*v[0], *v[1], (*v[2])[1], (*v[2])[2]);
+                if (area == static_cast<T>(0))
+                {
+                    // The triangle is parallel to the x-axis.
+                    continue;
+                }
+                if (area < static_cast<T>(0))
+                {
+                    std::swap(v[1], v[2]);
+                }
+
+                std::array<bool, 3> topLeft{};
+                for (std::size_t i0 = 0; i0 < 3; ++i0)
+                {
+                    Vector3<T> const& a = *v[(i0 + 1) % 3];
+                    Vector3<T> const& b = *v[(i0 + 2) % 3];
+                    T du = b[1] - a[1], dv = b[2] - a[2];
+                    topLeft[i0] = (dv < static_cast<T>(0) ||
+                        (dv == static_cast<T>(0) && du > static_cast<T>(0)));
+                }
+
+                for (std::size_t z = z0; z <= z1; ++z)
+                {
+                    T zValue = static_cast<T>(z);
+                    for (std::size_t y = y0; y <= y1; ++y)
+                    {
+                        T yValue = static_cast<T>(y);
+                        std::array<T, 3> e{};
+                        bool inside = true;
+                        for (std::size_t i0 = 0; i0 < 3 && inside; ++i0)
+                        {
+                            e[i0] = GetEdgeFunction(*v[(i0 + 1) % 3], *v[(i0 + 2) % 3],
+                                yValue, zValue);
+                            inside = (e[i0] > static_cast<T>(0) ||
+                                (e[i0] == static_cast<T>(0) && topLeft[i0]));
+                        }
+
+                        if (inside)
+                        {
+                            T sum = e[0] + e[1] + e[2];
+                            T x = (e[0] * (*v[0])[0] + e[1] * (*v[1])[0] + e[2] * (*v[2])[0]) / sum;
+                            crossings.push_back({ y + yBound * z, x });
+                        }
+                    }
+                }
+            }
+
+            std::sort(crossings.begin(), crossings.end(),
+                [](Crossing const& c0, Crossing const& c1)
+                {
+                    return c0.row < c1.row || (c0.row == c1.row && c0.x < c1.x);
+                });
+
+            // The voxels (x,y,z) with crossing[2k].x <= x < crossing[2k+1].x
+            // are inside the mesh.
+            std::size_t const numCrossings = crossings.size();
+            for (std::size_t k = 0; k + 1 < numCrossings; )
+            {
+                std::size_t const row = crossings[k].row;
+                if (crossings[k + 1].row != row)
+                {
+                    // An unpaired crossing occurs only when the mesh is
+                    // not closed.
+                    ++k;
+                    continue;
+                }
+
+                T xmin = std::ceil(crossings[k].x);
+                T xmax = std::ceil(crossings[k + 1].x) - static_cast<T>(1);
+                std::size_t xSpanMin{}, xSpanMax{};
+                if (GetRange(xmin, xmax, xBound, xSpanMin, xSpanMax))
+                {
+                    S(row % yBound, row / yBound, xSpanMin, xSpanMax);
+                }
+                k += 2;
+            }
+        }
+
+        // Set the surface voxels of the image to 'value'.
+        template <typename VoxelType>
+        static void DrawSurface(std::vector<Vector3<T>> const& vertices,
+            std::vector<std::array<std::size_t, 3>> const& triangles,
+            VoxelType const& value, Image3<VoxelType>& image)
+        {
+            std::size_t const xBound = image.size(0);
+            std::size_t const yBound = image.size(1);
+            VoxelType* voxels = image.data();
+            GetSurfaceSpans(vertices, triangles, xBound, yBound, image.size(2),
+                [xBound, yBound, voxels, &value](std::size_t y, std::size_t z,
+                    std::size_t x0, std::size_t x1)
+                {
+                    VoxelType* row = voxels + xBound * (y + yBound * z);
+                    std::fill(row + x0, row + x1 + 1, value);
+                });
+        }
+
+        // Set the solid voxels of the image to 'value'. The mesh must be
+        // closed.
+        template <typename VoxelType>
+        static void DrawSolid(std::vector<Vector3<T>> const& vertices,
+            std::vector<std::array<std::size_t, 3>> const& triangles,
+            VoxelType const& value, Image3<VoxelType>& image)
+        {
+            std::size_t const xBound = image.size(0);
+            std::size_t const yBound = image.size(1);
+            VoxelType* voxels = image.data();
+            GetSolidSpans(vertices, triangles, xBound, yBound, image.size(2),
+                [xBound, yBound, voxels, &value](std::size_t y, std::size_t z,
+                    std::size_t x0, std::size_t x1)
+                {
+                    VoxelType* row = voxels + xBound * (y + yBound * z);
+                    std::fill(row + x0, row + x1 + 1, value);
+                });
+        }
+
+    private:
+        // A triangle clipped by 4 planes has at most 7 vertices.
+        struct Polygon
+        {
+            std::size_t numVertices;
+            std::array<Vector3<T>, 8> vertices;
+        };
+
+        struct Crossing
+        {
+            std::size_t row;
+            T x;
+        };
+
+        static void GetExtremes(std::vector<Vector3<T>> const& vertices,
+            std::array<std::size_t, 3> const& tri, Vector3<T>& vmin, Vector3<T>& vmax)
+        {
+            vmin = vertices[tri[0]];
+            vmax = vmin;
+            for (std::size_t i = 1; i < 3; ++i)
+            {
+                Vector3<T> const& vertex = vertices[tri[i]];
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    vmin[j] = std::min(vmin[j], vertex[j]);
+                    vmax[j] = std::max(vmax[j], vertex[j]);
+                }
+            }
+        }
+
+        // Compute the integers i in [0,bound) with tmin <= i <= tmax. The
+        // function returns false when there are none.
+        static bool GetRange(T const& tmin, T const& tmax, std::size_t bound,
+            std::size_t& imin, std::size_t& imax)
+        {
+            if (bound == 0 || tmax < static_cast<T>(0) ||
+                tmin > static_cast<T>(bound - 1) || tmin > tmax)
+            {
+                return false;
+            }
+
+            T cmin = std::ceil(std::max(tmin, static_cast<T>(0)));
+            T fmax = std::floor(std::min(tmax, static_cast<T>(bound - 1)));
+            if (cmin > fmax)
+            {
+                return false;
+            }
+            imin = static_cast<std::size_t>(cmin);
+            imax = static_cast<std::size_t>(fmax);
+            return true;
+        }
+
+        // Keep the part of the polygon with p[axis] >= value (upper is
+        // false) or p[axis] <= value (upper is true).
+        static void Clip(Polygon const& input, std::size_t axis, T const& value,
+            bool upper, Polygon& output)
+        {
+            output.numVertices = 0;
+            std::size_t const numVertices = input.numVertices;
+            for (std::size_t i0 = numVertices - 1, i1 = 0; i1 < numVertices; i0 = i1++)
+            {
+                Vector3<T> const& p0 = input.vertices[i0];
+                Vector3<T> const& p1 = input.vertices[i1];
+                T d0 = (upper ? value - p0[axis] : p0[axis] - value);
+                T d1 = (upper ? value - p1[axis] : p1[axis] - value);
+                bool in0 = (d0 >= static_cast<T>(0));
+                bool in1 = (d1 >= static_cast<T>(0));
+                if (in0 != in1)
+                {
+                    T t = d0 / (d0 - d1);
+                    output.vertices[output.numVertices++] = p0 + t * (p1 - p0);
+                }
+                if (in1)
+                {
+                    output.vertices[output.numVertices++] = p1;
+                }
+            }
+        }
+
+        // The orientation of (a,b,q) projected onto the yz-plane. It is
+        // positive when the points are counterclockwise.
+        static T Orient(Vector3<T> const& a, Vector3<T> const& b, T const& qy, T const& qz)
+        {
+            return (b[1] - a[1]) * (qz - a[2]) - (b[2] - a[2]) * (qy - a[1]);
+        }
+
+        // The orientation computed with the endpoints of the edge in
+        // lexicographical order, so the edge functions for the two
+        // directions of an edge are exact negations.
+        static T GetEdgeFunction(Vector3<T> const& a, Vector3<T> const& b,
+            T const& qy, T const& qz)
+        {
+            if (a[1] < b[1] || (a[1] == b[1] && a[2] < b[2]))
+            {
+                return Orient(a, b, qy, qz);
+            }
+            else
+            {
+                return -Orient(b, a, qy, qz);
+            }
+        }
+
+    private:
+        friend class UnitTestMeshVoxelizer3;
+    };
+}
@@ -3,16 +3,21 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.08.07
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Morphological operations on images. Class Morphology is the abstract base
 // class for Morphology2 and Morphology3.
 
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -103,7 +108,812 @@ namespace gtl
             }
         }
 
+        // The remaining functions operate on an image with dimensions
+        // xSize, ySize and zSize stored in lexicographical order, the index
+        // of voxel (x,y,z) being x + xSize * (y + ySize * z). Morphology2
+        // passes a 2D image as xSize-by-1-by-ySize so that the z-direction
+        // is the direction in which the work is partitioned. The neighbor
+        // offsets are triples (dx,dy,dz). If numThreads > 1, the work is
+        // partitioned among the threads and the output does not depend on
+        // the number of threads. If 'pool' is not null, the tasks are
+        // executed by the pool; otherwise, std::thread objects are launched.
+
+        // Connected component labeling using union-find. The image is binary
+        // with 0 for background and nonzero for foreground. On output, the
+        // foreground values are the component labels 1 through the returned
+        // number of components. The labels are assigned in the order of the
+        // first voxel of each component, which is the order produced by the
+        // depth-first GetComponents function. Unlike that function, the
+        // image does not need a background border.
+        //
+        // This is the classical two-pass algorithm. The first pass labels
+        // each z-slab independently, storing provisional labels in the image
+        // and their equivalences in a union-find table for the slab. The
+        // tables are concatenated, the slabs are joined at their boundary
+        // planes, and the second pass replaces the provisional labels by the
+        // final labels. The join and the resolution of the table are the
+        // only serial steps; both are proportional to the number of boundary
+        // voxels and provisional labels rather than to the number of voxels.
+        static std::size_t LabelComponents(
+            std::size_t xSize, std::size_t ySize, std::size_t zSize,
+            SInteger* image,
+            std::size_t numNeighbors,
+            std::array<OffsetType, 3> const* neighbors,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            std::size_t const planeSize = xSize * ySize;
+            std::size_t const numVoxels = planeSize * zSize;
+            GTL_ARGUMENT_ASSERT(
+                numVoxels > 0 && image != nullptr &&
+                numNeighbors > 0 && neighbors != nullptr,
+                "Invalid argument.");
+
+            GTL_ARGUMENT_ASSERT(
+                numVoxels < static_cast<std::size_t>(std::numeric_limits<SInteger>::max()),
+                "The image is too large for the label type.");
+
+            // Only the neighbors that precede a voxel in lexicographical
+            // order are visited. The neighborhoods are symmetric, so every
+            // adjacent pair is visited once.
+            OffsetType const xDim = static_cast<OffsetType>(xSize);
+            OffsetType const yDim = static_cast<OffsetType>(ySize);
+            std::vector<std::array<OffsetType, 3>> causal{};
+            std::vector<OffsetType> causalOffset{};
+            std::array<OffsetType, 3> reach{ 0, 0, 0 };
+            for (std::size_t j = 0; j < numNeighbors; ++j)
+            {
+                std::array<OffsetType, 3> const& d = neighbors[j];
+                if (d[2] < 0 || (d[2] == 0 && (d[1] < 0 || (d[1] == 0 && d[0] < 0))))
+                {
+                    causal.push_back(d);
+                    causalOffset.push_back(d[0] + xDim * (d[1] + yDim * d[2]));
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        reach[k] = std::max(reach[k], (d[k] >= 0 ? d[k] : -d[k]));
+                    }
+                }
+            }
+
+            std::size_t const numSlabs = std::max(std::min(numThreads, zSize),
+                static_cast<std::size_t>(1));
+            std::vector<std::vector<std::size_t>> tables(numSlabs);
+
+            // The first pass. A provisional label k of a slab is stored in
+            // the image as k+1. When the causal neighbors of a voxel have
+            // different labels, the labels are joined in the table with the
+            // smaller label as the root. Provisional labels are created in
+            // lexicographical order, so the root of a component's labels is
+            // the label of its first voxel.
+            RunTasks(pool, numSlabs, [&](std::size_t s)
+            {
+                std::size_t zMin = 0, zSup = 0;
+                GetRange(s, numSlabs, zSize, zMin, zSup);
+                OffsetType const zLower = static_cast<OffsetType>(zMin);
+                std::vector<std::size_t>& table = tables[s];
+                for (std::size_t z = zMin, i = zMin * planeSize; z < zSup; ++z)
+                {
+                    OffsetType const iz = static_cast<OffsetType>(z);
+                    for (std::size_t y = 0; y < ySize; ++y)
+                    {
+                        OffsetType const iy = static_cast<OffsetType>(y);
+                        bool const interiorYZ = (reach[1] <= iy && iy + reach[1] < yDim &&
+                            zLower + reach[2] <= iz);
+                        for (std::size_t x = 0; x < xSize; ++x, ++i)
+                        {
+                            if (image[i] == 0)
+                            {
+                                continue;
+                            }
+
+                            OffsetType const ix = static_cast<OffsetType>(x);
+                            bool const interior = (interiorYZ &&
+                                reach[0] <= ix && ix + reach[0] < xDim);
+                            std::size_t label = std::numeric_limits<std::size_t>::max();
+                            SInteger previous = 0;
+                            for (std::size_t j = 0; j < causal.size(); ++j)
+                            {
+                                if (!interior)
+                                {
+                                    OffsetType const nx = ix + causal[j][0];
+                                    OffsetType const ny = iy + causal[j][1];
+                                    OffsetType const nz = iz + causal[j][2];
+                                    if (nx < 0 || nx >= xDim || ny < 0 || ny >= yDim || nz < zLower)
+                                    {
+                                        continue;
+                                    }
+                                }
+
+                                SInteger const value = image[static_cast<std::size_t>(
+                                    static_cast<OffsetType>(i) + causalOffset[j])];
+                                if (value != 0 && value != previous)
+                                {
+                                    // Adjacent neighbors usually have the
+                                    // same provisional label, which needs
+                                    // to be joined only once.
+                                    previous = value;
+                                    std::size_t const neighborLabel = static_cast<std::size_t>(value) - 1;
+                                    if (label == std::numeric_limits<std::size_t>::max())
+                                    {
+                                        label = Find(table, neighborLabel);
+                                    }
+                                    else if (neighborLabel != label)
+                                    {
+                                        label = Union(table, label, Find(table, neighborLabel));
+                                    }
+                                }
+                            }
+
+                            if (label == std::numeric_limits<std::size_t>::max())
+                            {
+                                label = table.size();
+                                table.push_back(label);
+                            }
+                            image[i] = static_cast<SInteger>(label + 1);
+                        }
+                    }
+                }
+            });
+
+            // Concatenate the tables. The provisional label k of slab s has
+            // global label firstLabel[s] + k.
+            std::vector<std::size_t> firstLabel(numSlabs + 1, 0);
+            for (std::size_t s = 0; s < numSlabs; ++s)
+            {
+                firstLabel[s + 1] = firstLabel[s] + tables[s].size();
+            }
+            std::vector<std::size_t> table(firstLabel[numSlabs]);
+            for (std::size_t s = 0; s < numSlabs; ++s)
+            {
+                for (std::size_t k = 0; k < tables[s].size(); ++k)
+                {
+                    table[firstLabel[s] + k] = firstLabel[s] + tables[s][k];
+                }
+                tables[s] = std::vector<std::size_t>{};
+            }
+
+            // Join the slabs across their boundaries. A voxel of slab s has
+            // causal neighbors in the preceding slabs only when it is within
+            // reach[2] planes of the first plane of the slab. A slab can be
+            // thinner than reach[2], so the label of a neighbor is relative
+            // to the slab that contains its plane.
+            std::vector<std::size_t> slabOfPlane(zSize);
+            for (std::size_t s = 0; s < numSlabs; ++s)
+            {
+                std::size_t zMin = 0, zSup = 0;
+                GetRange(s, numSlabs, zSize, zMin, zSup);
+                std::fill(slabOfPlane.begin() + zMin, slabOfPlane.begin() + zSup, s);
+            }
+
+            for (std::size_t s = 1; s < numSlabs; ++s)
+            {
+                std::size_t zMin = 0, zSup = 0;
+                GetRange(s, numSlabs, zSize, zMin, zSup);
+                OffsetType const zLower = static_cast<OffsetType>(zMin);
+                std::size_t const zJoinSup = std::min(zSup, zMin + static_cast<std::size_t>(reach[2]));
+                for (std::size_t z = zMin, i = zMin * planeSize; z < zJoinSup; ++z)
+                {
+                    OffsetType const iz = static_cast<OffsetType>(z);
+                    for (std::size_t y = 0; y < ySize; ++y)
+                    {
+                        for (std::size_t x = 0; x < xSize; ++x, ++i)
+                        {
+                            if (image[i] == 0)
+                            {
+                                continue;
+                            }
+
+                            std::size_t const label = firstLabel[s] + static_cast<std::size_t>(image[i]) - 1;
+                            for (std::size_t j = 0; j < causal.size(); ++j)
+                            {
+                                OffsetType const nx = static_cast<OffsetType>(x) + causal[j][0];
+                                OffsetType const ny = static_cast<OffsetType>(y) + causal[j][1];
+                                OffsetType const nz = iz + causal[j][2];
+                                if (0 <= nx && nx < xDim && 0 <= ny && ny < yDim && 0 <= nz && nz < zLower)
+                                {
+                                    SInteger const value = image[static_cast<std::size_t>(
+                                        static_cast<OffsetType>(i) + causalOffset[j])];
+                                    if (value != 0)
+                                    {
+                                        std::size_t const neighborLabel =
+                                            firstLabel[slabOfPlane[static_cast<std::size_t>(nz)]] +
+                                            static_cast<std::size_t>(value) - 1;
+                                        (void)Union(table, Find(table, label), Find(table, neighborLabel));
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Resolve the table. A label links to a smaller label, so
+            // visiting the labels in increasing order maps each of them to
+            // its root, and the roots are visited in the order of the first
+            // voxels of the components.
+            std::size_t numComponents = 0;
+            for (std::size_t k = 0; k < table.size(); ++k)
+            {
+                if (table[k] == k)
+                {
+                    table[k] = ++numComponents;
+                }
+                else
+                {
+                    table[k] = table[table[k]];
+                }
+            }
+
+            // The second pass.
+            RunTasks(pool, numSlabs, [&](std::size_t s)
+            {
+                std::size_t zMin = 0, zSup = 0;
+                GetRange(s, numSlabs, zSize, zMin, zSup);
+                std::size_t const* slabTable = table.data() + firstLabel[s];
+                for (std::size_t i = zMin * planeSize; i < zSup * planeSize; ++i)
+                {
+                    if (image[i] != 0)
+                    {
+                        image[i] = static_cast<SInteger>(slabTable[static_cast<std::size_t>(image[i]) - 1]);
+                    }
+                }
+            });
+
+            return numComponents;
+        }
+
+        // Gather the indices of the voxels of each component from the image
+        // labeled by LabelComponents. The array components[k], k >= 1,
+        // contains the indices for the k-th component in increasing order.
+        static void GatherComponents(
+            std::size_t numVoxels,
+            SInteger const* image,
+            std::size_t numComponents,
+            std::vector<std::vector<std::size_t>>& components)
+        {
+            if (numComponents > 0)
+            {
+                std::vector<std::size_t> numElements(numComponents + 1, 0);
+                for (std::size_t i = 0; i < numVoxels; ++i)
+                {
+                    ++numElements[static_cast<std::size_t>(image[i])];
+                }
+
+                components.resize(numComponents + 1);
+                for (std::size_t k = 1; k <= numComponents; ++k)
+                {
+                    components[k].resize(numElements[k]);
+                    numElements[k] = 0;
+                }
+
+                for (std::size_t i = 0; i < numVoxels; ++i)
+                {
+                    std::size_t const k = static_cast<std::size_t>(image[i]);
+                    if (k != 0)
+                    {
+                        components[k][numElements[k]] = i;
+                        ++numElements[k];
+                    }
+                }
+            }
+        }
+
+        // Compute the squared Euclidean distance transform of a binary image
+        // with 0 for background and nonzero for foreground. Each output
+        // value is the squared distance from the voxel to the nearest
+        // background voxel, so background voxels have value 0. If the image
+        // has no background voxels, all output values are
+        // std::numeric_limits<SInteger>::max(). The distances are exact. The
+        // transform is separable and uses the linear-time lower envelope of
+        // parabolas described in
+        //   P. F. Felzenszwalb and D. P. Huttenlocher,
+        //   Distance Transforms of Sampled Functions,
+        //   Theory of Computing, 8(19):415-428, 2012.
+        // Each of the (at most three) passes processes independent lines of
+        // voxels, which are partitioned among the threads.
+        static void GetSquaredDistance(
+            std::size_t xSize, std::size_t ySize, std::size_t zSize,
+            SInteger const* input,
+            SInteger* output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            std::size_t const numVoxels = xSize * ySize * zSize;
+            GTL_ARGUMENT_ASSERT(
+                numVoxels > 0 && input != nullptr && output != nullptr,
+                "Invalid argument.");
+
+            std::int64_t const infinity = static_cast<std::int64_t>(
+                std::numeric_limits<SInteger>::max());
+
+            // The x-pass is the 1-dimensional distance to the nearest
+            // background voxel in the row, computed with two scans.
+            std::size_t const numRows = ySize * zSize;
+            std::size_t numTasks = std::max(std::min(numThreads, numRows),
+                static_cast<std::size_t>(1));
+            RunTasks(pool, numTasks, [&](std::size_t t)
+            {
+                std::size_t rMin = 0, rSup = 0;
+                GetRange(t, numTasks, numRows, rMin, rSup);
+                for (std::size_t r = rMin; r < rSup; ++r)
+                {
+                    SInteger const* source = input + r * xSize;
+                    SInteger* target = output + r * xSize;
+                    std::int64_t distance = infinity;
+                    for (std::size_t x = 0; x < xSize; ++x)
+                    {
+                        distance = (source[x] == 0 ? 0 :
+                            (distance < infinity ? distance + 1 : infinity));
+                        target[x] = static_cast<SInteger>(distance);
+                    }
+
+                    distance = infinity;
+                    for (std::size_t x = xSize; x-- > 0; )
+                    {
+                        distance = (source[x] == 0 ? 0 :
+                            (distance < infinity ? distance + 1 : infinity));
+                        std::int64_t d = std::min(distance, static_cast<std::int64_t>(target[x]));
+                        target[x] = static_cast<SInteger>(d < infinity ? d * d : infinity);
+                    }
+                }
+            });
+
+            // The y-pass and z-pass apply the 1-dimensional transform to the
+            // columns of the previous result.
+            auto ApplyLines = [&](std::size_t n, std::size_t stride,
+                std::size_t numLines, std::size_t lineStride, std::size_t lineBlock)
+            {
+                numTasks = std::max(std::min(numThreads, numLines),
+                    static_cast<std::size_t>(1));
+                RunTasks(pool, numTasks, [&](std::size_t t)
+                {
+                    std::vector<std::int64_t> f(n), d(n);
+                    std::vector<std::size_t> vertex(n);
+                    std::vector<double> boundary(n + 1);
+                    std::size_t lMin = 0, lSup = 0;
+                    GetRange(t, numTasks, numLines, lMin, lSup);
+                    for (std::size_t l = lMin; l < lSup; ++l)
+                    {
+                        SInteger* line = output + (l % lineBlock) + (l / lineBlock) * lineStride;
+                        bool allZero = true;
+                        for (std::size_t q = 0; q < n; ++q)
+                        {
+                            f[q] = static_cast<std::int64_t>(line[q * stride]);
+                            allZero = (allZero && f[q] == 0);
+                        }
+                        if (allZero)
+                        {
+                            // Lines of background voxels are common in
+                            // masks and are unchanged by the transform.
+                            continue;
+                        }
+
+                        GetSquaredDistance1(n, f.data(), infinity, vertex.data(),
+                            boundary.data(), d.data());
+                        for (std::size_t q = 0; q < n; ++q)
+                        {
+                            line[q * stride] = static_cast<SInteger>(d[q]);
+                        }
+                    }
+                });
+            };
+
+            if (ySize > 1)
+            {
+                ApplyLines(ySize, xSize, xSize * zSize, xSize * ySize, xSize);
+            }
+            if (zSize > 1)
+            {
+                ApplyLines(zSize, xSize * ySize, xSize * ySize, 0, xSize * ySize);
+            }
+        }
+
+        // Dilation and erosion of a binary image with 0 for background and
+        // 1 for foreground. The output voxels are 0 or 1. The semantics are
+        // those of the Dilate and Erode functions of Morphology2 and
+        // Morphology3: the structuring element consists of the voxel itself
+        // and its neighbors, and for erosion with zeroExterior set to true,
+        // a voxel with a neighbor outside the image is set to 0. The input
+        // rows are run-length encoded, and each output row is computed from
+        // the runs of the rows that the neighbors reach, so the cost is
+        // proportional to the number of runs rather than to the number of
+        // voxels times the number of neighbors. The output rows are
+        // partitioned among the threads.
+        static void Dilate(
+            std::size_t xSize, std::size_t ySize, std::size_t zSize,
+            SInteger const* input,
+            std::size_t numNeighbors,
+            std::array<OffsetType, 3> const* neighbors,
+            SInteger* output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            ApplyRuns(xSize, ySize, zSize, input, numNeighbors, neighbors,
+                false, false, output, numThreads, pool);
+        }
+
+        static void Erode(
+            std::size_t xSize, std::size_t ySize, std::size_t zSize,
+            SInteger const* input,
+            bool zeroExterior,
+            std::size_t numNeighbors,
+            std::array<OffsetType, 3> const* neighbors,
+            SInteger* output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            ApplyRuns(xSize, ySize, zSize, input, numNeighbors, neighbors,
+                true, zeroExterior, output, numThreads, pool);
+        }
+
+    protected:
+        // Partition {0..numItems-1} into numTasks contiguous blocks. Every
+        // block except the last has numItems/numTasks items.
+        static void GetRange(std::size_t t, std::size_t numTasks, std::size_t numItems,
+            std::size_t& iMin, std::size_t& iSup)
+        {
+            std::size_t const load = numItems / numTasks;
+            iMin = t * load;
+            iSup = (t + 1 < numTasks ? iMin + load : numItems);
+        }
+
+        template <typename Task>
+        static void RunTasks(ThreadPool* pool, std::size_t numTasks, Task const& task)
+        {
+            if (numTasks > 1)
+            {
+                ForkJoin(pool, numTasks, task);
+            }
+            else
+            {
+                task(0);
+            }
+        }
+
     private:
+        // Union-find operations on a table of labels. Path halving keeps
+        // the trees shallow. The smaller root becomes the parent.
+        static std::size_t Find(std::vector<std::size_t>& table, std::size_t k)
+        {
+            while (table[k] != k)
+            {
+                table[k] = table[table[k]];
+                k = table[k];
+            }
+            return k;
+        }
+
+        // Join the trees with roots r0 and r1 and return the root of the
+        // joined tree.
+        static std::size_t Union(std::vector<std::size_t>& table, std::size_t r0, std::size_t r1)
+        {
+            if (r0 < r1)
+            {
+                table[r1] = r0;
+                return r0;
+            }
+            else
+            {
+                table[r0] = r1;
+                return r1;
+            }
+        }
+
+        // The 1-dimensional squared distance transform of the sampled
+        // function f, where samples with value 'infinity' are not part of
+        // the lower envelope. The vertex and boundary arrays store the
+        // parabolas of the lower envelope and the intervals where they are
+        // minimal.
+        static void GetSquaredDistance1(std::size_t n, std::int64_t const* f,
+            std::int64_t infinity, std::size_t* vertex, double* boundary,
+            std::int64_t* d)
+        {
+            std::size_t numParabolas = 0;
+            for (std::size_t q = 0; q < n; ++q)
+            {
+                if (f[q] == infinity)
+                {
+                    continue;
+                }
+
+                std::int64_t const iq = static_cast<std::int64_t>(q);
+                double s = 0.0;
+                while (numParabolas > 0)
+                {
+                    std::size_t const v = vertex[numParabolas - 1];
+                    std::int64_t const iv = static_cast<std::int64_t>(v);
+                    s = static_cast<double>((f[q] + iq * iq) - (f[v] + iv * iv)) /
+                        static_cast<double>(2 * (iq - iv));
+                    if (s > boundary[numParabolas - 1])
+                    {
+                        break;
+                    }
+                    --numParabolas;
+                }
+
+                vertex[numParabolas] = q;
+                boundary[numParabolas] = (numParabolas > 0 ? s :
+                    -std::numeric_limits<double>::infinity());
+                ++numParabolas;
+            }
+
+            if (numParabolas == 0)
+            {
+                std::fill(d, d + n, infinity);
+                return;
+            }
+
+            boundary[numParabolas] = std::numeric_limits<double>::infinity();
+            for (std::size_t q = 0, k = 0; q < n; ++q)
+            {
+                double const dq = static_cast<double>(q);
+                while (boundary[k + 1] < dq)
+                {
+                    ++k;
+                }
+                std::int64_t const diff = static_cast<std::int64_t>(q) -
+                    static_cast<std::int64_t>(vertex[k]);
+                d[q] = std::min(diff * diff + f[vertex[k]], infinity);
+            }
+        }
+
+        // A run of foreground voxels [first,last] in a row.
+        using Run = std::array<OffsetType, 2>;
+
+        // The offsets that share (dy,dz) form a group. Their dx values are
+        // stored as maximal intervals [dxMin,dxMax], because a run shifted
+        // by every dx of an interval is a single run.
+        struct Group
+        {
+            OffsetType dy, dz;
+            std::vector<Run> dxRanges;
+        };
+
+        static std::vector<Group> GetGroups(std::size_t numNeighbors,
+            std::array<OffsetType, 3> const* neighbors)
+        {
+            std::vector<std::array<OffsetType, 3>> sorted(neighbors, neighbors + numNeighbors);
+            sorted.push_back({ 0, 0, 0 });
+            std::sort(sorted.begin(), sorted.end(),
+                [](std::array<OffsetType, 3> const& a, std::array<OffsetType, 3> const& b)
+                {
+                    return std::make_tuple(a[2], a[1], a[0]) < std::make_tuple(b[2], b[1], b[0]);
+                });
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+            std::vector<Group> groups{};
+            for (auto const& d : sorted)
+            {
+                if (groups.size() == 0 || groups.back().dy != d[1] || groups.back().dz != d[2])
+                {
+                    groups.push_back(Group{ d[1], d[2], { { d[0], d[0] } } });
+                }
+                else if (groups.back().dxRanges.back()[1] + 1 == d[0])
+                {
+                    groups.back().dxRanges.back()[1] = d[0];
+                }
+                else
+                {
+                    groups.back().dxRanges.push_back({ d[0], d[0] });
+                }
+            }
+            return groups;
+        }
+
+        // Intersect two sorted lists of disjoint runs.
+        static void Intersect(std::vector<Run> const& runs0, std::vector<Run> const& runs1,
+            std::vector<Run>& result)
+        {
+            result.clear();
+            std::size_t i0 = 0, i1 = 0;
+            while (i0 < runs0.size() && i1 < runs1.size())
+            {
+                OffsetType const first = std::max(runs0[i0][0], runs1[i1][0]);
+                OffsetType const last = std::min(runs0[i0][1], runs1[i1][1]);
+                if (first <= last)
+                {
+                    result.push_back({ first, last });
+                }
+                if (runs0[i0][1] < runs1[i1][1])
+                {
+                    ++i0;
+                }
+                else
+                {
+                    ++i1;
+                }
+            }
+        }
+
+        static void ApplyRuns(
+            std::size_t xSize, std::size_t ySize, std::size_t zSize,
+            SInteger const* input,
+            std::size_t numNeighbors,
+            std::array<OffsetType, 3> const* neighbors,
+            bool erode, bool zeroExterior,
+            SInteger* output,
+            std::size_t numThreads,
+            ThreadPool* pool)
+        {
+            std::size_t const numRows = ySize * zSize;
+            GTL_ARGUMENT_ASSERT(
+                xSize > 0 && numRows > 0 && input != nullptr && output != nullptr &&
+                input != output && numNeighbors > 0 && neighbors != nullptr,
+                "Invalid argument.");
+
+            std::vector<Group> const groups = GetGroups(numNeighbors, neighbors);
+            OffsetType const xDim = static_cast<OffsetType>(xSize);
+            OffsetType const yDim = static_cast<OffsetType>(ySize);
+            OffsetType const zDim = static_cast<OffsetType>(zSize);
+            std::size_t const numTasks = std::max(std::min(numThreads, numRows),
+                static_cast<std::size_t>(1));
+
+            // Run-length encode the rows. Each task stores the runs of its
+            // rows in its own array; rowRuns[r] is the range of the runs of
+            // row r within that array.
+            std::vector<std::vector<Run>> taskRuns(numTasks);
+            std::vector<std::array<std::size_t, 2>> rowRuns(numRows);
+            RunTasks(pool, numTasks, [&](std::size_t t)
+            {
+                std::size_t rMin = 0, rSup = 0;
+                GetRange(t, numTasks, numRows, rMin, rSup);
+                std::vector<Run>& runs = taskRuns[t];
+                for (std::size_t r = rMin; r < rSup; ++r)
+                {
+                    SInteger const* row = input + r * xSize;
+                    rowRuns[r][0] = runs.size();
+                    for (OffsetType x = 0; x < xDim; )
+                    {
+                        if (row[x] == 1)
+                        {
+                            OffsetType const first = x;
+                            while (x < xDim && row[x] == 1)
+                            {
+                                ++x;
+                            }
+                            runs.push_back({ first, x - 1 });
+                        }
+                        else
+                        {
+                            ++x;
+                        }
+                    }
+                    rowRuns[r][1] = runs.size();
+                }
+            });
+
+            // The runs of a row are read by the tasks of the neighboring
+            // rows after all the rows have been encoded.
+            std::vector<std::size_t> rowTask(numRows);
+            for (std::size_t t = 0; t < numTasks; ++t)
+            {
+                std::size_t rMin = 0, rSup = 0;
+                GetRange(t, numTasks, numRows, rMin, rSup);
+                std::fill(rowTask.begin() + rMin, rowTask.begin() + rSup, t);
+            }
+
+            // For erosion without a zero exterior, the exterior of a row is
+            // treated as two runs of foreground voxels, because exterior
+            // voxels do not remove any voxels. Runs that touch the image
+            // boundary are merged with them.
+            OffsetType const beyond = std::numeric_limits<OffsetType>::max() / 4;
+            bool const extend = (erode && !zeroExterior);
+
+            RunTasks(pool, numTasks, [&](std::size_t t)
+            {
+                std::vector<Run> current{}, source{}, shifted{}, result{};
+                std::size_t rMin = 0, rSup = 0;
+                GetRange(t, numTasks, numRows, rMin, rSup);
+                for (std::size_t r = rMin; r < rSup; ++r)
+                {
+                    OffsetType const y = static_cast<OffsetType>(r % ySize);
+                    OffsetType const z = static_cast<OffsetType>(r / ySize);
+                    SInteger* row = output + r * xSize;
+                    std::fill(row, row + xSize, static_cast<SInteger>(0));
+                    current.clear();
+                    bool initialized = false, empty = false;
+
+                    for (std::size_t g = 0; g < groups.size() && !empty; ++g)
+                    {
+                        Group const& group = groups[g];
+                        OffsetType const sy = (erode ? y + group.dy : y - group.dy);
+                        OffsetType const sz = (erode ? z + group.dz : z - group.dz);
+                        if (sy < 0 || sy >= yDim || sz < 0 || sz >= zDim)
+                        {
+                            empty = (erode && zeroExterior);
+                            continue;
+                        }
+
+                        std::size_t const s = static_cast<std::size_t>(sy) +
+                            ySize * static_cast<std::size_t>(sz);
+                        Run const* first = taskRuns[rowTask[s]].data() + rowRuns[s][0];
+                        Run const* last = taskRuns[rowTask[s]].data() + rowRuns[s][1];
+                        if (!erode)
+                        {
+                            // The shifted runs of the dilation overlap. They
+                            // are written directly to the output row, which
+                            // costs less than merging them.
+                            for (auto const& range : group.dxRanges)
+                            {
+                                for (Run const* run = first; run != last; ++run)
+                                {
+                                    OffsetType const x0 = std::max((*run)[0] + range[0],
+                                        static_cast<OffsetType>(0));
+                                    OffsetType const x1 = std::min((*run)[1] + range[1], xDim - 1);
+                                    if (x0 <= x1)
+                                    {
+                                        std::fill(row + x0, row + x1 + 1, static_cast<SInteger>(1));
+                                    }
+                                }
+                            }
+                            continue;
+                        }
+
+                        source.assign(first, last);
+                        if (extend)
+                        {
+                            if (source.size() > 0 && source.front()[0] == 0)
+                            {
+                                source.front()[0] = -beyond;
+                            }
+                            else
+                            {
+                                source.insert(source.begin(), Run{ -beyond, -1 });
+                            }
+
+                            if (source.back()[1] == xDim - 1)
+                            {
+                                source.back()[1] = beyond;
+                            }
+                            else
+                            {
+                                source.push_back(Run{ xDim, beyond });
+                            }
+                        }
+
+                        for (auto const& range : group.dxRanges)
+                        {
+                            shifted.clear();
+                            for (auto run : source)
+                            {
+                                run[0] = std::max(run[0] - range[0], static_cast<OffsetType>(0));
+                                run[1] = std::min(run[1] - range[1], xDim - 1);
+                                if (run[0] <= run[1])
+                                {
+                                    shifted.push_back(run);
+                                }
+                            }
+
+                            if (!initialized)
+                            {
+                                current.swap(shifted);
+                                initialized = true;
+                            }
+                            else
+                            {
+                                Intersect(current, shifted, result);
+                                current.swap(result);
+                            }
+                            empty = (current.size() == 0);
+                        }
+                    }
+
+                    if (erode && !empty)
+                    {
+                        for (auto const& run : current)
+                        {
+                            std::fill(row + run[0], row + run[1] + 1, static_cast<SInteger>(1));
+                        }
+                    }
+                }
+            });
+        }
+
         friend class UnitTestMorphology;
     };
 }
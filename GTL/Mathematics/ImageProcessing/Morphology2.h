@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.08.07
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -12,6 +12,7 @@
 #include <GTL/Mathematics/ImageProcessing/Morphology.h>
 #include <GTL/Mathematics/ImageProcessing/Image2.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <array>
 #include <cstddef>
 #include <limits>
@@ -30,18 +31,37 @@ namespace gtl
         // The input image is modified to avoid the cost of making a copy. On
         // output, the image values are the labels for the components. The
         // array components[k], k >= 1, contains the indices for the k-th
-        // component.
+        // component. The labeling uses union-find over bands of rows; see
+        // Morphology<SInteger>::LabelComponents.
         template <std::size_t N>
         static void GetComponents(
             Image2<SInteger>& image,
-            std::vector<std::vector<std::size_t>>& components)
+            std::vector<std::vector<std::size_t>>& components,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            std::size_t numComponents = GetComponents<N>(image, numThreads, pool);
+            Morphology<SInteger>::GatherComponents(image.size(), image.data(),
+                numComponents, components);
+        }
+
+        // Label the N-connected components of a binary image without
+        // gathering their pixel indices. The function returns the number of
+        // components, whose labels are 1 through that number.
+        template <std::size_t N>
+        static std::size_t GetComponents(
+            Image2<SInteger>& image,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             static_assert(N == 4 || N == 8, "Invalid neighborhood type.");
 
-            std::array<OffsetType, N> neighbors{};
+            std::array<std::array<OffsetType, 2>, N> neighbors{};
             image.GetNeighborhood(neighbors);
-            Morphology<SInteger>::GetComponents(image.size(), image.data(),
-                neighbors.size(), neighbors.data(), components);
+            auto lifted = Lift(neighbors.size(), neighbors.data());
+            return Morphology<SInteger>::LabelComponents(image.size(0), 1,
+                image.size(1), image.data(), lifted.size(), lifted.data(),
+                numThreads, pool);
         }
 
         // Compute a dilation with a structuring element consisting of the
@@ -49,57 +69,41 @@ namespace gtl
         // is binary with 0 for background and 1 for foreground. The output
         // image must be an object different from the input image.
         template <std::size_t N>
-        static void Dilate4(
+        static void Dilate(
             Image2<SInteger> const& input,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             std::array<std::array<OffsetType, 2>, N> neighbors{};
             input.GetNeighborhood(neighbors);
-            Dilate(input, neighbors.size(), neighbors.data(), output);
+            Dilate(input, neighbors.size(), neighbors.data(), output, numThreads, pool);
         }
 
         // Compute a dilation with a structing element consisting of neighbors
         // specified by offsets relative to the pixel. The input image is
         // binary with background 0 and foreground 1. The output image must
-        // be an object different from the input image.
+        // be an object different from the input image. The rows are
+        // processed as run-length encoded runs of foreground pixels; see
+        // Morphology<SInteger>::Dilate.
         static void Dilate(
             Image2<SInteger> const& input,
             std::size_t numNeighbors,
             std::array<OffsetType, 2> const* neighbors,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 &output != &input && input.size() > 0 &&
                 numNeighbors > 0 && neighbors != nullptr,
                 "Invalid argument.");
 
-            output = input;
-
-            // If the pixel at (i0,i1) is 1, then the pixels at (k0,i1) =
-            // (i0+nbr0,i1+nbr1) are set to 1 where (nbr0,nbr1) is in the
-            // neighbors array. Boundary testing is used to avoid accessing
-            // out-of-range pixels.
-            OffsetType const dim0 = static_cast<OffsetType>(input.size(0));
-            OffsetType const dim1 = static_cast<OffsetType>(input.size(1));
-            for (OffsetType i1 = 0; i1 < dim1; ++i1)
-            {
-                for (OffsetType i0 = 0; i0 < dim0; ++i0)
-                {
-                    if (input(i0, i1) == 1)
-                    {
-                        for (std::size_t j = 0; j < numNeighbors; ++j)
-                        {
-                            OffsetType k0 = i0 + neighbors[j][0];
-                            OffsetType k1 = i1 + neighbors[j][1];
-                            if (0 <= k0 && k0 < dim0 &&
-                                0 <= k1 && k1 < dim1)
-                            {
-                                output(k0, k1) = 1;
-                            }
-                        }
-                    }
-                }
-            }
+            output.resize({ input.size(0), input.size(1) });
+            auto lifted = Lift(numNeighbors, neighbors);
+            Morphology<SInteger>::Dilate(input.size(0), 1, input.size(1),
+                input.data(), lifted.size(), lifted.data(), output.data(),
+                numThreads, pool);
         }
 
         // Compute an erosion with a structuring element consisting of the
@@ -114,11 +118,14 @@ namespace gtl
         static void Erode(
             Image2<SInteger> const& input,
             bool zeroExterior,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             std::array<std::array<OffsetType, 2>, N> neighbors{};
             input.GetNeighborhood(neighbors);
-            Erode(input, zeroExterior, neighbors.size(), neighbors.data(), output);
+            Erode(input, zeroExterior, neighbors.size(), neighbors.data(), output,
+                numThreads, pool);
         }
 
         // Compute an erosion with a structuring element consisting of
@@ -128,54 +135,27 @@ namespace gtl
         // zeroExterior is true, the image exterior is assumed to be 0, so
         // 1-valued boundary pixels are set to 0; otherwise, boundary pixels
         // are set to 0 only when they have neighboring image pixels that
-        // are 0.
+        // are 0. The rows are processed as run-length encoded runs of
+        // foreground pixels; see Morphology<SInteger>::Erode.
         static void Erode(
             Image2<SInteger> const& input,
             bool zeroExterior,
             std::size_t numNeighbors,
             std::array<OffsetType, 2> const* neighbors,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 &output != &input && input.size() > 0 &&
                 numNeighbors > 0 && neighbors != nullptr,
                 "Invalid argument.");
 
-            output = input;
-
-            // If the pixel at (i0,i1) is 1, it is changed to 0 when at least
-            // one neighbor (k0,k1) = (i0+nbr0,i1+nbr1) is 0, where
-            // (nbr0,nbr1) is in the neighbors array.
-            OffsetType const dim0 = static_cast<OffsetType>(input.size(0));
-            OffsetType const dim1 = static_cast<OffsetType>(input.size(1));
-            for (OffsetType i1 = 0; i1 < dim1; ++i1)
-            {
-                for (OffsetType i0 = 0; i0 < dim0; ++i0)
-                {
-                    if (input(i0, i1) == 1)
-                    {
-                        for (std::size_t j = 0; j < numNeighbors; ++j)
-                        {
-                            OffsetType k0 = i0 + neighbors[j][0];
-                            OffsetType k1 = i1 + neighbors[j][1];
-                            if (0 <= k0 && k0 < dim0 &&
-                                0 <= k1 && k1 < dim1)
-                            {
-                                if (input(k0, k1) == 0)
-                                {
-                                    output(i0, i1) = 0;
-                                    break;
-                                }
-                            }
-                            else if (zeroExterior)
-                            {
-                                output(i0, i1) = 0;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+            output.resize({ input.size(0), input.size(1) });
+            auto lifted = Lift(numNeighbors, neighbors);
+            Morphology<SInteger>::Erode(input.size(0), 1, input.size(1),
+                input.data(), zeroExterior, lifted.size(), lifted.data(),
+                output.data(), numThreads, pool);
         }
 
         // Compute an opening with a structuring element consisting of the
@@ -189,11 +169,13 @@ namespace gtl
         static void Open(
             Image2<SInteger> const& input,
             bool zeroExterior,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image2<SInteger> temp(input.size(0), input.size(1));
-            Erode<N>(input, zeroExterior, temp);
-            Dilate<N>(temp, output);
+            Erode<N>(input, zeroExterior, temp, numThreads, pool);
+            Dilate<N>(temp, output, numThreads, pool);
         }
 
         // Compute an opening with a structuring element consisting of
@@ -208,11 +190,13 @@ namespace gtl
             bool zeroExterior,
             std::size_t numNeighbors,
             std::array<OffsetType, 2> const* neighbors,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image2<SInteger> temp(input.size(0), input.size(1));
-            Erode(input, zeroExterior, numNeighbors, neighbors, temp);
-            Dilate(temp, numNeighbors, neighbors, output);
+            Erode(input, zeroExterior, numNeighbors, neighbors, temp, numThreads, pool);
+            Dilate(temp, numNeighbors, neighbors, output, numThreads, pool);
         }
 
         // Compute a closing with a structuring element consisting of the
@@ -226,11 +210,13 @@ namespace gtl
         static void Close(
             Image2<SInteger> const& input,
             bool zeroExterior,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image2<SInteger> temp(input.size(0), input.size(1));
-            Dilate<N>(input, temp);
-            Erode<N>(temp, zeroExterior, output);
+            Dilate<N>(input, temp, numThreads, pool);
+            Erode<N>(temp, zeroExterior, output, numThreads, pool);
         }
 
         // Compute a closing with a structuring element consisting of
@@ -245,11 +231,13 @@ namespace gtl
             bool zeroExterior,
             std::size_t numNeighbors,
             std::array<OffsetType, 2> const* neighbors,
-            Image2<SInteger>& output)
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image2<SInteger> temp(input.size(0), input.size(1));
-            Dilate(input, numNeighbors, neighbors, temp);
-            Erode(temp, zeroExterior, numNeighbors, neighbors, output);
+            Dilate(input, numNeighbors, neighbors, temp, numThreads, pool);
+            Erode(temp, zeroExterior, numNeighbors, neighbors, output, numThreads, pool);
         }
 
         // Locate a pixel and walk around the edge of a component in a binary
@@ -381,7 +369,7 @@ namespace gtl
                 point = stack[top];
 
                 // Fill the pixel.
-                image(x, y) = 2;
+                image(point[0], point[1]) = 2;
 
                 neighbor = { point[0] + 1, point[1] };
                 if (neighbor[0] < dim0 &&
@@ -471,7 +459,44 @@ namespace gtl
             maxDistance = static_cast<std::size_t>(distance);
         }
 
+        // Compute the squared Euclidean distance transform of the binary
+        // image, where the foreground is nonzero and the background is 0.
+        // The output value of a pixel is the squared distance to the nearest
+        // background pixel. Pixels outside the domain are not background, so
+        // if the image has no background pixels, all output values are
+        // std::numeric_limits<SInteger>::max(). The transform is exact and
+        // its cost is linear in the number of pixels; see
+        // Morphology<SInteger>::GetSquaredDistance.
+        static void GetSquaredL2Distance(
+            Image2<SInteger> const& input,
+            Image2<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                &output != &input && input.size() > 0,
+                "Invalid argument.");
+
+            output.resize({ input.size(0), input.size(1) });
+            Morphology<SInteger>::GetSquaredDistance(input.size(0), 1,
+                input.size(1), input.data(), output.data(), numThreads, pool);
+        }
+
     private:
+        // The base-class functions operate on 3D images. A 2D image is
+        // passed as an xSize-by-1-by-ySize image, so a pixel offset (dx,dy)
+        // becomes (dx,0,dy).
+        static std::vector<std::array<OffsetType, 3>> Lift(std::size_t numNeighbors,
+            std::array<OffsetType, 2> const* neighbors)
+        {
+            std::vector<std::array<OffsetType, 3>> lifted(numNeighbors);
+            for (std::size_t j = 0; j < numNeighbors; ++j)
+            {
+                lifted[j] = { neighbors[j][0], 0, neighbors[j][1] };
+            }
+            return lifted;
+        }
+
         friend class UnitTestMorphology2;
     };
 }
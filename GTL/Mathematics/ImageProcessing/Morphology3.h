@@ -3,13 +3,15 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.08.07
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 #include <GTL/Mathematics/ImageProcessing/Morphology.h>
 #include <GTL/Mathematics/ImageProcessing/Image3.h>
+#include <GTL/Mathematics/ImageProcessing/MappedImage3.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <array>
 #include <cstddef>
 #include <limits>
@@ -28,16 +30,36 @@ namespace gtl
         // (N is 6, 18, or 26). The input image is modified to avoid the cost
         // of making a copy. On output, the image values are the labels for
         // the components. The array components[k], k >= 1, contains the
-        // indices for the k-th component.
+        // indices for the k-th component. The labeling uses union-find over
+        // z-slabs; see Morphology<SInteger>::LabelComponents.
         template <std::size_t N>
         static void GetComponents(
             Image3<SInteger>& image,
-            std::vector<std::vector<std::size_t>>& components)
+            std::vector<std::vector<std::size_t>>& components,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
-            std::array<OffsetType, N> neighbors{};
+            std::size_t numComponents = GetComponents<N>(image, numThreads, pool);
+            Morphology<SInteger>::GatherComponents(image.size(), image.data(),
+                numComponents, components);
+        }
+
+        // Label the N-connected components of a binary image without
+        // gathering their voxel indices. The function returns the number of
+        // components, whose labels are 1 through that number.
+        template <std::size_t N>
+        static std::size_t GetComponents(
+            Image3<SInteger>& image,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            static_assert(N == 6 || N == 18 || N == 26, "Invalid neighborhood type.");
+
+            std::array<std::array<OffsetType, 3>, N> neighbors{};
             image.GetNeighborhood(neighbors);
-            Morphology<SInteger>::GetComponents(image.size(), image.data(),
-                neighbors.size(), neighbors.data(), components);
+            return Morphology<SInteger>::LabelComponents(image.size(0), image.size(1),
+                image.size(2), image.data(), neighbors.size(), neighbors.data(),
+                numThreads, pool);
         }
 
         // Compute a dilation with a structuring element consisting of the
@@ -47,61 +69,37 @@ namespace gtl
         template <std::size_t N>
         static void Dilate(
             Image3<SInteger> const& input,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             std::array<std::array<OffsetType, 3>, N> neighbors;
             input.GetNeighborhood(neighbors);
-            Dilate(input, neighbors.size(), neighbors.data(), output);
+            Dilate(input, neighbors.size(), neighbors.data(), output, numThreads, pool);
         }
 
         // Compute a dilation with a structing element consisting of neighbors
         // specified by offsets relative to the voxel. The input image is
         // binary with 0 for background and 1 for foreground. The output
-        // image must be an object different from the input image.
+        // image must be an object different from the input image. The rows
+        // are processed as run-length encoded runs of foreground voxels; see
+        // Morphology<SInteger>::Dilate.
         static void Dilate(
             Image3<SInteger> const& input,
             std::size_t numNeighbors,
             std::array<OffsetType, 3> const* neighbors,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 &output != &input && input.size() > 0 &&
                 numNeighbors > 0 && neighbors != nullptr,
                 "Invalid argument.");
 
-            output = input;
-
-            // If the voxel at (i0,i1,i2) is 1, then the voxels at
-            // (k0,k1,k2) = (i0+nbr0,i1+nbr1,i2+nbr2) are set to 1 where
-            // (nbr0,nbr1,nbr2) is in the neighbors array. Boundary
-            // testing is used to avoid accessing out-of-range pixels.
-            OffsetType const dim0 = static_cast<OffsetType>(input.size(0));
-            OffsetType const dim1 = static_cast<OffsetType>(input.size(1));
-            OffsetType const dim2 = static_cast<OffsetType>(input.size(2));
-            for (OffsetType i2 = 0; i2 < dim2; ++i2)
-            {
-                for (OffsetType i1 = 0; i1 < dim1; ++i1)
-                {
-                    for (OffsetType i0 = 0; i0 < dim0; ++i0)
-                    {
-                        if (input(i0, i1, i2) == 1)
-                        {
-                            for (std::size_t j = 0; j < numNeighbors; ++j)
-                            {
-                                OffsetType k0 = i0 + neighbors[j][0];
-                                OffsetType k1 = i1 + neighbors[j][1];
-                                OffsetType k2 = i2 + neighbors[j][2];
-                                if (0 <= k0 && k0 < dim0 &&
-                                    0 <= k1 && k1 < dim1 &&
-                                    0 <= k2 && k2 < dim2)
-                                {
-                                    output(k0, k1, k2) = 1;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            output.resize({ input.size(0), input.size(1), input.size(2) });
+            Morphology<SInteger>::Dilate(input.size(0), input.size(1), input.size(2),
+                input.data(), numNeighbors, neighbors, output.data(), numThreads, pool);
         }
 
         // Compute an erosion with a structuring element consisting of the
@@ -116,11 +114,14 @@ namespace gtl
         static void Erode(
             Image3<SInteger> const& input,
             bool zeroExterior,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             std::array<std::array<OffsetType, 3>, N> neighbors{};
             input.GetNeighborhood(neighbors);
-            Erode(input, zeroExterior, neighbors.size(), neighbors.data(), output);
+            Erode(input, zeroExterior, neighbors.size(), neighbors.data(), output,
+                numThreads, pool);
         }
 
         // Compute an erosion with a structuring element consisting of
@@ -130,60 +131,26 @@ namespace gtl
         // zeroExterior is true, the image exterior is assumed to be 0, so
         // 1-valued boundary voxels are set to 0; otherwise, boundary voxels
         // are set to 0 only when they have neighboring image voxels that
-        // are 0.
+        // are 0. The rows are processed as run-length encoded runs of
+        // foreground voxels; see Morphology<SInteger>::Erode.
         static void Erode(
             Image3<SInteger> const& input,
             bool zeroExterior,
             std::size_t numNeighbors,
             std::array<OffsetType, 3> const* neighbors,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 &output != &input && input.size() > 0 &&
                 numNeighbors > 0 && neighbors != nullptr,
                 "Invalid argument.");
 
-            output = input;
-
-            // If the pixel at (i0,i1,i2) is 1, it is changed to 0 when at
-            // least one neighbor (k0,k1,k2) = (i0+nbr0,i1+nbr1,i2+nbr2) is 0,
-            // where (nbr0,nbr1,nbr2) is in the neighbors array.
-            OffsetType const dim0 = static_cast<OffsetType>(input.size(0));
-            OffsetType const dim1 = static_cast<OffsetType>(input.size(1));
-            OffsetType const dim2 = static_cast<OffsetType>(input.size(2));
-            for (OffsetType i2 = 0; i2 < dim2; ++i2)
-            {
-                for (OffsetType i1 = 0; i1 < dim1; ++i1)
-                {
-                    for (OffsetType i0 = 0; i0 < dim0; ++i0)
-                    {
-                        if (input(i0, i1, i2) == 1)
-                        {
-                            for (std::size_t j = 0; j < numNeighbors; ++j)
-                            {
-                                OffsetType k0 = i0 + neighbors[j][0];
-                                OffsetType k1 = i1 + neighbors[j][1];
-                                OffsetType k2 = i1 + neighbors[j][2];
-                                if (0 <= k0 && k0 < dim0 &&
-                                    0 <= k1 && k1 < dim1 &&
-                                    0 <= k2 && k2 < dim2)
-                                {
-                                    if (input(k0, k1, k2) == 0)
-                                    {
-                                        output(i0, i1, i2) = 0;
-                                        break;
-                                    }
-                                }
-                                else if (zeroExterior)
-                                {
-                                    output(i0, i1, i2) = 0;
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            output.resize({ input.size(0), input.size(1), input.size(2) });
+            Morphology<SInteger>::Erode(input.size(0), input.size(1), input.size(2),
+                input.data(), zeroExterior, numNeighbors, neighbors, output.data(),
+                numThreads, pool);
         }
 
         // Compute an opening with a structuring element consisting of the
@@ -197,11 +164,13 @@ namespace gtl
         static void Open(
             Image3<SInteger> const& input,
             bool zeroExterior,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image3<SInteger> temp(input.size(0), input.size(1), input.size(2));
-            Erode<N>(input, zeroExterior, temp);
-            Dilate<N>(temp, output);
+            Erode<N>(input, zeroExterior, temp, numThreads, pool);
+            Dilate<N>(temp, output, numThreads, pool);
         }
 
         // Compute an opening with a structuring element consisting of
@@ -216,11 +185,13 @@ namespace gtl
             bool zeroExterior,
             std::size_t numNeighbors,
             std::array<OffsetType, 3> const* neighbors,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image3<SInteger> temp(input.size(0), input.size(1), input.size(2));
-            Erode(input, zeroExterior, numNeighbors, neighbors, temp);
-            Dilate(temp, numNeighbors, neighbors, output);
+            Erode(input, zeroExterior, numNeighbors, neighbors, temp, numThreads, pool);
+            Dilate(temp, numNeighbors, neighbors, output, numThreads, pool);
         }
 
         // Compute a closing with a structuring element consisting of the
@@ -232,11 +203,12 @@ namespace gtl
         // voxels.
         template <std::size_t N>
         static void Close(Image3<SInteger> const& input, bool zeroExterior,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image3<SInteger> temp(input.size(0), input.size(1), input.size(2));
-            Dilate<N>(input, temp);
-            Erode<N>(temp, zeroExterior, output);
+            Dilate<N>(input, temp, numThreads, pool);
+            Erode<N>(temp, zeroExterior, output, numThreads, pool);
         }
 
         // Compute a closing with a structuring element consisting of
@@ -251,11 +223,13 @@ namespace gtl
             bool zeroExterior,
             std::size_t numNeighbors, 
             std::array<OffsetType, 3> const* neighbors,
-            Image3<SInteger>& output)
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
         {
             Image3<SInteger> temp(input.size(0), input.size(1), input.size(2));
-            Dilate(input, numNeighbors, neighbors, temp);
-            Erode(temp, zeroExterior, numNeighbors, neighbors, output);
+            Dilate(input, numNeighbors, neighbors, temp, numThreads, pool);
+            Erode(temp, zeroExterior, numNeighbors, neighbors, output, numThreads, pool);
         }
 
         // Use a depth-first search for filling a 6-connected background
@@ -301,7 +275,7 @@ namespace gtl
                 point = stack[top];
 
                 // Fill the pixel.
-                image(x, y, z) = 2;
+                image(point[0], point[1], point[2]) = 2;
 
                 neighbor = { point[0] + 1, point[1], point[2] };
                 if (neighbor[0] < xSize &&
@@ -417,7 +391,118 @@ namespace gtl
             maxDistance = static_cast<std::size_t>(distance);
         }
 
+        // Compute the squared Euclidean distance transform of the binary
+        // image, where the foreground is nonzero and the background is 0.
+        // The output value of a voxel is the squared distance to the nearest
+        // background voxel. Voxels outside the domain are not background, so
+        // if the image has no background voxels, all output values are
+        // std::numeric_limits<SInteger>::max(). The transform is exact and
+        // its cost is linear in the number of voxels; see
+        // Morphology<SInteger>::GetSquaredDistance.
+        static void GetSquaredL2Distance(
+            Image3<SInteger> const& input,
+            Image3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                &output != &input && input.size() > 0,
+                "Invalid argument.");
+
+            output.resize({ input.size(0), input.size(1), input.size(2) });
+            Morphology<SInteger>::GetSquaredDistance(input.size(0), input.size(1),
+                input.size(2), input.data(), output.data(), numThreads, pool);
+        }
+
+        // Overloads for images stored in memory-mapped files. The voxels
+        // are processed in place, so the images can be larger than physical
+        // memory. The functions sweep through the volume in z-slabs, one
+        // per thread, which is the access pattern the operating system
+        // pages efficiently. The output image must be writable and have the
+        // bounds of the input image; it is not resized.
+        template <std::size_t N>
+        static std::size_t GetComponents(
+            MappedImage3<SInteger>& image,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            static_assert(N == 6 || N == 18 || N == 26, "Invalid neighborhood type.");
+
+            GTL_ARGUMENT_ASSERT(
+                image.IsWritable(),
+                "Invalid argument.");
+
+            std::array<std::array<OffsetType, 3>, N> neighbors{};
+            GetNeighbors(neighbors);
+            return Morphology<SInteger>::LabelComponents(image.size(0), image.size(1),
+                image.size(2), image.data(), neighbors.size(), neighbors.data(),
+                numThreads, pool);
+        }
+
+        template <std::size_t N>
+        static void Dilate(
+            MappedImage3<SInteger> const& input,
+            MappedImage3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            ValidateMapped(input, output);
+            std::array<std::array<OffsetType, 3>, N> neighbors{};
+            GetNeighbors(neighbors);
+            Morphology<SInteger>::Dilate(input.size(0), input.size(1), input.size(2),
+                input.data(), neighbors.size(), neighbors.data(), output.data(),
+                numThreads, pool);
+        }
+
+        template <std::size_t N>
+        static void Erode(
+            MappedImage3<SInteger> const& input,
+            bool zeroExterior,
+            MappedImage3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            ValidateMapped(input, output);
+            std::array<std::array<OffsetType, 3>, N> neighbors{};
+            GetNeighbors(neighbors);
+            Morphology<SInteger>::Erode(input.size(0), input.size(1), input.size(2),
+                input.data(), zeroExterior, neighbors.size(), neighbors.data(),
+                output.data(), numThreads, pool);
+        }
+
+        static void GetSquaredL2Distance(
+            MappedImage3<SInteger> const& input,
+            MappedImage3<SInteger>& output,
+            std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            ValidateMapped(input, output);
+            Morphology<SInteger>::GetSquaredDistance(input.size(0), input.size(1),
+                input.size(2), input.data(), output.data(), numThreads, pool);
+        }
+
     private:
+        // The relative offsets of the neighbors do not depend on the image
+        // bounds, so an empty Image3 provides them without allocating
+        // voxels.
+        template <std::size_t N>
+        static void GetNeighbors(std::array<std::array<OffsetType, 3>, N>& neighbors)
+        {
+            Image3<SInteger> empty{};
+            empty.GetNeighborhood(neighbors);
+        }
+
+        static void ValidateMapped(
+            MappedImage3<SInteger> const& input,
+            MappedImage3<SInteger> const& output)
+        {
+            GTL_ARGUMENT_ASSERT(
+                &output != &input && input.IsOpen() && output.IsWritable() &&
+                output.size(0) == input.size(0) && output.size(1) == input.size(1) &&
+                output.size(2) == input.size(2),
+                "Invalid argument.");
+        }
+
         friend class UnitTestMorphology3;
     };
 }
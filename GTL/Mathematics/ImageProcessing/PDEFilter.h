@@ -3,15 +3,23 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Support for image processing using finite differences for partial
 // differential equations. PDEFilter is the abstract base class for
 // PDEFilter1, PDEFilter2 and PDEFilter3.
+//
+// The filters that use PDEFilter2::UpdateRows or PDEFilter3::UpdateRows
+// pass a Kernel functor that contains copies of the filter parameters.
+// Members of the filter would have to be reloaded after every store to
+// the output row, because the compiler cannot prove that the store does
+// not modify them. The copies in the kernel can be kept in registers
+// during the row loops.
 
 #include <GTL/Mathematics/Arithmetic/Constants.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <cstddef>
 
 namespace gtl
@@ -68,6 +76,22 @@ namespace gtl
             return mTimeStep;
         }
 
+        // The filters derived from PDEFilter2 and PDEFilter3 partition the
+        // image among numThreads threads during OnUpdate. Each element is
+        // updated by one thread, so the results are the same for any number
+        // of threads. If 'pool' is not null, the threads are those of the
+        // pool; otherwise, std::thread objects are launched on each update.
+        inline void SetNumThreads(std::size_t numThreads, ThreadPool* pool = nullptr)
+        {
+            mNumThreads = (numThreads > 0 ? numThreads : 1);
+            mPool = pool;
+        }
+
+        inline std::size_t GetNumThreads() const
+        {
+            return mNumThreads;
+        }
+
         // This function executes one iteration of the filter.  It calls
         // OnPreUpdate, OnUpdate and OnPostUpdate, in that order.
         void Update()
@@ -86,7 +110,9 @@ namespace gtl
             mMin(C_<T>(0)),
             mOffset(C_<T>(0)),
             mScale(C_<T>(0)),
-            mTimeStep(C_<T>(0))
+            mTimeStep(C_<T>(0)),
+            mNumThreads(1),
+            mPool(nullptr)
         {
             T maxValue = data[0];
             mMin = maxValue;
@@ -169,6 +195,10 @@ namespace gtl
         // depends on the algorithm.
         T mTimeStep;
 
+        // The threads for OnUpdate.
+        std::size_t mNumThreads;
+        ThreadPool* mPool;
+
     private:
         friend class UnitTestPDEFilter;
     };
@@ -3,15 +3,24 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Support for 2D image processing using finite differences for partial
 // differential equations. PDEFilter2 is an abstract base class.
+//
+// The default OnUpdate calls the virtual function OnUpdateSingle for each
+// pixel. A derived class can instead override OnUpdate to call
+// UpdateRows(kernel) with a functor that computes the new value of a pixel
+// from the rows of its 3x3 neighborhood. The functor call is inlined in the
+// loop over the pixels of a row, which the compiler can vectorize. The rows
+// are partitioned among the threads specified by SetNumThreads.
+// GaussianBlur2, CurvatureFlow2 and GradientAnisotropic2 use UpdateRows.
 
 #include <GTL/Mathematics/ImageProcessing/PDEFilter.h>
 #include <GTL/Utility/Multiarray.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
@@ -447,6 +456,75 @@ namespace gtl
         // 1 <= y <= ybound.
         virtual void OnUpdateSingle(std::size_t x, std::size_t y) = 0;
 
+        // Pointers to the source rows of the 3x3 neighborhoods of the pixels
+        // in row y. In the notation for member uy, the y index is in {m,z,p}
+        // as for mUxy, so uy[x-1], uy[x] and uy[x+1] correspond to mUmy,
+        // mUzy and mUpy for pixel x. The (x,y) are in padded coordinates.
+        struct Rows
+        {
+            T const* um;
+            T const* uz;
+            T const* up;
+        };
+
+        Rows GetRows(std::size_t y) const
+        {
+            auto const& F = mBuffer[mSrc];
+            Rows rows{};
+            rows.um = &F(0, y - 1);
+            rows.uz = &F(0, y);
+            rows.up = &F(0, y + 1);
+            return rows;
+        }
+
+        // Update the pixels that are not masked out, where the new value of
+        // pixel (x,y) is kernel(GetRows(y), x). The kernel must not have
+        // side effects, because it is called concurrently and it is also
+        // called for masked-out pixels whose values are then discarded; this
+        // allows the loop over a row to be vectorized.
+        template <typename Kernel>
+        void UpdateRows(Kernel const& kernel)
+        {
+            std::size_t const numThreads = std::max(std::min(this->mNumThreads, mYBound),
+                static_cast<std::size_t>(1));
+
+            auto UpdateRowRange = [this, &kernel, numThreads](std::size_t t)
+            {
+                std::size_t const ymin = 1 + (t * mYBound) / numThreads;
+                std::size_t const ysup = 1 + ((t + 1) * mYBound) / numThreads;
+                for (std::size_t y = ymin; y < ysup; ++y)
+                {
+                    Rows const rows = GetRows(y);
+                    T* dst = &mBuffer[mDst](0, y);
+                    if (mHasMask)
+                    {
+                        std::int32_t const* mask = &mMask(0, y);
+                        for (std::size_t x = 1; x <= mXBound; ++x)
+                        {
+                            T const value = kernel(rows, x);
+                            dst[x] = (mask[x] != 0 ? value : dst[x]);
+                        }
+                    }
+                    else
+                    {
+                        for (std::size_t x = 1; x <= mXBound; ++x)
+                        {
+                            dst[x] = kernel(rows, x);
+                        }
+                    }
+                }
+            };
+
+            if (numThreads > 1)
+            {
+                ForkJoin(this->mPool, numThreads, UpdateRowRange);
+            }
+            else
+            {
+                UpdateRowRange(0);
+            }
+        }
+
         // Copy source data to temporary storage.
         void LookUp5(std::size_t x, std::size_t y)
         {
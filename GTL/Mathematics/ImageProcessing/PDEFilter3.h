@@ -3,15 +3,26 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Support for 3D image processing using finite differences for partial
 // differential equations. PDEFilter3 is an abstract base class.
+//
+// The default OnUpdate calls the virtual function OnUpdateSingle for each
+// voxel. A derived class can instead override OnUpdate to call
+// UpdateRows(kernel) with a functor that computes the new value of a voxel
+// from the rows of its 3x3x3 neighborhood. The functor call is inlined in
+// the loop over the voxels of a row, which the compiler can vectorize. The
+// rows are processed in tiles whose 3x3x3 neighborhoods fit in the cache,
+// and the tiles are partitioned among the threads specified by
+// SetNumThreads. GaussianBlur3, CurvatureFlow3 and GradientAnisotropic3 use
+// UpdateRows.
 
 #include <GTL/Mathematics/ImageProcessing/PDEFilter.h>
 #include <GTL/Utility/Multiarray.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
@@ -875,6 +886,105 @@ namespace gtl
         // and 1 <= z <= zbound.
         virtual void OnUpdateSingle(std::size_t x, std::size_t y, std::size_t z) = 0;
 
+        // Pointers to the source rows of the 3x3x3 neighborhoods of the
+        // voxels in row (y,z). In the notation for member uyz, the y and z
+        // indices are in {m,z,p} as for mUxyz, so uyz[x-1], uyz[x] and
+        // uyz[x+1] correspond to mUmyz, mUzyz and mUpyz for voxel x. The
+        // (x,y,z) are in padded coordinates.
+        struct Rows
+        {
+            T const* umm;
+            T const* uzm;
+            T const* upm;
+            T const* umz;
+            T const* uzz;
+            T const* upz;
+            T const* ump;
+            T const* uzp;
+            T const* upp;
+        };
+
+        Rows GetRows(std::size_t y, std::size_t z) const
+        {
+            auto const& F = mBuffer[mSrc];
+            std::size_t ym = y - 1, yp = y + 1;
+            std::size_t zm = z - 1, zp = z + 1;
+            Rows rows{};
+            rows.umm = &F(0, ym, zm);
+            rows.uzm = &F(0, y, zm);
+            rows.upm = &F(0, yp, zm);
+            rows.umz = &F(0, ym, z);
+            rows.uzz = &F(0, y, z);
+            rows.upz = &F(0, yp, z);
+            rows.ump = &F(0, ym, zp);
+            rows.uzp = &F(0, y, zp);
+            rows.upp = &F(0, yp, zp);
+            return rows;
+        }
+
+        // Update the voxels that are not masked out, where the new value
+        // of voxel (x,y,z) is kernel(GetRows(y,z), x). The kernel must not
+        // have side effects, because it is called concurrently and it is
+        // also called for masked-out voxels whose values are then
+        // discarded; this allows the loop over a row to be vectorized.
+        template <typename Kernel>
+        void UpdateRows(Kernel const& kernel)
+        {
+            // A tile is a block of rows in each of a range of slices. The
+            // number of rows is chosen so that the source rows of the tile
+            // for 3 consecutive slices and the destination rows fit in a
+            // 256 KB cache.
+            std::size_t const rowBytes = (mXBound + 2) * sizeof(T);
+            std::size_t const tileRows = std::max((static_cast<std::size_t>(1) << 18) / (4 * rowBytes),
+                static_cast<std::size_t>(1));
+
+            std::size_t const numThreads = std::max(std::min(this->mNumThreads, mZBound),
+                static_cast<std::size_t>(1));
+
+            auto UpdateSlices = [this, &kernel, tileRows, numThreads](std::size_t t)
+            {
+                std::size_t const zmin = 1 + (t * mZBound) / numThreads;
+                std::size_t const zsup = 1 + ((t + 1) * mZBound) / numThreads;
+                for (std::size_t ymin = 1; ymin <= mYBound; ymin += tileRows)
+                {
+                    std::size_t const ysup = std::min(ymin + tileRows, mYBound + 1);
+                    for (std::size_t z = zmin; z < zsup; ++z)
+                    {
+                        for (std::size_t y = ymin; y < ysup; ++y)
+                        {
+                            Rows const rows = GetRows(y, z);
+                            T* dst = &mBuffer[mDst](0, y, z);
+                            if (mHasMask)
+                            {
+                                std::int32_t const* mask = &mMask(0, y, z);
+                                for (std::size_t x = 1; x <= mXBound; ++x)
+                                {
+                                    T const value = kernel(rows, x);
+                                    dst[x] = (mask[x] != 0 ? value : dst[x]);
+                                }
+                            }
+                            else
+                            {
+                                for (std::size_t x = 1; x <= mXBound; ++x)
+                                {
+                                    dst[x] = kernel(rows, x);
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            if (numThreads > 1)
+            {
+                ForkJoin(this->mPool, numThreads, UpdateSlices);
+            }
+            else
+            {
+                UpdateSlices(0);
+            }
+        }
+
         // Copy source data to temporary storage.
         void LookUp7(std::size_t x, std::size_t y, std::size_t z)
         {
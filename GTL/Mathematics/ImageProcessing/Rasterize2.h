@@ -3,11 +3,19 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
 // Support for drawing pixels in a 2D rectangular lattice.
+//
+// The drawing functions are templates on the visitor type, so a lambda or
+// functor is called directly rather than through std::function; Callback
+// remains available for code that stores visitors. The functions with the
+// suffix Spans visit the same pixels as the corresponding functions, but
+// they report each maximal run of pixels in a row as a single call
+// S(y, x0, x1) with x0 <= x1, which visits the pixels (x,y) for
+// x0 <= x <= x1. The spans of a single call are disjoint.
 
 #include <array>
 #include <cstddef>
@@ -28,7 +36,8 @@ namespace gtl
         using Callback = std::function<void(SInteger, SInteger)>;
 
         // Visit a single pixel at (x,y).
-        static void DrawPixel(SInteger x, SInteger y, Callback const& F)
+        template <typename Visitor>
+        static void DrawPixel(SInteger x, SInteger y, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -40,8 +49,9 @@ namespace gtl
 
         // Visit pixels in a (2 * thick + 1)^2 square centered at (x,y). If
         // thick is a negative number, no pixels are drawn.
+        template <typename Visitor>
         static void DrawThickPixel(SInteger x, SInteger y, SInteger thick,
-            Callback const& F)
+            Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -58,8 +68,9 @@ namespace gtl
         }
 
         // Visit pixels using Bresenham's line drawing algorithm.
+        template <typename Visitor>
         static void DrawLine(SInteger x0, SInteger y0, SInteger x1, SInteger y1,
-            Callback const& F)
+            Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -139,8 +150,9 @@ namespace gtl
         // Visit pixels using Bresenham's circle drawing algorithm. Set
         // 'solid' to false for drawing only the circle. Set 'solid' to true
         // to draw all pixels on and inside the circle.
+        template <typename Visitor>
         static void DrawCircle(SInteger xCenter, SInteger yCenter,
-            SInteger radius, bool solid, Callback const& F)
+            SInteger radius, bool solid, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -211,8 +223,9 @@ namespace gtl
         // Visit pixels in a rectangle of the specified dimensions. Set
         // 'solid' to false for drawing only the rectangle. Set 'solid' to
         // true to draw all pixels on and inside the rectangle.
+        template <typename Visitor>
         static void DrawRectangle(SInteger xMin, SInteger yMin, SInteger xMax,
-            SInteger yMax, bool solid, Callback const& F)
+            SInteger yMax, bool solid, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -247,8 +260,9 @@ namespace gtl
         // Visit the pixels using Bresenham's algorithm for the axis-aligned
         // ellipse ((x-xc)/a)^2 + ((y-yc)/b)^2 = 1, where xCenter is xc,
         // yCenter is yc, xExtent is a and yExtent is b.
+        template <typename Visitor>
         static void DrawEllipse(SInteger xCenter, SInteger yCenter,
-            SInteger xExtent, SInteger yExtent, Callback const& F)
+            SInteger xExtent, SInteger yExtent, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -318,15 +332,170 @@ namespace gtl
             }
         }
 
+        // Visit the pixels of DrawThickPixel as spans.
+        template <typename SpanVisitor>
+        static void DrawThickPixelSpans(SInteger x, SInteger y, SInteger thick,
+            SpanVisitor const& S)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            for (SInteger dy = -thick; dy <= thick; ++dy)
+            {
+                S(y + dy, x - thick, x + thick);
+            }
+        }
+
+        // Visit the pixels of DrawLine as spans. A line that single-steps in
+        // the x-direction has one span per row; a line that single-steps in
+        // the y-direction has spans of one pixel.
+        template <typename SpanVisitor>
+        static void DrawLineSpans(SInteger x0, SInteger y0, SInteger x1, SInteger y1,
+            SpanVisitor const& S)
+        {
+            bool started = false;
+            SInteger ySpan = 0, xSpanMin = 0, xSpanMax = 0;
+            DrawLine(x0, y0, x1, y1,
+                [&](SInteger x, SInteger y)
+                {
+                    if (started && y == ySpan && (x == xSpanMax + 1 || x + 1 == xSpanMin))
+                    {
+                        xSpanMin = (x < xSpanMin ? x : xSpanMin);
+                        xSpanMax = (x > xSpanMax ? x : xSpanMax);
+                    }
+                    else
+                    {
+                        if (started)
+                        {
+                            S(ySpan, xSpanMin, xSpanMax);
+                        }
+                        started = true;
+                        ySpan = y;
+                        xSpanMin = x;
+                        xSpanMax = x;
+                    }
+                });
+            S(ySpan, xSpanMin, xSpanMax);
+        }
+
+        // Visit the pixels of DrawCircle with 'solid' set to true as spans.
+        // The column of pixels with x-offset u from the center that is drawn
+        // by DrawCircle has y-offsets v with |v| <= h(u). The span of row
+        // v is therefore the set of u with h(u) >= |v|, which is computed
+        // from the Bresenham steps without visiting pixels more than once.
+        template <typename SpanVisitor>
+        static void DrawCircleSpans(SInteger xCenter, SInteger yCenter,
+            SInteger radius, SpanVisitor const& S)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            if (radius < 0)
+            {
+                return;
+            }
+
+            // halfWidth[v] is the maximum u of the columns with h(u) = v,
+            // or -1 when there is no such column. The suffix maxima are the
+            // half-widths of the rows.
+            std::size_t const numRows = static_cast<std::size_t>(radius) + 1;
+            std::vector<SInteger> halfWidth(numRows, -1);
+            for (SInteger x = 0, y = radius, dec = 3 - 2 * radius; x <= y; ++x)
+            {
+                std::size_t sy = static_cast<std::size_t>(y);
+                std::size_t sx = static_cast<std::size_t>(x);
+                halfWidth[sy] = (x > halfWidth[sy] ? x : halfWidth[sy]);
+                halfWidth[sx] = (y > halfWidth[sx] ? y : halfWidth[sx]);
+
+                if (dec >= 0)
+                {
+                    dec += -4 * (y--) + 4;
+                }
+                dec += 4 * x + 6;
+            }
+
+            for (std::size_t v = numRows - 1; v > 0; --v)
+            {
+                if (halfWidth[v] > halfWidth[v - 1])
+                {
+                    halfWidth[v - 1] = halfWidth[v];
+                }
+            }
+
+            for (SInteger v = -radius; v <= radius; ++v)
+            {
+                SInteger u = halfWidth[static_cast<std::size_t>(v < 0 ? -v : v)];
+                if (u >= 0)
+                {
+                    S(yCenter + v, xCenter - u, xCenter + u);
+                }
+            }
+        }
+
+        // Visit the pixels of DrawRectangle as spans. The bounds are used as
+        // given, so the spans cover the pixels of DrawRectangle also when
+        // xMin > xMax or yMin > yMax.
+        template <typename SpanVisitor>
+        static void DrawRectangleSpans(SInteger xMin, SInteger yMin, SInteger xMax,
+            SInteger yMax, bool solid, SpanVisitor const& S)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            if (solid)
+            {
+                if (xMin <= xMax)
+                {
+                    for (SInteger y = yMin; y <= yMax; ++y)
+                    {
+                        S(y, xMin, xMax);
+                    }
+                }
+                return;
+            }
+
+            SInteger const x0 = (xMin <= xMax ? xMin : xMax);
+            SInteger const x1 = (xMin <= xMax ? xMax : xMin);
+            SInteger const y0 = (yMin <= yMax ? yMin : yMax);
+            SInteger const y1 = (yMin <= yMax ? yMax : yMin);
+            for (SInteger y = y0; y <= y1; ++y)
+            {
+                if (y == yMin || y == yMax)
+                {
+                    if (xMin <= xMax)
+                    {
+                        S(y, xMin, xMax);
+                    }
+                }
+                else if (yMin < y && y < yMax)
+                {
+                    if (x1 - x0 <= 1)
+                    {
+                        S(y, x0, x1);
+                    }
+                    else
+                    {
+                        S(y, x0, x0);
+                        S(y, x1, x1);
+                    }
+                }
+            }
+        }
+
         // Use a depth-first search for filling a 4-connected region. This is
         // nonrecursive, simulated by using a heap-allocated stack. The input
         // (x,y) is the seed point that starts the fill. The x-value is in
         // {0..xSize-1} and the y-value is in {0..ySize-1}.
-        template <typename PixelType>
+        template <typename PixelType, typename SetCallback, typename GetCallback>
         static void DrawFloodFill4(SInteger x, SInteger y, SInteger xSize, SInteger ySize,
             PixelType foreground, PixelType background,
-            std::function<void(SInteger, SInteger, PixelType)> const& setCallback,
-            std::function<PixelType(SInteger, SInteger)> const& getCallback)
+            SetCallback const& setCallback, GetCallback const& getCallback)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -3,10 +3,20 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
+// Support for drawing voxels in a 3D rectangular lattice.
+//
+// The drawing functions are templates on the visitor type, so a lambda or
+// functor is called directly rather than through std::function; Callback
+// remains available for code that stores visitors. The functions with the
+// suffix Spans visit the same voxels as the corresponding functions, but
+// they report each maximal run of voxels in a row as a single call
+// S(y, z, x0, x1) with x0 <= x1, which visits the voxels (x,y,z) for
+// x0 <= x <= x1. The spans of a single call are disjoint.
+
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -26,7 +36,8 @@ namespace gtl
         using Callback = std::function<void(SInteger, SInteger, SInteger)>;
 
         // Visit a single voxel at (x,y,z).
-        static void DrawVoxel(SInteger x, SInteger y, SInteger z, Callback const& F)
+        template <typename Visitor>
+        static void DrawVoxel(SInteger x, SInteger y, SInteger z, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -38,8 +49,9 @@ namespace gtl
 
         // Visit voxels in a (2 * thick + 1)^3 cube centered at (x,y,z). If
         // thick is a negative number, no voxels are drawn.
+        template <typename Visitor>
         static void DrawThickVoxel(SInteger x, SInteger y, SInteger z, SInteger thick,
-            Callback const& F)
+            Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -59,8 +71,9 @@ namespace gtl
         }
 
         // Visit voxels using Bresenham's line drawing algorithm.
+        template <typename Visitor>
         static void DrawLine(SInteger x0, SInteger y0, SInteger z0,
-            SInteger x1, SInteger y1, SInteger z1, Callback const& F)
+            SInteger x1, SInteger y1, SInteger z1, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -195,8 +208,9 @@ namespace gtl
         // Visit voxels in a box of the specified dimensions. Set 'solid'
         // to false for drawing only the box. Set 'solid' to true to draw
         // all pixels on and inside the rectangle.
+        template <typename Visitor>
         static void DrawBox(SInteger xMin, SInteger yMin, SInteger xMax,
-            SInteger yMax, SInteger zMin, SInteger zMax, bool solid, Callback const& F)
+            SInteger yMax, SInteger zMin, SInteger zMax, bool solid, Visitor const& F)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
@@ -229,7 +243,7 @@ namespace gtl
                 }
 
                 // Draw faces y = yMin and y = yMax.
-                for (SInteger z = zMin + 1; z < zMax - 1; ++z)
+                for (SInteger z = zMin + 1; z <= zMax - 1; ++z)
                 {
                     for (SInteger x = xMin; x <= xMax; ++x)
                     {
@@ -239,9 +253,9 @@ namespace gtl
                 }
 
                 // Draw faces x = xMin and x = xMax.
-                for (SInteger z = zMin + 1; z < zMax - 1; ++zMax)
+                for (SInteger z = zMin + 1; z <= zMax - 1; ++z)
                 {
-                    for (SInteger y = yMin + 1; y < yMax - 1; ++yMax)
+                    for (SInteger y = yMin + 1; y <= yMax - 1; ++y)
                     {
                         F(xMin, y, z);
                         F(xMax, y, z);
@@ -250,17 +264,138 @@ namespace gtl
             }
         }
 
+        // Visit the voxels of DrawThickVoxel as spans.
+        template <typename SpanVisitor>
+        static void DrawThickVoxelSpans(SInteger x, SInteger y, SInteger z, SInteger thick,
+            SpanVisitor const& S)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            for (SInteger dz = -thick; dz <= thick; ++dz)
+            {
+                for (SInteger dy = -thick; dy <= thick; ++dy)
+                {
+                    S(y + dy, z + dz, x - thick, x + thick);
+                }
+            }
+        }
+
+        // Visit the voxels of DrawLine as spans. A line that single-steps in
+        // the x-direction has runs of voxels with the same y and z; a line
+        // that single-steps in another direction has spans of one voxel.
+        template <typename SpanVisitor>
+        static void DrawLineSpans(SInteger x0, SInteger y0, SInteger z0,
+            SInteger x1, SInteger y1, SInteger z1, SpanVisitor const& S)
+        {
+            bool started = false;
+            SInteger ySpan = 0, zSpan = 0, xSpanMin = 0, xSpanMax = 0;
+            DrawLine(x0, y0, z0, x1, y1, z1,
+                [&](SInteger x, SInteger y, SInteger z)
+                {
+                    if (started && y == ySpan && z == zSpan &&
+                        (x == xSpanMax + 1 || x + 1 == xSpanMin))
+                    {
+                        xSpanMin = (x < xSpanMin ? x : xSpanMin);
+                        xSpanMax = (x > xSpanMax ? x : xSpanMax);
+                    }
+                    else
+                    {
+                        if (started)
+                        {
+                            S(ySpan, zSpan, xSpanMin, xSpanMax);
+                        }
+                        started = true;
+                        ySpan = y;
+                        zSpan = z;
+                        xSpanMin = x;
+                        xSpanMax = x;
+                    }
+                });
+            S(ySpan, zSpan, xSpanMin, xSpanMax);
+        }
+
+        // Visit the voxels of DrawBox as spans. The bounds are used as given,
+        // so the spans cover the voxels of DrawBox also when the bounds of
+        // an axis are not ordered.
+        template <typename SpanVisitor>
+        static void DrawBoxSpans(SInteger xMin, SInteger yMin, SInteger xMax,
+            SInteger yMax, SInteger zMin, SInteger zMax, bool solid, SpanVisitor const& S)
+        {
+            static_assert(
+                std::is_same<SInteger, std::int32_t>::value ||
+                std::is_same<SInteger, std::int64_t>::value,
+                "SInteger must be std::int32_t or std::int64_t.");
+
+            if (solid)
+            {
+                if (xMin <= xMax)
+                {
+                    for (SInteger z = zMin; z <= zMax; ++z)
+                    {
+                        for (SInteger y = yMin; y <= yMax; ++y)
+                        {
+                            S(y, z, xMin, xMax);
+                        }
+                    }
+                }
+                return;
+            }
+
+            SInteger const x0 = (xMin <= xMax ? xMin : xMax);
+            SInteger const x1 = (xMin <= xMax ? xMax : xMin);
+            SInteger const y0 = (yMin <= yMax ? yMin : yMax);
+            SInteger const y1 = (yMin <= yMax ? yMax : yMin);
+            SInteger const z0 = (zMin <= zMax ? zMin : zMax);
+            SInteger const z1 = (zMin <= zMax ? zMax : zMin);
+            for (SInteger z = z0; z <= z1; ++z)
+            {
+                bool const zFace = (z == zMin || z == zMax);
+                if (!zFace && !(zMin < z && z < zMax))
+                {
+                    continue;
+                }
+
+                for (SInteger y = y0; y <= y1; ++y)
+                {
+                    // The rows of the z-faces and of the y-faces span the
+                    // box in x. The other rows contain the x-faces.
+                    bool const row = (zFace ? (yMin <= y && y <= yMax) : (y == yMin || y == yMax));
+                    if (row)
+                    {
+                        if (xMin <= xMax)
+                        {
+                            S(y, z, xMin, xMax);
+                        }
+                    }
+                    else if (!zFace && yMin < y && y < yMax)
+                    {
+                        if (x1 - x0 <= 1)
+                        {
+                            S(y, z, x0, x1);
+                        }
+                        else
+                        {
+                            S(y, z, x0, x0);
+                            S(y, z, x1, x1);
+                        }
+                    }
+                }
+            }
+        }
+
         // Use a depth-first search for filling a 6-connected region. This is
         // nonrecursive, simulated by using a heap-allocated stack. The input
         // (x,y,z) is the seed point that starts the fill. The x-value is in
         // {0..xSize-1}, the y-value is in {0..ySize-1} and the z-value is in
         // {0..zSize-1}.
-        template <typename VoxelType>
+        template <typename VoxelType, typename SetCallback, typename GetCallback>
         static void DrawFloodFill6(SInteger x, SInteger y, SInteger z,
             SInteger xSize, SInteger ySize, SInteger zSize,
             VoxelType foreground, VoxelType background,
-            std::function<void(SInteger, SInteger, SInteger, VoxelType)> const& setCallback,
-            std::function<VoxelType(SInteger, SInteger, SInteger)> const& getCallback)
+            SetCallback const& setCallback, GetCallback const& getCallback)
         {
             static_assert(
                 std::is_same<SInteger, std::int32_t>::value ||
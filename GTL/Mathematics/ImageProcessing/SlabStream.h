@@ -0,0 +1,127 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// SlabStream supports processing a 3D image one z-slab at a time, which is
+// used by the surface extractors to handle images that are too large to be
+// stored in memory. The image has zBound slices. The zBound-1 layers of
+// voxels between consecutive slices are partitioned into slabs of
+// slabHeight layers; the last slab can have fewer layers. The slab whose
+// layers are zmin <= z < zmax requires slices zmin through zmax, so
+// consecutive slabs share a boundary slice.
+//
+// The slabs are processed in batches of numThreads slabs. For each batch,
+//   load(t, zmin, zmax) is called on the calling thread for the slabs of
+//     the batch in increasing z-order, where t is the index of the slab in
+//     the batch;
+//   process(t, zmin, zmax) is called concurrently for the slabs of the
+//     batch;
+//   merge(t, zmin, zmax) is called on the calling thread for the slabs of
+//     the batch in increasing z-order.
+// The memory required for the image is that for numThreads slabs, which is
+// numThreads * (slabHeight + 1) slices. If 'pool' is not null, the process
+// calls are executed by the pool; otherwise, std::thread objects are
+// launched.
+
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/HashedUnique.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace gtl
+{
+    class SlabStream
+    {
+    public:
+        template <typename Load, typename Process, typename Merge>
+        static void Execute(std::size_t zBound, std::size_t slabHeight,
+            Load const& load, Process const& process, Merge const& merge,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                zBound > 1 && slabHeight > 0,
+                "Invalid input.");
+
+            std::size_t const numLayers = zBound - 1;
+            std::size_t const numSlabs = (numLayers + slabHeight - 1) / slabHeight;
+            numThreads = std::max(std::min(numThreads, numSlabs), static_cast<std::size_t>(1));
+
+            std::vector<std::size_t> zmin(numThreads), zmax(numThreads);
+            for (std::size_t s0 = 0; s0 < numSlabs; s0 += numThreads)
+            {
+                std::size_t const numBatch = std::min(numThreads, numSlabs - s0);
+                for (std::size_t t = 0; t < numBatch; ++t)
+                {
+                    zmin[t] = (s0 + t) * slabHeight;
+                    zmax[t] = std::min(zmin[t] + slabHeight, numLayers);
+                    load(t, zmin[t], zmax[t]);
+                }
+
+                if (numBatch > 1)
+                {
+                    ForkJoin(pool, numBatch,
+                        [&](std::size_t t)
+                        {
+                            process(t, zmin[t], zmax[t]);
+                        });
+                }
+                else
+                {
+                    process(0, zmin[0], zmax[0]);
+                }
+
+                for (std::size_t t = 0; t < numBatch; ++t)
+                {
+                    merge(t, zmin[t], zmax[t]);
+                }
+            }
+        }
+
+        // Match the elements on the boundary slice shared by two slabs. The
+        // elements 0 through numPrevious-1 are those of the previous slab
+        // and the elements numPrevious through numPrevious+numCurrent-1 are
+        // those of the current slab. The elements of each slab must be
+        // unique. The callbacks are those of HashedUnique::Execute. On
+        // return, match[c] is the index of the element of the previous slab
+        // that is equal to element numPrevious+c, or 'unmatched' when there
+        // is no such element.
+        template <typename HashOf, typename IsEqual>
+        static void Match(std::size_t numPrevious, std::size_t numCurrent,
+            HashOf const& hashOf, IsEqual const& isEqual,
+            std::vector<std::size_t>& match)
+        {
+            match.assign(numCurrent, static_cast<std::size_t>(unmatched));
+            if (numPrevious == 0 || numCurrent == 0)
+            {
+                return;
+            }
+
+            std::vector<std::size_t> inToOut{}, outToIn{};
+            HashedUnique::Execute(numPrevious + numCurrent, hashOf, isEqual,
+                inToOut, outToIn);
+
+            for (std::size_t c = 0; c < numCurrent; ++c)
+            {
+                std::size_t const first = outToIn[inToOut[numPrevious + c]];
+                if (first < numPrevious)
+                {
+                    match[c] = first;
+                }
+            }
+        }
+
+        static std::size_t constexpr unmatched = std::numeric_limits<std::size_t>::max();
+
+    private:
+        friend class UnitTestSlabStream;
+    };
+}
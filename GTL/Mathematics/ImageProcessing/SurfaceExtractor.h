@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -11,13 +11,15 @@
 // SurfaceExtractorTetrahedra.
 
 #include <GTL/Mathematics/Arithmetic/Constants.h>
+#include <GTL/Mathematics/ImageProcessing/SlabStream.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/HashedUnique.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <map>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -229,84 +231,101 @@ namespace gtl
         virtual void Extract(IndexType level, std::vector<Vertex>& vertices,
             std::vector<Triangle>& triangles) = 0;
 
+        // The duplicate removal is multithreaded when numThreads > 1. Read
+        // the comments for MakeUnique.
         void Extract(IndexType level, bool removeDuplicateVertices,
-            std::vector<std::array<T, 3>>& vertices, std::vector<Triangle>& triangles)
+            std::vector<std::array<T, 3>>& vertices, std::vector<Triangle>& triangles,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
         {
             std::vector<Vertex> rationalVertices{};
             Extract(level, rationalVertices, triangles);
             if (removeDuplicateVertices)
             {
-                MakeUnique(rationalVertices, triangles);
+                MakeUnique(rationalVertices, triangles, numThreads, pool);
             }
             Convert(rationalVertices, vertices);
         }
 
         // The extraction has duplicate vertices on edges shared by voxels.
-        // This function will eliminate the duplicates.
-        void MakeUnique(std::vector<Vertex>& vertices, std::vector<Triangle>& triangles)
+        // This function will eliminate the duplicates. The unique vertices
+        // and triangles are numbered in the order of their first occurrence
+        // in the inputs, which is the order produced by inserting them into
+        // std::map<Vertex, std::size_t> and std::map<Triangle, std::size_t>.
+        // The duplicates are found by hashing the vertices with their
+        // fractions reduced to lowest terms. When numThreads > 1, the hash
+        // tables are partitioned among threads; the output is the same for
+        // any number of threads. Read the comments in HashedUnique.h.
+        void MakeUnique(std::vector<Vertex>& vertices, std::vector<Triangle>& triangles,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
         {
-            std::size_t numVertices = vertices.size();
-            std::size_t numTriangles = triangles.size();
+            std::size_t const numVertices = vertices.size();
+            std::size_t const numTriangles = triangles.size();
             if (numVertices == 0 || numTriangles == 0)
             {
                 return;
             }
 
-            // Compute the map of unique vertices and assign to them new and
-            // unique indices.
-            std::map<Vertex, std::size_t> vmap{};
-            std::size_t nextVertex = 0;
-            for (std::size_t v = 0; v < numVertices; ++v)
-            {
-                // Keep only unique vertices.
-                auto result = vmap.insert(std::make_pair(vertices[v], nextVertex));
-                if (result.second)
+            // Compute the unique vertices and assign to them new and unique
+            // indices.
+            std::vector<std::size_t> inToOut{}, outToIn{};
+            HashedUnique::Execute(numVertices,
+                [&vertices](std::size_t i)
                 {
-                    ++nextVertex;
-                }
+                    return GetHash(vertices[i]);
+                },
+                [&vertices](std::size_t i, std::size_t j)
+                {
+                    return vertices[i] == vertices[j];
+                },
+                inToOut, outToIn, numThreads, pool);
+
+            std::vector<Vertex> uniqueVertices(outToIn.size());
+            for (std::size_t k = 0; k < outToIn.size(); ++k)
+            {
+                uniqueVertices[k] = vertices[outToIn[k]];
             }
+            vertices = std::move(uniqueVertices);
 
-            // Compute the map of unique triangles and assign to them new and
-            // unique indices.
-            std::map<Triangle, std::size_t> tmap{};
-            std::size_t nextTriangle = 0;
-            for (std::size_t t = 0; t < numTriangles; ++t)
+            // Replace old vertex indices by new vertex indices.
+            for (auto& triangle : triangles)
             {
-                Triangle& triangle = triangles[t];
                 for (std::size_t i = 0; i < 3; ++i)
                 {
-                    auto iter = vmap.find(vertices[triangle.v[i]]);
                     GTL_ARGUMENT_ASSERT(
-                        iter != vmap.end(),
-                        "Expecting the vertex to be in the vmap.");
-                    triangle.v[i] = iter->second;
-                }
-
-                // Keep only unique triangles.
-                auto result = tmap.insert(std::make_pair(triangle, nextTriangle));
-                if (result.second)
-                {
-                    ++nextTriangle;
+                        triangle.v[i] < numVertices,
+                        "Invalid vertex index.");
+                    triangle.v[i] = inToOut[triangle.v[i]];
                 }
             }
 
-            // Pack the vertices into an array.
-            vertices.resize(vmap.size());
-            for (auto const& element : vmap)
-            {
-                vertices[element.second] = element.first;
-            }
+            // Compute the unique triangles and assign to them new and unique
+            // indices.
+            HashedUnique::Execute(numTriangles,
+                [&triangles](std::size_t t)
+                {
+                    std::uint64_t hash = 0;
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        hash = HashedUnique::Combine(hash, static_cast<std::uint64_t>(triangles[t].v[i]));
+                    }
+                    return hash;
+                },
+                [&triangles](std::size_t t0, std::size_t t1)
+                {
+                    return triangles[t0] == triangles[t1];
+                },
+                inToOut, outToIn, numThreads, pool);
 
-            // Pack the triangles into an array.
-            triangles.resize(tmap.size());
-            for (auto const& element : tmap)
+            std::vector<Triangle> uniqueTriangles(outToIn.size());
+            for (std::size_t k = 0; k < outToIn.size(); ++k)
             {
-                triangles[element.second] = element.first;
+                uniqueTriangles[k] = triangles[outToIn[k]];
             }
+            triangles = std::move(uniqueTriangles);
         }
 
         // Convert from Vertex to std::array<T, 3> rationals.
-        void Convert(std::vector<Vertex> const& input, std::vector<std::array<T, 3>>& output)
+        static void Convert(std::vector<Vertex> const& input, std::vector<std::array<T, 3>>& output)
         {
             output.resize(input.size());
             for (std::size_t i = 0; i < input.size(); ++i)
@@ -488,6 +507,331 @@ namespace gtl
 
         virtual std::array<T, 3> GetGradient(std::array<T, 3> const& pos) = 0;
 
+        // Support for the slab-streaming extraction of the derived classes.
+        // Each slab is extracted by an Extractor object whose image is the
+        // slices of the slab, which produces the extraction of the entire
+        // image restricted to the slab. The vertex z-coordinates are then
+        // translated by the slab origin zmin. A vertex z-coordinate is
+        // zNumer/zDenom = z + c/zDenom for the voxel z that generates it, so
+        // the translation zNumer + zmin * zDenom reproduces the numerator and
+        // denominator of the extraction of the entire image.
+        //
+        // When 'stitch' is true, the duplicate vertices and triangles of
+        // each slab are removed and then the vertices and triangles on the
+        // bottom slice of the slab are matched to those on the top slice of
+        // the previous slab. The unique vertices and triangles are numbered
+        // in the order of their first occurrence, so the output is that of
+        // Extract followed by MakeUnique. When 'isTriangleSet' is true, the
+        // Extractor produces unique vertices and stores the triangles in
+        // std::set<Triangle>, rejecting a triangle whose opposite-oriented
+        // triangle is already in the set. The matching on the boundary slice
+        // then ignores orientation and the triangles are sorted at the end.
+        template <typename Extractor, typename GetSlice>
+        static void ExtractSlabs(std::size_t xBound, std::size_t yBound, std::size_t zBound,
+            GetSlice const& getSlice, IndexType level, bool stitch, bool isTriangleSet,
+            std::vector<Vertex>& vertices, std::vector<Triangle>& triangles,
+            std::size_t slabHeight, std::size_t numThreads, ThreadPool* pool)
+        {
+            GTL_ARGUMENT_ASSERT(
+                xBound > 1 && yBound > 1 && zBound > 1 && slabHeight > 0,
+                "Invalid input.");
+
+            vertices.clear();
+            triangles.clear();
+
+            std::size_t const xyBound = xBound * yBound;
+            std::size_t const numSlots = std::max(numThreads, static_cast<std::size_t>(1));
+            std::vector<std::vector<IndexType>> slabVoxels(numSlots);
+            std::vector<std::vector<Vertex>> slabVertices(numSlots);
+            std::vector<std::vector<Triangle>> slabTriangles(numSlots);
+            std::vector<IndexType> topSlice{};
+
+            // The vertices and triangles of the previous slab that are on
+            // its top slice, which is the bottom slice of the current slab.
+            std::vector<Vertex> boundaryVertices{};
+            std::vector<std::size_t> boundaryIndices{};
+            std::vector<Triangle> boundaryTriangles{};
+
+            auto Load = [&](std::size_t t, std::size_t zmin, std::size_t zmax)
+            {
+                auto& voxels = slabVoxels[t];
+                voxels.resize((zmax - zmin + 1) * xyBound);
+                std::size_t z = zmin;
+                if (z > 0)
+                {
+                    std::copy(topSlice.begin(), topSlice.end(), voxels.begin());
+                    ++z;
+                }
+                for (; z <= zmax; ++z)
+                {
+                    getSlice(z, &voxels[(z - zmin) * xyBound]);
+                }
+
+                auto const top = voxels.begin() + (zmax - zmin) * xyBound;
+                topSlice.assign(top, top + xyBound);
+            };
+
+            auto Process = [&](std::size_t t, std::size_t zmin, std::size_t zmax)
+            {
+                auto& slabV = slabVertices[t];
+                auto& slabT = slabTriangles[t];
+                Extractor extractor(xBound, yBound, zmax - zmin + 1, slabVoxels[t].data());
+                extractor.Extract(level, slabV, slabT);
+                if (stitch && !isTriangleSet)
+                {
+                    extractor.MakeUnique(slabV, slabT);
+                }
+
+                std::int64_t const zOrigin = static_cast<std::int64_t>(zmin);
+                for (auto& vertex : slabV)
+                {
+                    vertex.zNumer += zOrigin * vertex.zDenom;
+                }
+            };
+
+            auto Merge = [&](std::size_t t, std::size_t zmin, std::size_t zmax)
+            {
+                auto& slabV = slabVertices[t];
+                auto& slabT = slabTriangles[t];
+                if (stitch)
+                {
+                    MergeSlab(slabV, slabT, zmin, zmax, isTriangleSet, boundaryVertices,
+                        boundaryIndices, boundaryTriangles, vertices, triangles);
+                }
+                else
+                {
+                    std::size_t const vbase = vertices.size();
+                    vertices.insert(vertices.end(), slabV.begin(), slabV.end());
+                    for (auto triangle : slabT)
+                    {
+                        for (std::size_t i = 0; i < 3; ++i)
+                        {
+                            triangle.v[i] += vbase;
+                        }
+                        triangles.push_back(triangle);
+                    }
+                }
+                slabV.clear();
+                slabT.clear();
+            };
+
+            SlabStream::Execute(zBound, slabHeight, Load, Process, Merge, numThreads, pool);
+
+            if (isTriangleSet)
+            {
+                std::sort(triangles.begin(), triangles.end());
+            }
+        }
+
+        // Append the unique vertices and triangles of a slab to the output,
+        // matching those on the bottom slice of the slab with the boundary
+        // vertices and triangles of the previous slab. On return, the
+        // boundary vertices and triangles are those on the top slice of the
+        // slab.
+        static void MergeSlab(std::vector<Vertex> const& slabV, std::vector<Triangle> const& slabT,
+            std::size_t zmin, std::size_t zmax, bool isTriangleSet,
+            std::vector<Vertex>& boundaryVertices, std::vector<std::size_t>& boundaryIndices,
+            std::vector<Triangle>& boundaryTriangles,
+            std::vector<Vertex>& vertices, std::vector<Triangle>& triangles)
+        {
+            // Classify the slab vertices as on the bottom slice (bit 1), on
+            // the top slice (bit 2) or neither.
+            std::int64_t const zLow = static_cast<std::int64_t>(zmin);
+            std::int64_t const zHigh = static_cast<std::int64_t>(zmax);
+            std::vector<std::uint8_t> onSlice(slabV.size());
+            std::vector<std::size_t> bottom{};
+            for (std::size_t i = 0; i < slabV.size(); ++i)
+            {
+                Vertex const& vertex = slabV[i];
+                onSlice[i] = 0;
+                if (vertex.zNumer == zLow * vertex.zDenom)
+                {
+                    onSlice[i] = 1;
+                    bottom.push_back(i);
+                }
+                else if (vertex.zNumer == zHigh * vertex.zDenom)
+                {
+                    onSlice[i] = 2;
+                }
+            }
+
+            // Match the bottom vertices to the boundary vertices and number
+            // the remaining vertices after the previous output vertices.
+            std::size_t const numBV = boundaryVertices.size();
+            std::vector<std::size_t> match{};
+            SlabStream::Match(numBV, bottom.size(),
+                [&](std::size_t k)
+                {
+                    return GetHash(k < numBV ? boundaryVertices[k] : slabV[bottom[k - numBV]]);
+                },
+                [&](std::size_t k0, std::size_t k1)
+                {
+                    Vertex const& v0 = (k0 < numBV ? boundaryVertices[k0] : slabV[bottom[k0 - numBV]]);
+                    Vertex const& v1 = (k1 < numBV ? boundaryVertices[k1] : slabV[bottom[k1 - numBV]]);
+                    return v0 == v1;
+                },
+                match);
+
+            std::vector<std::size_t> slabToOut(slabV.size(), static_cast<std::size_t>(SlabStream::unmatched));
+            for (std::size_t c = 0; c < bottom.size(); ++c)
+            {
+                if (match[c] != SlabStream::unmatched)
+                {
+                    slabToOut[bottom[c]] = boundaryIndices[match[c]];
+                }
+            }
+            for (std::size_t i = 0; i < slabV.size(); ++i)
+            {
+                if (slabToOut[i] == SlabStream::unmatched)
+                {
+                    slabToOut[i] = vertices.size();
+                    vertices.push_back(slabV[i]);
+                }
+            }
+
+            // Replace slab vertex indices by output vertex indices. The
+            // triangles whose vertices are all on the bottom slice are
+            // candidates for duplicates of boundary triangles.
+            std::vector<Triangle> outT(slabT.size());
+            std::vector<std::size_t> candidates{};
+            for (std::size_t j = 0; j < slabT.size(); ++j)
+            {
+                Triangle const& triangle = slabT[j];
+                std::array<std::size_t, 3> v{};
+                std::uint8_t inBottom = 1;
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    v[i] = slabToOut[triangle.v[i]];
+                    inBottom &= onSlice[triangle.v[i]];
+                }
+                if (isTriangleSet)
+                {
+                    outT[j] = Triangle(v[0], v[1], v[2]);
+                }
+                else
+                {
+                    outT[j].v = v;
+                }
+                if (inBottom)
+                {
+                    candidates.push_back(j);
+                }
+            }
+
+            // Triangles are compared as ordered triples or, for triangle
+            // sets, as unordered triples.
+            auto GetKey = [isTriangleSet](Triangle const& triangle)
+            {
+                std::array<std::size_t, 3> key = triangle.v;
+                if (isTriangleSet)
+                {
+                    std::sort(key.begin(), key.end());
+                }
+                return key;
+            };
+
+            std::size_t const numBT = boundaryTriangles.size();
+            auto GetCandidate = [&](std::size_t k) -> Triangle const&
+            {
+                return (k < numBT ? boundaryTriangles[k] : outT[candidates[k - numBT]]);
+            };
+            SlabStream::Match(numBT, candidates.size(),
+                [&](std::size_t k)
+                {
+                    std::array<std::size_t, 3> const key = GetKey(GetCandidate(k));
+                    std::uint64_t hash = 0;
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        hash = HashedUnique::Combine(hash, static_cast<std::uint64_t>(key[i]));
+                    }
+                    return hash;
+                },
+                [&](std::size_t k0, std::size_t k1)
+                {
+                    return GetKey(GetCandidate(k0)) == GetKey(GetCandidate(k1));
+                },
+                match);
+
+            std::vector<std::uint8_t> isDuplicate(slabT.size(), 0);
+            for (std::size_t c = 0; c < candidates.size(); ++c)
+            {
+                if (match[c] != SlabStream::unmatched)
+                {
+                    isDuplicate[candidates[c]] = 1;
+                }
+            }
+
+            boundaryTriangles.clear();
+            for (std::size_t j = 0; j < slabT.size(); ++j)
+            {
+                if (!isDuplicate[j])
+                {
+                    triangles.push_back(outT[j]);
+                    Triangle const& triangle = slabT[j];
+                    if (onSlice[triangle.v[0]] == 2 && onSlice[triangle.v[1]] == 2 && onSlice[triangle.v[2]] == 2)
+                    {
+                        boundaryTriangles.push_back(outT[j]);
+                    }
+                }
+            }
+
+            boundaryVertices.clear();
+            boundaryIndices.clear();
+            for (std::size_t i = 0; i < slabV.size(); ++i)
+            {
+                if (onSlice[i] == 2)
+                {
+                    boundaryVertices.push_back(slabV[i]);
+                    boundaryIndices.push_back(slabToOut[i]);
+                }
+            }
+        }
+
+        // The hash of a vertex is computed from its fractions reduced to
+        // lowest terms, so equal rational vertices have equal hashes.
+        static std::uint64_t GetHash(Vertex const& vertex)
+        {
+            std::array<std::int64_t, 6> const components =
+            {
+                vertex.xNumer, vertex.xDenom,
+                vertex.yNumer, vertex.yDenom,
+                vertex.zNumer, vertex.zDenom
+            };
+
+            std::uint64_t hash = 0;
+            for (std::size_t i = 0; i < 6; i += 2)
+            {
+                std::uint64_t numer = GetAbs(components[i]);
+                std::uint64_t denom = GetAbs(components[i + 1]);
+                std::uint64_t divisor = GetGCD(numer, denom);
+                if (divisor > 1)
+                {
+                    numer /= divisor;
+                    denom /= divisor;
+                }
+                hash = HashedUnique::Combine(hash, numer);
+                hash = HashedUnique::Combine(hash, denom);
+            }
+            return hash;
+        }
+
+        static inline std::uint64_t GetAbs(std::int64_t value)
+        {
+            return (value >= 0 ? static_cast<std::uint64_t>(value) :
+                static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(value));
+        }
+
+        static std::uint64_t GetGCD(std::uint64_t u, std::uint64_t v)
+        {
+            while (v != 0)
+            {
+                std::uint64_t const r = u % v;
+                u = v;
+                v = r;
+            }
+            return u;
+        }
+
         std::size_t mXBound, mYBound, mZBound, mXYBound;
         IndexType const* mInputVoxels;
         std::vector<std::int64_t> mVoxels;
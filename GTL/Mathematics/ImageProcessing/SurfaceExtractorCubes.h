@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -94,6 +94,29 @@ namespace gtl
             }
         }
 
+        // Extract level surfaces from an image that is provided one slice at
+        // a time, so that images too large to be stored in memory can be
+        // processed. The callback
+        //   void getSlice(std::size_t z, IntType* slice)
+        // must store the xBound * yBound voxels of slice z in 'slice'. It is
+        // called on the calling thread for z = 0 through zBound-1 in
+        // increasing order, once for each slice. The slabs of slabHeight
+        // voxel layers are extracted concurrently when numThreads > 1. Read
+        // the comments in SlabStream.h. The output is the same as that of
+        // Extract for the entire image, followed by MakeUnique when
+        // removeDuplicateVertices is true. The image is not available after
+        // the extraction, so OrientTriangles cannot be used for the output.
+        template <typename GetSlice>
+        static void ExtractSlabs(std::size_t xBound, std::size_t yBound, std::size_t zBound,
+            GetSlice const& getSlice, IntType level, bool removeDuplicateVertices,
+            std::vector<Vertex>& vertices, std::vector<Triangle>& triangles,
+            std::size_t slabHeight = 4, std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            SurfaceExtractor<IntType, T>::template ExtractSlabs<SurfaceExtractorCubes>(
+                xBound, yBound, zBound, getSlice, level, removeDuplicateVertices, false,
+                vertices, triangles, slabHeight, numThreads, pool);
+        }
+
     protected:
         // Bit flags for identifying the edge and face configurations.
         // The prefixes are EI for "edge index", EB for "edge bit",
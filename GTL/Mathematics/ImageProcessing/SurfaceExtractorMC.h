@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.10
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -13,13 +13,16 @@
 
 #include <GTL/Mathematics/ImageProcessing/MarchingCubes.h>
 #include <GTL/Mathematics/ImageProcessing/Image3.h>
-#include <GTL/Mathematics/Meshes/UniqueVerticesSimplices.h>
+#include <GTL/Mathematics/ImageProcessing/SlabStream.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Utility/HashedUnique.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -122,15 +125,18 @@ namespace gtl
                 std::size_t j1 = static_cast<std::size_t>(mesh.topology.vpair[i][1]);
 
                 // The vertex can be computed with 3D-only computations as
-                //   V = (F[j0] * k1 - F[j1] * k0) / (F[j1] - F[j0])
-                // but floating-point rounding errors can cause at least one
-                // of the integer-valued components of V not to be 0 or 1 as
-                // the case may be. Such errors in turn can lead to 2 nearly
-                // identical vertices in the mesh, and MakeUnique will not be
-                // able to characterize them as the same vertex. The
-                // componentwise computations avoid these floating-point
-                // rounding errors. It is guaranteed that j0 < j1, so multiple
-                // voxels sharing the same edge will generate the same vertex.
+                //   V = (G[j0] * k1 - G[j1] * k0) / (G[j1] - G[j0])
+                // where G = localF = F - level, but floating-point rounding
+                // errors can cause at least one of the integer-valued
+                // components of V not to be 0 or 1 as the case may be. Such
+                // errors in turn can lead to 2 nearly identical vertices in
+                // the mesh, and MakeUnique will not be able to characterize
+                // them as the same vertex. The componentwise computations
+                // avoid these floating-point rounding errors. It is
+                // guaranteed that j0 < j1, so multiple voxels sharing the
+                // same edge will generate the same vertex. G[j0] and G[j1]
+                // have opposite signs, so the interpolation parameter is in
+                // [0,1] even with rounding errors.
                 auto& vertex = mesh.vertices[i];
                 std::array<std::size_t, 3> k0 = { j0 & 1, (j0 & 2) >> 1, (j0 & 4) >> 2 };
                 std::array<std::size_t, 3> k1 = { j1 & 1, (j1 & 2) >> 1, (j1 & 4) >> 2 };
@@ -144,14 +150,14 @@ namespace gtl
                         }
                         else // k1[index] = 1
                         {
-                            vertex[index] = F[j0] / (F[j0] - F[j1]);
+                            vertex[index] = localF[j0] / (localF[j0] - localF[j1]);
                         }
                     }
                     else  // k0[index] = 1
                     {
                         if (k1[index] == 0)
                         {
-                            vertex[index] = F[j1] / (F[j1] - F[j0]);
+                            vertex[index] = localF[j1] / (localF[j1] - localF[j0]);
                         }
                         else // k1[index] = 1
                         {
@@ -184,63 +190,162 @@ namespace gtl
         {
             vertices.clear();
             indices.clear();
+            ExtractVoxels(mImage, 0, level, perturb, vertices, indices);
+        }
+
+        // Extract the triangle mesh approximating F = level for a 3D image
+        // that is provided one slice at a time, so that images too large to
+        // be stored in memory can be processed. The callback
+        //   void getSlice(std::size_t z, T* slice)
+        // must store the xBound * yBound values of slice z in 'slice' using
+        // the lexicographical order of Extract. It is called on the calling
+        // thread for z = 0 through zBound-1 in increasing order, once for
+        // each slice. The slabs of slabHeight voxel layers are extracted
+        // concurrently when numThreads > 1. Read the comments in
+        // SlabStream.h. The output is the same as that of Extract for the
+        // entire image, followed by MakeUnique when removeDuplicateVertices
+        // is true. The image is not available after the extraction, so
+        // OrientTriangles cannot be used for the output.
+        template <typename GetSlice>
+        static void ExtractSlabs(std::size_t xBound, std::size_t yBound, std::size_t zBound,
+            GetSlice const& getSlice, T const& level, T const& perturb,
+            bool removeDuplicateVertices, std::vector<Vector3<T>>& vertices,
+            std::vector<IndexType>& indices, std::size_t slabHeight = 4,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                xBound > 1 && yBound > 1 && zBound > 1 && slabHeight > 0,
+                "Invalid input.");
+
+            vertices.clear();
+            indices.clear();
 
-            for (std::size_t z0 = 0, z1 = 1; z1 < mImage.size(2); z0 = z1++)
+            // The constructor of MarchingCubes creates the lookup table that
+            // is shared by all objects, so a single extractor is used by all
+            // the slabs. Its image is not accessed.
+            Image3<T> const empty{};
+            SurfaceExtractorMC const extractor(empty);
+
+            std::size_t const xyBound = xBound * yBound;
+            std::size_t const numSlots = std::max(numThreads, static_cast<std::size_t>(1));
+            std::vector<Image3<T>> slabImages(numSlots);
+            std::vector<std::size_t> numSlabSlices(numSlots, 0);
+            std::vector<std::vector<Vector3<T>>> slabVertices(numSlots);
+            std::vector<std::vector<IndexType>> slabIndices(numSlots);
+            std::vector<T> topSlice{};
+
+            // The vertices of the previous slab that are on its top slice,
+            // which is the bottom slice of the current slab.
+            std::vector<Vector3<T>> boundaryVertices{};
+            std::vector<std::size_t> boundaryIndices{};
+
+            auto Load = [&](std::size_t t, std::size_t zmin, std::size_t zmax)
             {
-                for (std::size_t y0 = 0, y1 = 1; y1 < mImage.size(1); y0 = y1++)
+                auto& image = slabImages[t];
+                if (numSlabSlices[t] != zmax - zmin + 1)
                 {
-                    for (std::size_t x0 = 0, x1 = 1; x1 < mImage.size(0); x0 = x1++)
-                    {
-                        std::array<T, 8> F =
-                        {
-                            mImage(x0, y0, z0),
-                            mImage(x1, y0, z0),
-                            mImage(x0, y1, z0),
-                            mImage(x1, y1, z0),
-                            mImage(x0, y0, z1),
-                            mImage(x1, y0, z1),
-                            mImage(x0, y1, z1),
-                            mImage(x1, y1, z1)
-                        };
+                    numSlabSlices[t] = zmax - zmin + 1;
+                    image = Image3<T>(xBound, yBound, numSlabSlices[t]);
+                }
 
-                        Mesh mesh{};
+                std::size_t z = zmin;
+                if (z > 0)
+                {
+                    std::copy(topSlice.begin(), topSlice.end(), image.data());
+                    ++z;
+                }
+                for (; z <= zmax; ++z)
+                {
+                    getSlice(z, image.data() + (z - zmin) * xyBound);
+                }
 
-                        if (Extract(level, perturb, F, mesh))
-                        {
-                            IndexType vbase = static_cast<IndexType>(vertices.size());
-                            for (std::size_t i = 0; i < mesh.topology.numVertices; ++i)
-                            {
-                                Vector3<T> position = mesh.vertices[i];
-                                position[0] += static_cast<T>(x0);
-                                position[1] += static_cast<T>(y0);
-                                position[2] += static_cast<T>(z0);
-                                vertices.push_back(position);
-                            }
+                T const* top = image.data() + (zmax - zmin) * xyBound;
+                topSlice.assign(top, top + xyBound);
+            };
 
-                            for (std::size_t i = 0; i < mesh.topology.numTriangles; ++i)
-                            {
-                                for (std::size_t j = 0; j < 3; ++j)
-                                {
-                                    indices.push_back(vbase + mesh.topology.itriple[i][j]);
-                                }
-                            }
-                        }
+            auto Process = [&](std::size_t t, std::size_t zmin, std::size_t)
+            {
+                extractor.ExtractVoxels(slabImages[t], zmin, level, perturb,
+                    slabVertices[t], slabIndices[t]);
+                if (removeDuplicateVertices)
+                {
+                    extractor.MakeUnique(slabVertices[t], slabIndices[t]);
+                }
+            };
+
+            auto Merge = [&](std::size_t t, std::size_t zmin, std::size_t zmax)
+            {
+                auto& slabV = slabVertices[t];
+                auto& slabI = slabIndices[t];
+                if (removeDuplicateVertices)
+                {
+                    MergeSlab(slabV, slabI, zmin, zmax, boundaryVertices,
+                        boundaryIndices, vertices, indices);
+                }
+                else
+                {
+                    IndexType const vbase = static_cast<IndexType>(vertices.size());
+                    vertices.insert(vertices.end(), slabV.begin(), slabV.end());
+                    for (auto const& index : slabI)
+                    {
+                        indices.push_back(vbase + index);
                     }
                 }
-            }
+                slabV.clear();
+                slabI.clear();
+            };
+
+            SlabStream::Execute(zBound, slabHeight, Load, Process, Merge, numThreads, pool);
         }
 
         // The extraction has duplicate vertices on edges shared by voxels.
-        // This function will eliminate the duplication.
+        // This function will eliminate the duplication. The unique vertices
+        // are numbered in the order of their first occurrence, which is the
+        // order produced by UniqueVerticesSimplices::RemoveDuplicateVertices.
+        // The duplicates are found by hashing. When numThreads > 1, the hash
+        // tables are partitioned among threads; the output is the same for
+        // any number of threads. Read the comments in HashedUnique.h.
         void MakeUnique(std::vector<Vector3<T>>& vertices,
-            std::vector<IndexType>& indices) const
+            std::vector<IndexType>& indices, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr) const
         {
-            std::vector<Vector3<T>> outVertices{};
-            std::vector<IndexType> outIndices{};
-            UniqueVerticesSimplices<Vector3<T>, IndexType, 3> uvt{};
-            uvt.RemoveDuplicateVertices(vertices, indices, outVertices, outIndices);
+            std::size_t const numVertices = vertices.size();
+            if (numVertices == 0)
+            {
+                return;
+            }
+
+            GTL_ARGUMENT_ASSERT(
+                indices.size() % 3 == 0,
+                "Invalid number of indices.");
+
+            std::vector<std::size_t> inToOut{}, outToIn{};
+            HashedUnique::Execute(numVertices,
+                [&vertices](std::size_t i)
+                {
+                    return GetHash(vertices[i]);
+                },
+                [&vertices](std::size_t i0, std::size_t i1)
+                {
+                    return vertices[i0] == vertices[i1];
+                },
+                inToOut, outToIn, numThreads, pool);
+
+            std::vector<Vector3<T>> outVertices(outToIn.size());
+            for (std::size_t k = 0; k < outToIn.size(); ++k)
+            {
+                outVertices[k] = vertices[outToIn[k]];
+            }
             vertices = std::move(outVertices);
-            indices = std::move(outIndices);
+
+            for (auto& index : indices)
+            {
+                std::size_t const i = static_cast<std::size_t>(index);
+                GTL_OUTOFRANGE_ASSERT(
+                    i < numVertices,
+                    "Invalid index.");
+                index = static_cast<IndexType>(inToOut[i]);
+            }
         }
 
         // The extraction does not use any topological information about the
@@ -345,6 +450,140 @@ namespace gtl
         }
 
     protected:
+        // Extract the voxels of 'image' and append the vertices and indices
+        // to the outputs. The image consists of the slices zOrigin and
+        // larger of a larger image, so zOrigin is added to the vertex
+        // z-coordinates.
+        void ExtractVoxels(Image3<T> const& image, std::size_t zOrigin,
+            T const& level, T const& perturb,
+            std::vector<Vector3<T>>& vertices, std::vector<IndexType>& indices) const
+        {
+
+            for (std::size_t z0 = 0, z1 = 1; z1 < image.size(2); z0 = z1++)
+            {
+                for (std::size_t y0 = 0, y1 = 1; y1 < image.size(1); y0 = y1++)
+                {
+                    for (std::size_t x0 = 0, x1 = 1; x1 < image.size(0); x0 = x1++)
+                    {
+                        std::array<T, 8> F =
+                        {
+                            image(x0, y0, z0),
+                            image(x1, y0, z0),
+                            image(x0, y1, z0),
+                            image(x1, y1, z0),
+                            image(x0, y0, z1),
+                            image(x1, y0, z1),
+                            image(x0, y1, z1),
+                            image(x1, y1, z1)
+                        };
+
+                        Mesh mesh{};
+
+                        if (Extract(level, perturb, F, mesh))
+                        {
+                            IndexType vbase = static_cast<IndexType>(vertices.size());
+                            for (std::size_t i = 0; i < mesh.topology.numVertices; ++i)
+                            {
+                                Vector3<T> position = mesh.vertices[i];
+                                position[0] += static_cast<T>(x0);
+                                position[1] += static_cast<T>(y0);
+                                position[2] += static_cast<T>(zOrigin + z0);
+                                vertices.push_back(position);
+                            }
+
+                            for (std::size_t i = 0; i < mesh.topology.numTriangles; ++i)
+                            {
+                                for (std::size_t j = 0; j < 3; ++j)
+                                {
+                                    indices.push_back(vbase + mesh.topology.itriple[i][j]);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Append the unique vertices of a slab to the output, matching those
+        // on the bottom slice of the slab with the boundary vertices of the
+        // previous slab. On return, the boundary vertices are those on the
+        // top slice of the slab. A vertex generated by the voxel at z has a
+        // z-coordinate in [z,z+1], even with floating-point rounding errors,
+        // so the only vertices of the slab that can be equal to vertices of
+        // the previous slab are on the bottom slice.
+        static void MergeSlab(std::vector<Vector3<T>> const& slabV,
+            std::vector<IndexType> const& slabI, std::size_t zmin, std::size_t zmax,
+            std::vector<Vector3<T>>& boundaryVertices, std::vector<std::size_t>& boundaryIndices,
+            std::vector<Vector3<T>>& vertices, std::vector<IndexType>& indices)
+        {
+            T const zLow = static_cast<T>(zmin);
+            T const zHigh = static_cast<T>(zmax);
+            std::vector<std::size_t> bottom{};
+            for (std::size_t i = 0; i < slabV.size(); ++i)
+            {
+                if (slabV[i][2] == zLow)
+                {
+                    bottom.push_back(i);
+                }
+            }
+
+            std::size_t const numBV = boundaryVertices.size();
+            std::vector<std::size_t> match{};
+            SlabStream::Match(numBV, bottom.size(),
+                [&](std::size_t k)
+                {
+                    return GetHash(k < numBV ? boundaryVertices[k] : slabV[bottom[k - numBV]]);
+                },
+                [&](std::size_t k0, std::size_t k1)
+                {
+                    Vector3<T> const& v0 = (k0 < numBV ? boundaryVertices[k0] : slabV[bottom[k0 - numBV]]);
+                    Vector3<T> const& v1 = (k1 < numBV ? boundaryVertices[k1] : slabV[bottom[k1 - numBV]]);
+                    return v0 == v1;
+                },
+                match);
+
+            std::vector<std::size_t> slabToOut(slabV.size(), static_cast<std::size_t>(SlabStream::unmatched));
+            for (std::size_t c = 0; c < bottom.size(); ++c)
+            {
+                if (match[c] != SlabStream::unmatched)
+                {
+                    slabToOut[bottom[c]] = boundaryIndices[match[c]];
+                }
+            }
+
+            boundaryVertices.clear();
+            boundaryIndices.clear();
+            for (std::size_t i = 0; i < slabV.size(); ++i)
+            {
+                if (slabToOut[i] == SlabStream::unmatched)
+                {
+                    slabToOut[i] = vertices.size();
+                    vertices.push_back(slabV[i]);
+                }
+                if (slabV[i][2] == zHigh)
+                {
+                    boundaryVertices.push_back(slabV[i]);
+                    boundaryIndices.push_back(slabToOut[i]);
+                }
+            }
+
+            for (auto const& index : slabI)
+            {
+                indices.push_back(static_cast<IndexType>(slabToOut[static_cast<std::size_t>(index)]));
+            }
+        }
+
+        static std::uint64_t GetHash(Vector3<T> const& vertex)
+        {
+            std::hash<T> hasher{};
+            std::uint64_t hash = 0;
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                hash = HashedUnique::Combine(hash, static_cast<std::uint64_t>(hasher(vertex[j])));
+            }
+            return hash;
+        }
+
         Vector3<T> GetGradient(Vector3<T> position) const
         {
             std::size_t x = 0;
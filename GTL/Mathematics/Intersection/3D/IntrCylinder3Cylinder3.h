@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.02.16
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -12,6 +12,7 @@
 // https://www.geometrictools.com/Documentation/IntersectionOfCylinders.pdf
 
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <GTL/Mathematics/Intersection/IntersectionQuery.h>
 #include <GTL/Mathematics/Arithmetic/Constants.h>
 #include <GTL/Mathematics/Primitives/ND/Cylinder.h>
@@ -21,7 +22,6 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <thread>
 #include <vector>
 
 namespace gtl
@@ -39,9 +39,15 @@ namespace gtl
         // 2 * pi * i / numTheta with 0 <= i < numTheta, phi[j] =
         // pi * j / numPhi with 0 <= j < numPhi, c0 = cos(theta[i]),
         // s0 = sin(theta[i]), c1 = cos(phi[j]), and s1 = sin(phi[j]).
-        TIQuery(std::uint32_t numThreads, std::size_t numTheta, std::size_t numPhi)
+        // When multithreaded, the phi samples are partitioned into
+        // numThreads subsets. If 'pool' is not null, the subsets are
+        // processed by the pool workers; otherwise, std::thread objects are
+        // launched for each query.
+        TIQuery(std::uint32_t numThreads, std::size_t numTheta, std::size_t numPhi,
+            ThreadPool* pool = nullptr)
             :
             mNumThreads(numThreads),
+            mPool(pool),
             mNumTheta(numTheta),
             mNumPhi(numPhi),
             mW0{},
@@ -251,55 +257,47 @@ namespace gtl
             std::vector<Output> localOutput(mNumThreads);
             std::atomic<std::uint32_t> foundSeparatingDirection(0);
 
-            std::vector<std::thread> process(mNumThreads);
-            for (size_t t = 0; t < mNumThreads; ++t)
-            {
-                process[t] = std::thread
-                (
-                    [this, phiMultiplier, thetaMultiplier, t, &jmin, &jsup, &U, &V, &N,
-                    &localOutput, &foundSeparatingDirection]()
+            ForkJoin(mPool, mNumThreads,
+                [this, phiMultiplier, thetaMultiplier, &jmin, &jsup, &U, &V, &N,
+                &localOutput, &foundSeparatingDirection](std::size_t t)
+                {
+                    if (foundSeparatingDirection)
                     {
-                        if (foundSeparatingDirection)
-                        {
-                            return;
-                        }
+                        return;
+                    }
 
-                        for (std::size_t j = jmin[t]; j < jsup[t]; ++j)
+                    for (std::size_t j = jmin[t]; j < jsup[t]; ++j)
+                    {
+                        T phi = phiMultiplier * static_cast<T>(j);
+                        T c1 = std::cos(phi);
+                        T s1 = std::sin(phi);
+                        for (std::size_t i = 0; i < mNumTheta; ++i)
                         {
-                            T phi = phiMultiplier * static_cast<T>(j);
-                            T c1 = std::cos(phi);
-                            T s1 = std::sin(phi);
-                            for (std::size_t i = 0; i < mNumTheta; ++i)
+                            // Compute the potential separating dimension.
+                            T theta = thetaMultiplier * static_cast<T>(i);
+                            T c0 = std::cos(theta);
+                            T s0 = std::sin(theta);
+                            Vector3<T> D = (c0 * s1) * U + (s0 * s1) * V + c1 * N;
+
+                            // Test for separation. If test is negative, the direction
+                            // is separating.
+                            T test =
+                                mR0 * Length(Cross(mW0, D)) + mR1 * Length(Cross(mW1, D)) +
+                                mHalfH0 * std::fabs(Dot(mW0, D)) + mHalfH1 * std::fabs(Dot(mW1, D)) -
+                                std::fabs(Dot(mDelta, D));
+                            if (test < static_cast<T>(0))
                             {
-                                // Compute the potential separating dimension.
-                                T theta = thetaMultiplier * static_cast<T>(i);
-                                T c0 = std::cos(theta);
-                                T s0 = std::sin(theta);
-                                Vector3<T> D = (c0 * s1) * U + (s0 * s1) * V + c1 * N;
-
-                                // Test for separation. If test is negative, the direction
-                                // is separating.
-                                T test =
-                                    mR0 * Length(Cross(mW0, D)) + mR1 * Length(Cross(mW1, D)) +
-                                    mHalfH0 * std::fabs(Dot(mW0, D)) + mHalfH1 * std::fabs(Dot(mW1, D)) -
-                                    std::fabs(Dot(mDelta, D));
-                                if (test < static_cast<T>(0))
-                                {
-                                    localOutput[t].separated = true;
-                                    localOutput[t].separatingDirection = D;
-                                    foundSeparatingDirection = true;
-                                    return;
-                                }
+                                localOutput[t].separated = true;
+                                localOutput[t].separatingDirection = D;
+                                foundSeparatingDirection = true;
+                                return;
                             }
                         }
                     }
-                );
-            }
+                });
 
             for (size_t t = 0; t < mNumThreads; ++t)
             {
-                process[t].join();
-
                 if (foundSeparatingDirection && localOutput[t].separated)
                 {
                     output = localOutput[t];
@@ -309,6 +307,7 @@ namespace gtl
         }
 
         std::uint32_t mNumThreads;
+        ThreadPool* mPool;
         std::size_t mNumTheta;
         std::size_t mNumPhi;
 
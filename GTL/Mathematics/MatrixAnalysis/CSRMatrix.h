@@ -0,0 +1,393 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// Representation of sparse matrices in compressed sparse row (CSR) format.
+// The nonzero entries of row r are values[k] for rowOffsets[r] <= k <
+// rowOffsets[r+1], and the column of values[k] is columns[k]. The columns of
+// each row are strictly increasing. The CSR arrays of a matrix are the
+// compressed sparse column (CSC) arrays of its transpose, so GetTranspose()
+// provides the CSC form of the matrix.
+//
+// The matrix can be constructed from the std::map<std::array<std::size_t,2>,T>
+// representation used by LinearSystem<T>::SparseMatrix. For a symmetric
+// matrix that map stores only one of the entries (i,j) and (j,i); pass
+// 'isSymmetric' as 'true' to have the constructor store both entries. The
+// full storage allows the matrix-vector product to be partitioned by rows
+// among threads without write conflicts.
+
+#include <GTL/Mathematics/Arithmetic/Constants.h>
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace gtl
+{
+    template <typename T>
+    class CSRMatrix
+    {
+    public:
+        // Construction and destruction. The default constructor creates a
+        // 0x0 matrix.
+        CSRMatrix()
+            :
+            mNumRows(0),
+            mNumCols(0),
+            mRowOffsets(1, 0),
+            mColumns{},
+            mValues{}
+        {
+        }
+
+        // Create the matrix from a map whose keys are (row,column) pairs. If
+        // 'isSymmetric' is 'true', the matrix must be square and the map
+        // stores only one of the entries (i,j) and (j,i) for i != j.
+        CSRMatrix(std::size_t numRows, std::size_t numCols,
+            std::map<std::array<std::size_t, 2>, T> const& entries,
+            bool isSymmetric = false)
+            :
+            mNumRows(numRows),
+            mNumCols(numCols),
+            mRowOffsets(numRows + 1, 0),
+            mColumns{},
+            mValues{}
+        {
+            GTL_ARGUMENT_ASSERT(
+                !isSymmetric || numRows == numCols,
+                "A symmetric matrix must be square.");
+
+            // Count the entries in each row.
+            for (auto const& element : entries)
+            {
+                std::size_t const row = element.first[0];
+                std::size_t const col = element.first[1];
+                GTL_ARGUMENT_ASSERT(
+                    row < numRows && col < numCols,
+                    "Invalid entry location.");
+
+                ++mRowOffsets[row + 1];
+                if (isSymmetric && row != col)
+                {
+                    ++mRowOffsets[col + 1];
+                }
+            }
+            for (std::size_t row = 0; row < numRows; ++row)
+            {
+                mRowOffsets[row + 1] += mRowOffsets[row];
+            }
+
+            // Scatter the entries. The map is sorted by row and then by
+            // column, so the entries (row,col) are appended to their rows in
+            // increasing column order. The mirrored entries (col,row) are
+            // appended to row 'col' in increasing order of 'row', but they
+            // are interleaved with the entries of that row, so each row is
+            // sorted afterwards when the matrix is symmetric.
+            std::size_t const numNonzeros = mRowOffsets[numRows];
+            mColumns.resize(numNonzeros);
+            mValues.resize(numNonzeros);
+            std::vector<std::size_t> next(mRowOffsets.begin(), mRowOffsets.end() - 1);
+            for (auto const& element : entries)
+            {
+                std::size_t const row = element.first[0];
+                std::size_t const col = element.first[1];
+                std::size_t k = next[row]++;
+                mColumns[k] = col;
+                mValues[k] = element.second;
+                if (isSymmetric && row != col)
+                {
+                    k = next[col]++;
+                    mColumns[k] = row;
+                    mValues[k] = element.second;
+                }
+            }
+
+            if (isSymmetric)
+            {
+                SortRows();
+            }
+        }
+
+        // Create the matrix from its CSR arrays. The columns of each row
+        // must be strictly increasing.
+        CSRMatrix(std::size_t numRows, std::size_t numCols,
+            std::vector<std::size_t> const& rowOffsets,
+            std::vector<std::size_t> const& columns,
+            std::vector<T> const& values)
+            :
+            mNumRows(numRows),
+            mNumCols(numCols),
+            mRowOffsets(rowOffsets),
+            mColumns(columns),
+            mValues(values)
+        {
+            GTL_ARGUMENT_ASSERT(
+                rowOffsets.size() == numRows + 1 &&
+                rowOffsets[0] == 0 &&
+                rowOffsets[numRows] == columns.size() &&
+                columns.size() == values.size(),
+                "Inconsistent CSR arrays.");
+
+            for (std::size_t row = 0; row < numRows; ++row)
+            {
+                std::size_t const kmin = rowOffsets[row];
+                std::size_t const kmax = rowOffsets[row + 1];
+                GTL_ARGUMENT_ASSERT(
+                    kmin <= kmax,
+                    "Row offsets must be nondecreasing.");
+
+                for (std::size_t k = kmin; k < kmax; ++k)
+                {
+                    GTL_ARGUMENT_ASSERT(
+                        columns[k] < numCols && (k == kmin || columns[k - 1] < columns[k]),
+                        "Columns must be valid and strictly increasing in each row.");
+                }
+            }
+        }
+
+        ~CSRMatrix() = default;
+
+        // Member access.
+        inline std::size_t GetNumRows() const
+        {
+            return mNumRows;
+        }
+
+        inline std::size_t GetNumCols() const
+        {
+            return mNumCols;
+        }
+
+        inline std::size_t GetNumNonzeros() const
+        {
+            return mValues.size();
+        }
+
+        inline std::vector<std::size_t> const& GetRowOffsets() const
+        {
+            return mRowOffsets;
+        }
+
+        inline std::vector<std::size_t> const& GetColumns() const
+        {
+            return mColumns;
+        }
+
+        inline std::vector<T> const& GetValues() const
+        {
+            return mValues;
+        }
+
+        // The values may be modified, but the sparsity pattern is fixed.
+        inline std::vector<T>& GetValues()
+        {
+            return mValues;
+        }
+
+        // Return the index into the values array of the entry (row,col). If
+        // the entry is not stored, the function returns 'invalid'.
+        std::size_t GetIndex(std::size_t row, std::size_t col) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                row < mNumRows && col < mNumCols,
+                "Invalid entry location.");
+
+            auto first = mColumns.begin() + mRowOffsets[row];
+            auto last = mColumns.begin() + mRowOffsets[row + 1];
+            auto iter = std::lower_bound(first, last, col);
+            if (iter != last && *iter == col)
+            {
+                return static_cast<std::size_t>(iter - mColumns.begin());
+            }
+            return invalid;
+        }
+
+        // Return the value of entry (row,col), which is 0 if the entry is
+        // not stored.
+        T operator()(std::size_t row, std::size_t col) const
+        {
+            std::size_t const k = GetIndex(row, col);
+            return (k != invalid ? mValues[k] : C_<T>(0));
+        }
+
+        // Get the diagonal entries of a square matrix.
+        void GetDiagonal(std::vector<T>& diagonal) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                mNumRows == mNumCols,
+                "The matrix must be square.");
+
+            diagonal.resize(mNumRows);
+            for (std::size_t row = 0; row < mNumRows; ++row)
+            {
+                diagonal[row] = operator()(row, row);
+            }
+        }
+
+        // Compute the transpose, which is also the CSC representation of
+        // the matrix.
+        CSRMatrix GetTranspose() const
+        {
+            CSRMatrix transpose{};
+            transpose.mNumRows = mNumCols;
+            transpose.mNumCols = mNumRows;
+            transpose.mRowOffsets.assign(mNumCols + 1, 0);
+            transpose.mColumns.resize(mColumns.size());
+            transpose.mValues.resize(mValues.size());
+
+            for (auto const& col : mColumns)
+            {
+                ++transpose.mRowOffsets[col + 1];
+            }
+            for (std::size_t col = 0; col < mNumCols; ++col)
+            {
+                transpose.mRowOffsets[col + 1] += transpose.mRowOffsets[col];
+            }
+
+            // Visiting the rows in increasing order appends the entries of
+            // each transposed row in increasing column order.
+            std::vector<std::size_t> next(transpose.mRowOffsets.begin(),
+                transpose.mRowOffsets.end() - 1);
+            for (std::size_t row = 0; row < mNumRows; ++row)
+            {
+                for (std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; ++k)
+                {
+                    std::size_t const j = next[mColumns[k]]++;
+                    transpose.mColumns[j] = row;
+                    transpose.mValues[j] = mValues[k];
+                }
+            }
+            return transpose;
+        }
+
+        // Compute Y = A*X, where X has GetNumCols() elements and Y has
+        // GetNumRows() elements.
+        void Mul(T const* X, T* Y) const
+        {
+            MulRows(0, mNumRows, X, Y);
+        }
+
+        // Compute Y = A*X using multiple threads. The rows are partitioned
+        // into numThreads contiguous subsets that have approximately the same
+        // number of nonzero entries. Each element of Y is computed by exactly
+        // one thread in the same order as the single-threaded Mul, so the
+        // result is independent of the number of threads. If 'pool' is not
+        // null, the subsets are processed by the pool; otherwise, a
+        // std::thread is launched for each subset.
+        void Mul(T const* X, T* Y, std::size_t numThreads, ThreadPool* pool = nullptr) const
+        {
+            if (numThreads <= 1 || mNumRows < numThreads)
+            {
+                MulRows(0, mNumRows, X, Y);
+                return;
+            }
+
+            std::vector<std::size_t> rowPartition{};
+            GetRowPartition(numThreads, rowPartition);
+            ForkJoin(pool, numThreads,
+                [this, &rowPartition, X, Y](std::size_t t)
+                {
+                    MulRows(rowPartition[t], rowPartition[t + 1], X, Y);
+                });
+        }
+
+        // Compute Y = A^T*X, where X has GetNumRows() elements and Y has
+        // GetNumCols() elements. The entries are scattered into Y, so this
+        // function is single-threaded. For repeated products with A^T, use
+        // the multithreaded Mul of GetTranspose().
+        void MulTranspose(T const* X, T* Y) const
+        {
+            std::fill(Y, Y + mNumCols, C_<T>(0));
+            for (std::size_t row = 0; row < mNumRows; ++row)
+            {
+                T const& xValue = X[row];
+                for (std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; ++k)
+                {
+                    Y[mColumns[k]] += mValues[k] * xValue;
+                }
+            }
+        }
+
+        // Partition the rows into numSubsets contiguous subsets with
+        // approximately equal numbers of nonzero entries. The subset s
+        // contains the rows r with rowPartition[s] <= r < rowPartition[s+1].
+        void GetRowPartition(std::size_t numSubsets, std::vector<std::size_t>& rowPartition) const
+        {
+            GTL_ARGUMENT_ASSERT(
+                numSubsets > 0,
+                "The number of subsets must be positive.");
+
+            rowPartition.resize(numSubsets + 1);
+            rowPartition[0] = 0;
+            std::size_t const numNonzeros = mValues.size();
+            for (std::size_t s = 1; s < numSubsets; ++s)
+            {
+                std::size_t const target = (s * numNonzeros) / numSubsets;
+                auto iter = std::lower_bound(mRowOffsets.begin(), mRowOffsets.end(), target);
+                std::size_t row = static_cast<std::size_t>(iter - mRowOffsets.begin());
+                rowPartition[s] = std::max(std::min(row, mNumRows), rowPartition[s - 1]);
+            }
+            rowPartition[numSubsets] = mNumRows;
+        }
+
+        static std::size_t constexpr invalid = std::numeric_limits<std::size_t>::max();
+
+    private:
+        void MulRows(std::size_t rmin, std::size_t rsup, T const* X, T* Y) const
+        {
+            for (std::size_t row = rmin; row < rsup; ++row)
+            {
+                T sum = C_<T>(0);
+                for (std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; ++k)
+                {
+                    sum += mValues[k] * X[mColumns[k]];
+                }
+                Y[row] = sum;
+            }
+        }
+
+        // Sort the (column,value) pairs of each row by column.
+        void SortRows()
+        {
+            std::vector<std::pair<std::size_t, T>> rowEntries{};
+            for (std::size_t row = 0; row < mNumRows; ++row)
+            {
+                std::size_t const kmin = mRowOffsets[row];
+                std::size_t const kmax = mRowOffsets[row + 1];
+                rowEntries.resize(kmax - kmin);
+                for (std::size_t k = kmin; k < kmax; ++k)
+                {
+                    rowEntries[k - kmin] = std::make_pair(mColumns[k], mValues[k]);
+                }
+                std::sort(rowEntries.begin(), rowEntries.end(),
+                    [](std::pair<std::size_t, T> const& e0, std::pair<std::size_t, T> const& e1)
+                    {
+                        return e0.first < e1.first;
+                    });
+                for (std::size_t k = kmin; k < kmax; ++k)
+                {
+                    mColumns[k] = rowEntries[k - kmin].first;
+                    mValues[k] = rowEntries[k - kmin].second;
+                }
+            }
+        }
+
+        std::size_t mNumRows, mNumCols;
+        std::vector<std::size_t> mRowOffsets;
+        std::vector<std::size_t> mColumns;
+        std::vector<T> mValues;
+
+    private:
+        friend class UnitTestCSRMatrix;
+    };
+}
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.12
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -15,10 +15,16 @@
 // The linear solvers that use the conjugate gradient algorithm are based
 // on the discussion in "Matrix Computations, 2nd edition" by G. H. Golub
 // and Charles F. Van Loan, The Johns Hopkins Press, Baltimore MD, Fourth
-// Printing 1993.
+// Printing 1993. SolveSymmetricPCG uses the CSRMatrix representation of a
+// sparse matrix, which is much faster for matrix-vector products than the
+// std::map representation SparseMatrix. Use the CSRMatrix constructor to
+// convert a SparseMatrix.
 
 #include <GTL/Mathematics/Algebra/Matrix.h>
+#include <GTL/Mathematics/MatrixAnalysis/CSRMatrix.h>
 #include <GTL/Mathematics/MatrixAnalysis/GaussianElimination.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -82,6 +88,39 @@ namespace gtl
             return invertible;
         }
 
+        // The number of systems that SolveBatch processes in lockstep.
+        static std::size_t constexpr batchLanes = 8;
+
+        // Solve numSystems 3x3 or 4x4 systems A*X = B that are stored as
+        // structure of arrays. For NxN systems, A[N*r+c] points to the
+        // numSystems values of entry (r,c), B[r] points to the values of
+        // component r of the right-hand sides and X[r] receives the values
+        // of component r of the solutions. The systems are processed in
+        // groups of batchLanes in lockstep using branchless code that the
+        // compiler can vectorize. The arithmetic operations are those of
+        // the single-system Solve functions, so the solutions are the same
+        // unless the compiler contracts multiplications and additions into
+        // fused multiply-add instructions.
+        // If 'invertible' is not null, invertible[i] is set to 'true' when
+        // system i has a unique solution. Otherwise, its solution is zero.
+        // The groups are partitioned among numThreads threads, which are
+        // executed by 'pool' when it is not null.
+        static void SolveBatch(std::size_t numSystems, std::array<T const*, 9> const& A,
+            std::array<T const*, 3> const& B, std::array<T*, 3> const& X,
+            bool* invertible = nullptr, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            SolveBatch<3>(numSystems, A, B, X, invertible, numThreads, pool, SolveLanes3);
+        }
+
+        static void SolveBatch(std::size_t numSystems, std::array<T const*, 16> const& A,
+            std::array<T const*, 4> const& B, std::array<T*, 4> const& X,
+            bool* invertible = nullptr, std::size_t numThreads = 1,
+            ThreadPool* pool = nullptr)
+        {
+            SolveBatch<4>(numSystems, A, B, X, invertible, numThreads, pool, SolveLanes4);
+        }
+
         template <std::size_t N>
         static bool Solve(Matrix<T, N, N> const& A, Vector<T, N> const& B, Vector<T, N>& X)
         {
@@ -272,7 +311,317 @@ namespace gtl
             return iteration;
         }
 
+        // Preconditioners for SolveSymmetricPCG.
+        enum class Preconditioner
+        {
+            // M = I, which is the conjugate gradient method.
+            NONE,
+
+            // M = D, where D is the diagonal of A. If an entry of D is not
+            // positive, A is not positive definite and M = I is used, as
+            // for SolveSymmetricCG.
+            JACOBI,
+
+            // M = L*L^T, where L is the zero-fill incomplete Cholesky factor
+            // of A, denoted IC(0). L has the sparsity pattern of the lower
+            // triangle of A. If a pivot is not positive, the factorization
+            // is restarted for A + shift*D with increasing shifts.
+            INCOMPLETE_CHOLESKY
+        };
+
+        // Solve A*X = B using the preconditioned conjugate gradient method
+        // (Golub and Van Loan, Algorithm 10.3.1), where A is symmetric and
+        // positive definite. Both triangles of A must be stored, which is
+        // the case when A is created from a SparseMatrix using the CSRMatrix
+        // constructor with 'isSymmetric' set to 'true'. The iterations
+        // terminate when the residual satisfies |B - A*X| <= tolerance*|B|.
+        // The return value is the number of iterations, which is larger than
+        // maxIterations when the method did not converge. The matrix-vector
+        // products are partitioned among numThreads threads, which are
+        // executed by 'pool' when it is not null. The result does not depend
+        // on the number of threads.
+        static std::size_t SolveSymmetricPCG(CSRMatrix<T> const& A, T const* B, T* X,
+            Preconditioner preconditioner, std::size_t maxIterations, T const& tolerance,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                A.GetNumRows() == A.GetNumCols(),
+                "The matrix must be square.");
+
+            std::size_t const N = A.GetNumRows();
+            std::fill(X, X + N, C_<T>(0));
+            T const norm = std::sqrt(Dot(N, B, B));
+            if (norm == C_<T>(0))
+            {
+                return 0;
+            }
+            T const cutoff = tolerance * norm;
+
+            // Create the preconditioner.
+            std::vector<T> inverseDiagonal{};
+            CSRMatrix<T> L{};
+            if (preconditioner == Preconditioner::JACOBI)
+            {
+                A.GetDiagonal(inverseDiagonal);
+                for (auto& value : inverseDiagonal)
+                {
+                    if (!(value > C_<T>(0)))
+                    {
+                        // The method typically does not converge, which is
+                        // reported by the return value.
+                        inverseDiagonal.clear();
+                        preconditioner = Preconditioner::NONE;
+                        break;
+                    }
+                    value = C_<T>(1) / value;
+                }
+            }
+            else if (preconditioner == Preconditioner::INCOMPLETE_CHOLESKY)
+            {
+                L = FactorIncompleteCholesky(A);
+            }
+
+            // The first iteration.
+            std::vector<T> R(B, B + N), Z(N), W(N);
+            Precondition(N, preconditioner, inverseDiagonal, L, R.data(), Z.data());
+            std::vector<T> P = Z;
+            T rho0 = Dot(N, R.data(), Z.data());
+
+            std::size_t iteration{};
+            for (iteration = 1; iteration <= maxIterations; ++iteration)
+            {
+                A.Mul(P.data(), W.data(), numThreads, pool);
+                T alpha = rho0 / Dot(N, P.data(), W.data());
+                UpdateX(N, X, alpha, P.data());
+                UpdateR(N, R.data(), alpha, W.data());
+                if (std::sqrt(Dot(N, R.data(), R.data())) <= cutoff)
+                {
+                    break;
+                }
+
+                Precondition(N, preconditioner, inverseDiagonal, L, R.data(), Z.data());
+                T rho1 = Dot(N, R.data(), Z.data());
+                T beta = rho1 / rho0;
+                UpdateP(N, P.data(), beta, Z.data());
+                rho0 = rho1;
+            }
+            return iteration;
+        }
+
     private:
+        // Support for the batched solvers. Each array stores one value per
+        // lane. A lane solver loads a group of systems into local arrays,
+        // which allows the compiler to vectorize its loop without aliasing
+        // tests, and stores the solutions.
+        using Lanes = std::array<T, batchLanes>;
+
+        template <std::size_t N, typename LaneSolver>
+        static void SolveBatch(std::size_t numSystems, std::array<T const*, N * N> const& A,
+            std::array<T const*, N> const& B, std::array<T*, N> const& X,
+            bool* invertible, std::size_t numThreads, ThreadPool* pool,
+            LaneSolver const& laneSolver)
+        {
+            auto solveGroups = [numSystems, &A, &B, &X, invertible, &laneSolver]
+                (std::size_t gmin, std::size_t gsup)
+            {
+                for (std::size_t g = gmin; g < gsup; ++g)
+                {
+                    std::size_t const base = g * batchLanes;
+                    std::size_t const count = std::min(numSystems - base, static_cast<std::size_t>(batchLanes));
+                    laneSolver(A, B, X, invertible, base, count);
+                }
+            };
+
+            std::size_t const numGroups = (numSystems + batchLanes - 1) / batchLanes;
+            if (numThreads <= 1 || numGroups < numThreads)
+            {
+                solveGroups(0, numGroups);
+                return;
+            }
+
+            ForkJoin(pool, numThreads,
+                [&solveGroups, numGroups, numThreads](std::size_t t)
+                {
+                    solveGroups((t * numGroups) / numThreads,
+                        ((t + 1) * numGroups) / numThreads);
+                });
+        }
+
+        // Load the values of 'count' systems starting at 'base'. The lanes
+        // after the last system are padded with the first system.
+        template <std::size_t M>
+        static void LoadLanes(std::array<T const*, M> const& input, std::size_t base,
+            std::size_t count, std::array<Lanes, M>& lanes)
+        {
+            for (std::size_t i = 0; i < M; ++i)
+            {
+                for (std::size_t j = 0; j < batchLanes; ++j)
+                {
+                    lanes[i][j] = input[i][base + (j < count ? j : 0)];
+                }
+            }
+        }
+
+        template <std::size_t N>
+        static void StoreLanes(std::array<Lanes, N> const& x, Lanes const& determinant,
+            std::size_t base, std::size_t count, std::array<T*, N> const& X,
+            bool* invertible)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::copy(x[i].begin(), x[i].begin() + count, X[i] + base);
+            }
+            if (invertible)
+            {
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    invertible[base + j] = (determinant[j] != C_<T>(0));
+                }
+            }
+        }
+
+        // The lockstep versions of GetInverse followed by the matrix-vector
+        // product. A zero determinant is replaced by 1 for the divisions,
+        // and the solution of such a lane is replaced by 0. The selections
+        // are made in a separate loop. Otherwise, the compiler can move the
+        // divisions into branches, which prevents vectorization when
+        // floating-point operations may trap.
+        static void SolveLanes3(std::array<T const*, 9> const& A,
+            std::array<T const*, 3> const& B, std::array<T*, 3> const& X,
+            bool* invertible, std::size_t base, std::size_t count)
+        {
+            std::array<Lanes, 9> a{};
+            std::array<Lanes, 3> b{}, x{};
+            Lanes determinant{}, divisor{}, mask{};
+            LoadLanes(A, base, count, a);
+            LoadLanes(B, base, count, b);
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T c00 = a[4][j] * a[8][j] - a[5][j] * a[7][j];
+                T c10 = a[5][j] * a[6][j] - a[3][j] * a[8][j];
+                T c20 = a[3][j] * a[7][j] - a[4][j] * a[6][j];
+                T det = a[0][j] * c00 + a[1][j] * c10 + a[2][j] * c20;
+                bool const nonzero = (det != C_<T>(0));
+                determinant[j] = det;
+                divisor[j] = (nonzero ? det : C_<T>(1));
+                mask[j] = (nonzero ? C_<T>(1) : C_<T>(0));
+            }
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T m00 = a[0][j], m01 = a[1][j], m02 = a[2][j];
+                T m10 = a[3][j], m11 = a[4][j], m12 = a[5][j];
+                T m20 = a[6][j], m21 = a[7][j], m22 = a[8][j];
+                T c00 = m11 * m22 - m12 * m21;
+                T c10 = m12 * m20 - m10 * m22;
+                T c20 = m10 * m21 - m11 * m20;
+                T d = divisor[j];
+
+                T i00 = c00 / d;
+                T i01 = (m02 * m21 - m01 * m22) / d;
+                T i02 = (m01 * m12 - m02 * m11) / d;
+                T i10 = c10 / d;
+                T i11 = (m00 * m22 - m02 * m20) / d;
+                T i12 = (m02 * m10 - m00 * m12) / d;
+                T i20 = c20 / d;
+                T i21 = (m01 * m20 - m00 * m21) / d;
+                T i22 = (m00 * m11 - m01 * m10) / d;
+
+                T b0 = b[0][j], b1 = b[1][j], b2 = b[2][j];
+                T x0 = i00 * b0 + i01 * b1 + i02 * b2;
+                T x1 = i10 * b0 + i11 * b1 + i12 * b2;
+                T x2 = i20 * b0 + i21 * b1 + i22 * b2;
+                x[0][j] = (mask[j] != C_<T>(0) ? x0 : C_<T>(0));
+                x[1][j] = (mask[j] != C_<T>(0) ? x1 : C_<T>(0));
+                x[2][j] = (mask[j] != C_<T>(0) ? x2 : C_<T>(0));
+            }
+
+            StoreLanes(x, determinant, base, count, X, invertible);
+        }
+
+        static void SolveLanes4(std::array<T const*, 16> const& A,
+            std::array<T const*, 4> const& B, std::array<T*, 4> const& X,
+            bool* invertible, std::size_t base, std::size_t count)
+        {
+            std::array<Lanes, 16> a{};
+            std::array<Lanes, 4> b{}, x{};
+            Lanes determinant{}, divisor{}, mask{};
+            LoadLanes(A, base, count, a);
+            LoadLanes(B, base, count, b);
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T a0 = a[0][j] * a[5][j] - a[1][j] * a[4][j];
+                T a1 = a[0][j] * a[6][j] - a[2][j] * a[4][j];
+                T a2 = a[0][j] * a[7][j] - a[3][j] * a[4][j];
+                T a3 = a[1][j] * a[6][j] - a[2][j] * a[5][j];
+                T a4 = a[1][j] * a[7][j] - a[3][j] * a[5][j];
+                T a5 = a[2][j] * a[7][j] - a[3][j] * a[6][j];
+                T b0 = a[8][j] * a[13][j] - a[9][j] * a[12][j];
+                T b1 = a[8][j] * a[14][j] - a[10][j] * a[12][j];
+                T b2 = a[8][j] * a[15][j] - a[11][j] * a[12][j];
+                T b3 = a[9][j] * a[14][j] - a[10][j] * a[13][j];
+                T b4 = a[9][j] * a[15][j] - a[11][j] * a[13][j];
+                T b5 = a[10][j] * a[15][j] - a[11][j] * a[14][j];
+                T det = a0 * b5 - a1 * b4 + a2 * b3 + a3 * b2 - a4 * b1 + a5 * b0;
+                bool const nonzero = (det != C_<T>(0));
+                determinant[j] = det;
+                divisor[j] = (nonzero ? det : C_<T>(1));
+                mask[j] = (nonzero ? C_<T>(1) : C_<T>(0));
+            }
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T m00 = a[0][j], m01 = a[1][j], m02 = a[2][j], m03 = a[3][j];
+                T m10 = a[4][j], m11 = a[5][j], m12 = a[6][j], m13 = a[7][j];
+                T m20 = a[8][j], m21 = a[9][j], m22 = a[10][j], m23 = a[11][j];
+                T m30 = a[12][j], m31 = a[13][j], m32 = a[14][j], m33 = a[15][j];
+                T a0 = m00 * m11 - m01 * m10;
+                T a1 = m00 * m12 - m02 * m10;
+                T a2 = m00 * m13 - m03 * m10;
+                T a3 = m01 * m12 - m02 * m11;
+                T a4 = m01 * m13 - m03 * m11;
+                T a5 = m02 * m13 - m03 * m12;
+                T b0 = m20 * m31 - m21 * m30;
+                T b1 = m20 * m32 - m22 * m30;
+                T b2 = m20 * m33 - m23 * m30;
+                T b3 = m21 * m32 - m22 * m31;
+                T b4 = m21 * m33 - m23 * m31;
+                T b5 = m22 * m33 - m23 * m32;
+                T d = divisor[j];
+
+                T i00 = (+m11 * b5 - m12 * b4 + m13 * b3) / d;
+                T i01 = (-m01 * b5 + m02 * b4 - m03 * b3) / d;
+                T i02 = (+m31 * a5 - m32 * a4 + m33 * a3) / d;
+                T i03 = (-m21 * a5 + m22 * a4 - m23 * a3) / d;
+                T i10 = (-m10 * b5 + m12 * b2 - m13 * b1) / d;
+                T i11 = (+m00 * b5 - m02 * b2 + m03 * b1) / d;
+                T i12 = (-m30 * a5 + m32 * a2 - m33 * a1) / d;
+                T i13 = (+m20 * a5 - m22 * a2 + m23 * a1) / d;
+                T i20 = (+m10 * b4 - m11 * b2 + m13 * b0) / d;
+                T i21 = (-m00 * b4 + m01 * b2 - m03 * b0) / d;
+                T i22 = (+m30 * a4 - m31 * a2 + m33 * a0) / d;
+                T i23 = (-m20 * a4 + m21 * a2 - m23 * a0) / d;
+                T i30 = (-m10 * b3 + m11 * b1 - m12 * b0) / d;
+                T i31 = (+m00 * b3 - m01 * b1 + m02 * b0) / d;
+                T i32 = (-m30 * a3 + m31 * a1 - m32 * a0) / d;
+                T i33 = (+m20 * a3 - m21 * a1 + m22 * a0) / d;
+
+                T v0 = b[0][j], v1 = b[1][j], v2 = b[2][j], v3 = b[3][j];
+                T x0 = i00 * v0 + i01 * v1 + i02 * v2 + i03 * v3;
+                T x1 = i10 * v0 + i11 * v1 + i12 * v2 + i13 * v3;
+                T x2 = i20 * v0 + i21 * v1 + i22 * v2 + i23 * v3;
+                T x3 = i30 * v0 + i31 * v1 + i32 * v2 + i33 * v3;
+                x[0][j] = (mask[j] != C_<T>(0) ? x0 : C_<T>(0));
+                x[1][j] = (mask[j] != C_<T>(0) ? x1 : C_<T>(0));
+                x[2][j] = (mask[j] != C_<T>(0) ? x2 : C_<T>(0));
+                x[3][j] = (mask[j] != C_<T>(0) ? x3 : C_<T>(0));
+            }
+
+            StoreLanes(x, determinant, base, count, X, invertible);
+        }
+
         // Support for the conjugate gradient method.
         static T Dot(std::size_t N, T const* U, T const* V)
         {
@@ -345,6 +694,156 @@ namespace gtl
             }
         }
 
+        // Support for the preconditioned conjugate gradient method. Solve
+        // M*Z = R for the preconditioner M.
+        static void Precondition(std::size_t N, Preconditioner preconditioner,
+            std::vector<T> const& inverseDiagonal, CSRMatrix<T> const& L,
+            T const* R, T* Z)
+        {
+            if (preconditioner == Preconditioner::JACOBI)
+            {
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    Z[i] = inverseDiagonal[i] * R[i];
+                }
+            }
+            else if (preconditioner == Preconditioner::INCOMPLETE_CHOLESKY)
+            {
+                // The last entry of each row of L is the diagonal entry.
+                auto const& offsets = L.GetRowOffsets();
+                auto const& columns = L.GetColumns();
+                auto const& values = L.GetValues();
+
+                // Solve L*Y = R, storing Y in Z.
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    std::size_t const kdiag = offsets[i + 1] - 1;
+                    T sum = R[i];
+                    for (std::size_t k = offsets[i]; k < kdiag; ++k)
+                    {
+                        sum -= values[k] * Z[columns[k]];
+                    }
+                    Z[i] = sum / values[kdiag];
+                }
+
+                // Solve L^T*Z = Y. The rows of L are the columns of L^T.
+                for (std::size_t j = 0, i = N - 1; j < N; ++j, --i)
+                {
+                    std::size_t const kdiag = offsets[i + 1] - 1;
+                    Z[i] /= values[kdiag];
+                    T const& zValue = Z[i];
+                    for (std::size_t k = offsets[i]; k < kdiag; ++k)
+                    {
+                        Z[columns[k]] -= values[k] * zValue;
+                    }
+                }
+            }
+            else
+            {
+                std::copy(R, R + N, Z);
+            }
+        }
+
+        // Compute the IC(0) factor L of A. The entries of L are computed row
+        // by row. For an off-diagonal entry (i,j) in the pattern,
+        //   L(i,j) = (A(i,j) - sum_{k<j} L(i,k)*L(j,k)) / L(j,j)
+        // and L(i,i) = sqrt(A(i,i) - sum_{k<i} L(i,k)^2). The sums are
+        // computed by merging the sorted rows i and j of L. If a pivot is
+        // not positive, the factorization is restarted with the diagonal of
+        // A scaled by 1 + shift, where the shift starts at 1/1024 and is
+        // doubled on each failure.
+        static CSRMatrix<T> FactorIncompleteCholesky(CSRMatrix<T> const& A)
+        {
+            std::size_t const N = A.GetNumRows();
+            auto const& aOffsets = A.GetRowOffsets();
+            auto const& aColumns = A.GetColumns();
+            auto const& aValues = A.GetValues();
+
+            // Extract the lower-triangular pattern. The diagonal entry must
+            // be present and positive.
+            std::vector<std::size_t> offsets(N + 1, 0), columns{};
+            std::vector<T> lower{};
+            columns.reserve((A.GetNumNonzeros() + N) / 2);
+            lower.reserve((A.GetNumNonzeros() + N) / 2);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::size_t k = aOffsets[i];
+                for (; k < aOffsets[i + 1] && aColumns[k] <= i; ++k)
+                {
+                    columns.push_back(aColumns[k]);
+                    lower.push_back(aValues[k]);
+                }
+                GTL_RUNTIME_ASSERT(
+                    columns.size() > 0 && columns.back() == i && lower.back() > C_<T>(0),
+                    "The diagonal entries must be positive.");
+                offsets[i + 1] = columns.size();
+            }
+
+            std::vector<T> values(lower.size());
+            std::size_t constexpr maxAttempts = 32;
+            T shift = C_<T>(0);
+            for (std::size_t attempt = 0; attempt < maxAttempts; ++attempt)
+            {
+                if (FactorIncompleteCholesky(offsets, columns, lower, shift, values))
+                {
+                    return CSRMatrix<T>(N, N, offsets, columns, values);
+                }
+                shift = (shift == C_<T>(0) ? C_<T>(1, 1024) : C_<T>(2) * shift);
+            }
+
+            GTL_RUNTIME_ERROR(
+                "The incomplete Cholesky factorization failed.");
+        }
+
+        static bool FactorIncompleteCholesky(std::vector<std::size_t> const& offsets,
+            std::vector<std::size_t> const& columns, std::vector<T> const& lower,
+            T const& shift, std::vector<T>& values)
+        {
+            std::size_t const N = offsets.size() - 1;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::size_t const imin = offsets[i];
+                std::size_t const idiag = offsets[i + 1] - 1;
+                for (std::size_t p = imin; p < idiag; ++p)
+                {
+                    // Merge L(i,k) for imin <= k < p with L(j,k) for k < j.
+                    std::size_t const j = columns[p];
+                    std::size_t const jdiag = offsets[j + 1] - 1;
+                    T sum = lower[p];
+                    for (std::size_t q0 = imin, q1 = offsets[j]; q0 < p && q1 < jdiag; )
+                    {
+                        if (columns[q0] < columns[q1])
+                        {
+                            ++q0;
+                        }
+                        else if (columns[q1] < columns[q0])
+                        {
+                            ++q1;
+                        }
+                        else
+                        {
+                            sum -= values[q0] * values[q1];
+                            ++q0;
+                            ++q1;
+                        }
+                    }
+                    values[p] = sum / values[jdiag];
+                }
+
+                T pivot = lower[idiag] * (C_<T>(1) + shift);
+                for (std::size_t p = imin; p < idiag; ++p)
+                {
+                    pivot -= values[p] * values[p];
+                }
+                if (!(pivot > C_<T>(0)))
+                {
+                    return false;
+                }
+                values[idiag] = std::sqrt(pivot);
+            }
+            return true;
+        }
+
     private:
         friend class UnitTestLinearSystem;
     };
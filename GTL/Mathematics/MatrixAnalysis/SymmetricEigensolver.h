@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.12
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -46,6 +46,7 @@
 
 #include <GTL/Mathematics/Arithmetic/Constants.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -244,6 +245,47 @@ namespace gtl
             return mEigenvectors;
         }
 
+        // Solve numMatrices eigensystems using the noniterative algorithm.
+        // The matrices are stored as structure of arrays: A[0] through A[5]
+        // point to the numMatrices values of a00, a01, a02, a11, a12 and
+        // a22, respectively. The outputs are also structure of arrays:
+        // eigenvalues[i][m] is eigenvalue i of matrix m and
+        // eigenvectors[i][k][m] is component k of eigenvector i of matrix m.
+        // The matrices are processed in groups of batchLanes in lockstep
+        // using branchless code that the compiler can vectorize. The
+        // transcendental functions are evaluated one lane at a time. With
+        // GCC, the loops that call std::sqrt are vectorized only when
+        // -fno-math-errno is specified. A lane whose matrix is zero or
+        // diagonal or whose eigenvalues are not strictly separated at the
+        // smallest one is solved by the scalar operator() instead. The
+        // results are the same as those of operator() with 'noniterative'
+        // set to 'true' unless the compiler contracts multiplications and
+        // additions into fused multiply-add instructions. The groups are
+        // partitioned among numThreads threads, which are executed by 'pool'
+        // when it is not null.
+        static std::size_t constexpr batchLanes = 8;
+
+        static void SolveBatch(std::size_t numMatrices, std::array<T const*, 6> const& A,
+            std::array<T*, 3> const& eigenvalues,
+            std::array<std::array<T*, 3>, 3> const& eigenvectors,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            std::size_t const numGroups = (numMatrices + batchLanes - 1) / batchLanes;
+            if (numThreads <= 1 || numGroups < numThreads)
+            {
+                SolveGroups(0, numGroups, numMatrices, A, eigenvalues, eigenvectors);
+                return;
+            }
+
+            ForkJoin(pool, numThreads,
+                [numGroups, numThreads, numMatrices, &A, &eigenvalues, &eigenvectors](std::size_t t)
+                {
+                    std::size_t const gmin = (t * numGroups) / numThreads;
+                    std::size_t const gsup = ((t + 1) * numGroups) / numThreads;
+                    SolveGroups(gmin, gsup, numMatrices, A, eigenvalues, eigenvectors);
+                });
+        }
+
     private:
         // Sorting code is shared by the iterative/noniterative algorithms.
         // Sort the eigenvalues to eval[0] <= eval[1] <= eval[2].
@@ -922,6 +964,283 @@ namespace gtl
             }
         }
 
+        // Support for SolveBatch. Each array stores one value per lane.
+        using Lanes = std::array<T, batchLanes>;
+
+        static void SolveGroups(std::size_t gmin, std::size_t gsup, std::size_t numMatrices,
+            std::array<T const*, 6> const& A, std::array<T*, 3> const& eigenvalues,
+            std::array<std::array<T*, 3>, 3> const& eigenvectors)
+        {
+            SymmetricEigensolver<T, 3> solver{};
+            for (std::size_t g = gmin; g < gsup; ++g)
+            {
+                std::size_t const base = g * batchLanes;
+                std::size_t const count = std::min(numMatrices - base, static_cast<std::size_t>(batchLanes));
+                SolveLanes(A, eigenvalues, eigenvectors, base, count, solver);
+            }
+        }
+
+        // The lockstep version of SolveNoniterative for the group of 'count'
+        // matrices starting at 'base'. The lanes after the last matrix are
+        // padded with the first matrix. The branches of the scalar code are
+        // replaced by selections, and the arithmetic operations are the
+        // same. The eigenvalues are not sorted, so the scalar code is used
+        // for lanes that have maxAbsElement = 0 or norm = 0 or for which
+        // the eigenvalues are not ordered as required by SortEigenstuff to
+        // be the identity permutation. The arrays are local, which allows
+        // the compiler to vectorize the loops without aliasing tests.
+        static void SolveLanes(std::array<T const*, 6> const& A,
+            std::array<T*, 3> const& eigenvalues,
+            std::array<std::array<T*, 3>, 3> const& eigenvectors,
+            std::size_t base, std::size_t count, SymmetricEigensolver<T, 3>& solver)
+        {
+            std::array<Lanes, 6> a{}, s{};
+            std::array<Lanes, 3> eval{}, first{}, U{}, V{};
+            std::array<std::array<Lanes, 3>, 3> evec{};
+            Lanes maxAbsElement{}, divisor{}, norm{}, q{}, p{}, halfDet{};
+            Lanes beta0{}, beta2{}, dmax{}, lengthSqr{}, numer{}, denom{};
+            Lanes nonzero{}, selectPivot{}, select00{};
+
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                for (std::size_t j = 0; j < batchLanes; ++j)
+                {
+                    a[i][j] = A[i][base + (j < count ? j : 0)];
+                }
+            }
+
+            // The loops are split where a selection is followed by a
+            // division or square root. Otherwise, the compiler can move the
+            // operations into branches, which prevents vectorization.
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T max0 = std::max(std::fabs(a[0][j]), std::fabs(a[1][j]));
+                T max1 = std::max(std::fabs(a[2][j]), std::fabs(a[3][j]));
+                T max2 = std::max(std::fabs(a[4][j]), std::fabs(a[5][j]));
+                T maxAbs = std::max(std::max(max0, max1), max2);
+                maxAbsElement[j] = maxAbs;
+                divisor[j] = (maxAbs > C_<T>(0) ? maxAbs : C_<T>(1));
+            }
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T invMaxAbs = C_<T>(1) / divisor[j];
+                T a00 = a[0][j] * invMaxAbs;
+                T a01 = a[1][j] * invMaxAbs;
+                T a02 = a[2][j] * invMaxAbs;
+                T a11 = a[3][j] * invMaxAbs;
+                T a12 = a[4][j] * invMaxAbs;
+                T a22 = a[5][j] * invMaxAbs;
+                T locNorm = a01 * a01 + a02 * a02 + a12 * a12;
+
+                T locQ = (a00 + a11 + a22) / C_<T>(3);
+                T b00 = a00 - locQ;
+                T b11 = a11 - locQ;
+                T b22 = a22 - locQ;
+                T locP = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + locNorm * C_<T>(2)) / C_<T>(6));
+                T c00 = b11 * b22 - a12 * a12;
+                T c01 = a01 * b22 - a12 * a02;
+                T c02 = a01 * a12 - b11 * a02;
+                T det = (b00 * c00 - a01 * c01 + a02 * c02) / (locP * locP * locP);
+                T locHalfDet = det * C_<T>(1, 2);
+                locHalfDet = std::min(std::max(locHalfDet, -C_<T>(1)), C_<T>(1));
+
+                norm[j] = locNorm;
+                s[0][j] = a00;
+                s[1][j] = a01;
+                s[2][j] = a02;
+                s[3][j] = a11;
+                s[4][j] = a12;
+                s[5][j] = a22;
+                q[j] = locQ;
+                p[j] = locP;
+                halfDet[j] = locHalfDet;
+            }
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T angle = std::acos(halfDet[j]) / C_<T>(3);
+                beta2[j] = std::cos(angle) * C_<T>(2);
+                beta0[j] = std::cos(angle + C_<T>(2, 3) * C_PI<T>) * C_<T>(2);
+            }
+
+            // ComputeEigenvector0 for eval2 when halfDet >= 0 or for eval0
+            // otherwise. The selected cross product is stored in 'first'
+            // and normalized in the next loop.
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T a00 = s[0][j], a01 = s[1][j], a02 = s[2][j];
+                T a11 = s[3][j], a12 = s[4][j], a22 = s[5][j];
+                T beta1 = -(beta0[j] + beta2[j]);
+                T eval0 = q[j] + p[j] * beta0[j];
+                T eval1 = q[j] + p[j] * beta1;
+                T eval2 = q[j] + p[j] * beta2[j];
+                eval[0][j] = eval0;
+                eval[1][j] = eval1;
+                eval[2][j] = eval2;
+
+                T evalFirst = (halfDet[j] >= C_<T>(0) ? eval2 : eval0);
+                std::array<T, 3> row0 = { a00 - evalFirst, a01, a02 };
+                std::array<T, 3> row1 = { a01, a11 - evalFirst, a12 };
+                std::array<T, 3> row2 = { a02, a12, a22 - evalFirst };
+                std::array<T, 3> r0xr1 = Cross(row0, row1);
+                std::array<T, 3> r0xr2 = Cross(row0, row2);
+                std::array<T, 3> r1xr2 = Cross(row1, row2);
+                T d0 = Dot(r0xr1, r0xr1);
+                T d1 = Dot(r0xr2, r0xr2);
+                T d2 = Dot(r1xr2, r1xr2);
+                bool const select1 = (d1 > d0);
+                T locDmax = (select1 ? d1 : d0);
+                bool const select2 = (d2 > locDmax);
+                dmax[j] = (select2 ? d2 : locDmax);
+                first[0][j] = (select2 ? r1xr2[0] : (select1 ? r0xr2[0] : r0xr1[0]));
+                first[1][j] = (select2 ? r1xr2[1] : (select1 ? r0xr2[1] : r0xr1[1]));
+                first[2][j] = (select2 ? r1xr2[2] : (select1 ? r0xr2[2] : r0xr1[2]));
+            }
+
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T length = std::sqrt(dmax[j]);
+                T w0 = first[0][j] / length;
+                T w1 = first[1][j] / length;
+                T w2 = first[2][j] / length;
+                first[0][j] = w0;
+                first[1][j] = w1;
+                first[2][j] = w2;
+                lengthSqr[j] = (std::fabs(w0) > std::fabs(w1) ?
+                    w0 * w0 + w2 * w2 : w1 * w1 + w2 * w2);
+            }
+
+            // ComputeOrthogonalComplement for the first eigenvector and the
+            // 2x2 matrix M of ComputeEigenvector1 for eval1. The pivot of M
+            // is m00 when |m00| >= |m11| and m11 otherwise. The pair
+            // (pivot, m01) is normalized by dividing by the component of
+            // larger magnitude.
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T a00 = s[0][j], a01 = s[1][j], a02 = s[2][j];
+                T a11 = s[3][j], a12 = s[4][j], a22 = s[5][j];
+                std::array<T, 3> W = { first[0][j], first[1][j], first[2][j] };
+                bool const select0 = (std::fabs(W[0]) > std::fabs(W[1]));
+                T invLength = C_<T>(1) / std::sqrt(lengthSqr[j]);
+                std::array<T, 3> locU =
+                {
+                    (select0 ? -W[2] * invLength : C_<T>(0)),
+                    (select0 ? C_<T>(0) : +W[2] * invLength),
+                    (select0 ? +W[0] * invLength : -W[1] * invLength)
+                };
+                std::array<T, 3> locV = Cross(W, locU);
+
+                std::array<T, 3> AU =
+                {
+                    a00 * locU[0] + a01 * locU[1] + a02 * locU[2],
+                    a01 * locU[0] + a11 * locU[1] + a12 * locU[2],
+                    a02 * locU[0] + a12 * locU[1] + a22 * locU[2]
+                };
+
+                std::array<T, 3> AV =
+                {
+                    a00 * locV[0] + a01 * locV[1] + a02 * locV[2],
+                    a01 * locV[0] + a11 * locV[1] + a12 * locV[2],
+                    a02 * locV[0] + a12 * locV[1] + a22 * locV[2]
+                };
+
+                T eval1 = eval[1][j];
+                T m00 = locU[0] * AU[0] + locU[1] * AU[1] + locU[2] * AU[2] - eval1;
+                T m01 = locU[0] * AV[0] + locU[1] * AV[1] + locU[2] * AV[2];
+                T m11 = locV[0] * AV[0] + locV[1] * AV[1] + locV[2] * AV[2] - eval1;
+
+                T absM01 = std::fabs(m01);
+                bool const locSelect00 = (std::fabs(m00) >= std::fabs(m11));
+                T pivot = (locSelect00 ? m00 : m11);
+                T absPivot = std::fabs(pivot);
+                bool const locNonzero = (std::max(absPivot, absM01) > C_<T>(0));
+                bool const locSelectPivot = (absPivot >= absM01);
+                numer[j] = (locSelectPivot ? m01 : pivot);
+                denom[j] = (locNonzero ? (locSelectPivot ? pivot : m01) : C_<T>(1));
+                nonzero[j] = (locNonzero ? C_<T>(1) : C_<T>(0));
+                selectPivot[j] = (locSelectPivot ? C_<T>(1) : C_<T>(0));
+                select00[j] = (locSelect00 ? C_<T>(1) : C_<T>(0));
+                U[0][j] = locU[0];
+                U[1][j] = locU[1];
+                U[2][j] = locU[2];
+                V[0][j] = locV[0];
+                V[1][j] = locV[1];
+                V[2][j] = locV[2];
+            }
+
+            // Compute the second eigenvector and the third eigenvector as
+            // the cross product of the others.
+            for (std::size_t j = 0; j < batchLanes; ++j)
+            {
+                T ratio = numer[j] / denom[j];
+                T scale = C_<T>(1) / std::sqrt(C_<T>(1) + ratio * ratio);
+                ratio *= scale;
+                bool const locSelectPivot = (selectPivot[j] != C_<T>(0));
+                bool const locSelect00 = (select00[j] != C_<T>(0));
+                T pivotCoeff = (locSelectPivot ? scale : ratio);
+                T m01Coeff = (locSelectPivot ? ratio : scale);
+                T coeffU = (locSelect00 ? m01Coeff : pivotCoeff);
+                T coeffV = (locSelect00 ? pivotCoeff : m01Coeff);
+                std::array<T, 3> W = { first[0][j], first[1][j], first[2][j] };
+                bool const locNonzero = (nonzero[j] != C_<T>(0));
+                std::array<T, 3> middle =
+                {
+                    (locNonzero ? coeffU * U[0][j] - coeffV * V[0][j] : U[0][j]),
+                    (locNonzero ? coeffU * U[1][j] - coeffV * V[1][j] : U[1][j]),
+                    (locNonzero ? coeffU * U[2][j] - coeffV * V[2][j] : U[2][j])
+                };
+
+                bool const positive = (halfDet[j] >= C_<T>(0));
+                std::array<T, 3> last = Cross(
+                    (positive ? middle : W), (positive ? W : middle));
+                evec[0][0][j] = (positive ? last[0] : W[0]);
+                evec[0][1][j] = (positive ? last[1] : W[1]);
+                evec[0][2][j] = (positive ? last[2] : W[2]);
+                evec[1][0][j] = middle[0];
+                evec[1][1][j] = middle[1];
+                evec[1][2][j] = middle[2];
+                evec[2][0][j] = (positive ? W[0] : last[0]);
+                evec[2][1][j] = (positive ? W[1] : last[1]);
+                evec[2][2][j] = (positive ? W[2] : last[2]);
+
+                eval[0][j] *= maxAbsElement[j];
+                eval[1][j] *= maxAbsElement[j];
+                eval[2][j] *= maxAbsElement[j];
+            }
+
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                std::size_t const m = base + j;
+                if (maxAbsElement[j] > C_<T>(0) && norm[j] > C_<T>(0) &&
+                    eval[0][j] < eval[1][j] &&
+                    !(eval[2][j] < eval[0][j]) &&
+                    !(eval[2][j] < eval[1][j]))
+                {
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        eigenvalues[i][m] = eval[i][j];
+                        for (std::size_t k = 0; k < 3; ++k)
+                        {
+                            eigenvectors[i][k][m] = evec[i][k][j];
+                        }
+                    }
+                }
+                else
+                {
+                    solver(a[0][j], a[1][j], a[2][j], a[3][j], a[4][j], a[5][j], true);
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        eigenvalues[i][m] = solver.mEigenvalues[i];
+                        for (std::size_t k = 0; k < 3; ++k)
+                        {
+                            eigenvectors[i][k][m] = solver.mEigenvectors[i][k];
+                        }
+                    }
+                }
+            }
+        }
+
         std::array<T, 3> mEigenvalues;
         std::array<std::array<T, 3>, 3> mEigenvectors;
 
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -17,10 +17,15 @@
 // and deallocation costs and are expensive for find operations. If you know
 // the triangles in advance and no insertions or removals will occur, consider
 // using StaticVETManifoldMesh which performs much better, minimizes the
-// memory management costs and allows for multithreading.
+// memory management costs and allows for multithreading. If insertions and
+// removals occur but you do not need custom edge or triangle types, consider
+// using PooledETManifoldMesh, which has the same interface but stores the
+// edges and triangles in slabs with open-addressing hash tables for the key
+// lookups. Read the comments in MeshStorage.h.
 
 #include <GTL/Utility/Exceptions.h>
 #include <GTL/Mathematics/Meshes/EdgeKey.h>
+#include <GTL/Mathematics/Meshes/MeshStorage.h>
 #include <GTL/Mathematics/Meshes/TriangleKey.h>
 #include <algorithm>
 #include <array>
@@ -38,7 +43,8 @@
 
 namespace gtl
 {
-    class DynamicETManifoldMesh
+    template <typename Storage>
+    class BasicDynamicETManifoldMesh
     {
     public:
         // Use the maximum std::size_t to denote an invalid index, effectively
@@ -48,13 +54,13 @@ namespace gtl
         // Edge data types.
         class Edge;
         using ECreator = std::unique_ptr<Edge>(*)(std::size_t, std::size_t);
-        using EMap = std::unordered_map<EdgeKey<false>, std::unique_ptr<Edge>,
+        using EMap = typename Storage::template Map<EdgeKey<false>, Edge,
             EdgeKey<false>, EdgeKey<false>>;
 
         // Triangle data types.
         class Triangle;
         using TCreator = std::unique_ptr<Triangle>(*)(std::size_t, std::size_t, std::size_t);
-        using TMap = std::unordered_map<TriangleKey<true>, std::unique_ptr<Triangle>,
+        using TMap = typename Storage::template Map<TriangleKey<true>, Triangle,
             TriangleKey<true>, TriangleKey<true>>;
 
         // Edge object.
@@ -148,7 +154,8 @@ namespace gtl
         };
 
 
-        DynamicETManifoldMesh(ECreator eCreator = nullptr, TCreator tCreator = nullptr)
+        // The creators must be nullptr for MeshPoolStorage.
+        BasicDynamicETManifoldMesh(ECreator eCreator = nullptr, TCreator tCreator = nullptr)
             :
             mECreator(eCreator ? eCreator : CreateEdge),
             mEMap{},
@@ -156,19 +163,22 @@ namespace gtl
             mTMap{},
             mThrowOnNonmanifoldInsertion(true)
         {
+            GTL_ARGUMENT_ASSERT(
+                Storage::supportsCreators || (eCreator == nullptr && tCreator == nullptr),
+                "The storage does not support creators.");
         }
 
         // Deep copy semantics.
-        DynamicETManifoldMesh(DynamicETManifoldMesh const& mesh)
+        BasicDynamicETManifoldMesh(BasicDynamicETManifoldMesh const& mesh)
             :
-            DynamicETManifoldMesh{}
+            BasicDynamicETManifoldMesh{}
         {
             *this = mesh;
         }
 
-        virtual ~DynamicETManifoldMesh() = default;
+        virtual ~BasicDynamicETManifoldMesh() = default;
 
-        DynamicETManifoldMesh& operator=(DynamicETManifoldMesh const& mesh)
+        BasicDynamicETManifoldMesh& operator=(BasicDynamicETManifoldMesh const& mesh)
         {
             Clear();
 
@@ -221,80 +231,86 @@ namespace gtl
                 return nullptr;
             }
 
-            // Create the new triangle. It will be added to mTMap at the end
-            // of the function so that if an assertion is triggered and the
-            // function returns early, the (bad) triangle will not be part of
-            // the mesh.
-            std::unique_ptr<Triangle> newTri = mTCreator(v0, v1, v2);
-            Triangle* tri = newTri.get();
-
-            // Add the edges to the mesh if they do not already exist.
+            // Look up the edges and verify that the insertion keeps the mesh
+            // manifold before the mesh is modified. If an exception is
+            // thrown or a null pointer is returned, the mesh is unchanged.
+            std::array<std::size_t, 3> const V{ v0, v1, v2 };
+            std::array<Edge*, 3> edges{ nullptr, nullptr, nullptr };
             for (std::size_t i0 = 2, i1 = 0; i1 < 3; i0 = i1++)
             {
-                EdgeKey<false> ekey(tri->V[i0], tri->V[i1]);
-                Edge* edge = nullptr;
-                auto eiter = mEMap.find(ekey);
+                auto eiter = mEMap.find(EdgeKey<false>(V[i0], V[i1]));
                 if (eiter == mEMap.end())
                 {
                     // This is the first time the edge is encountered.
-                    std::unique_ptr<Edge> newEdge = mECreator(tri->V[i0], tri->V[i1]);
-                    edge = newEdge.get();
-                    mEMap[ekey] = std::move(newEdge);
-
-                    // Update the edge and triangle.
-                    edge->T[0] = tri;
-                    tri->E[i0] = edge;
+                    continue;
                 }
-                else
-                {
-                    // This is the second time the edge is encountered. With
-                    // a correct implementation, the GTL_RUNTIME_ASSERT should
-                    // not trigger.
-                    edge = eiter->second.get();
-                    GTL_RUNTIME_ASSERT(
-                        edge != nullptr,
-                        "Unexpected condition.");
 
-                    if (mThrowOnNonmanifoldInsertion)
+                // This is the second time the edge is encountered. With a
+                // correct implementation, the GTL_RUNTIME_ASSERT should not
+                // trigger.
+                Edge* edge = eiter->second.get();
+                GTL_RUNTIME_ASSERT(
+                    edge != nullptr && edge->T[0] != nullptr,
+                    "Unexpected condition.");
+
+                if (mThrowOnNonmanifoldInsertion)
+                {
+                    // The new triangle and edge->T[0] must have a shared
+                    // edge (V[i0],V[i1]). For the new triangle, the directed
+                    // edge is <V[i0],V[i1]>. For edge->T[0], the directed
+                    // edge must be <V[i1],V[i0]>.
+                    for (std::size_t j = 0; j < 3; ++j)
                     {
-                        // tri and edge->T[0] must have a shared edge
-                        // (tri->V[i0],tri->V[i1]). For tri, the directed
-                        // edge is <tri->V[i0],tri->V[i1]>. For edge->T[0],
-                        // the directed edge must be <tri->V[i1],tri->V[i0]>.
-                        for (std::size_t j = 0; j < 3; ++j)
+                        if (edge->T[0]->V[j] == V[i0])
                         {
-                            if (edge->T[0]->V[j] == tri->V[i0])
-                            {
-                                GTL_RUNTIME_ASSERT(
-                                    edge->T[0]->V[(j + 2) % 3] == tri->V[i1],
-                                    "Attempt to create nonmanifold mesh.");
-                            }
+                            GTL_RUNTIME_ASSERT(
+                                edge->T[0]->V[(j + 2) % 3] == V[i1],
+                                "Attempt to create nonmanifold mesh.");
                         }
                     }
+                }
 
-                    // Update the edge.
-                    if (edge->T[1])
+                if (edge->T[1])
+                {
+                    if (mThrowOnNonmanifoldInsertion)
                     {
-                        if (mThrowOnNonmanifoldInsertion)
-                        {
-                            GTL_RUNTIME_ERROR(
-                                "Attempt to create nonmanifold mesh.");
-                        }
-                        else
-                        {
-                            return nullptr;
-                        }
+                        GTL_RUNTIME_ERROR(
+                            "Attempt to create nonmanifold mesh.");
                     }
+                    else
+                    {
+                        return nullptr;
+                    }
+                }
+
+                edges[i0] = edge;
+            }
+
+            // Create the new triangle.
+            Triangle* tri = InsertMeshObject(mTMap, tkey, mTCreator, v0, v1, v2);
+
+            // Add the edges to the mesh if they do not already exist.
+            for (std::size_t i0 = 2, i1 = 0; i1 < 3; i0 = i1++)
+            {
+                Edge* edge = edges[i0];
+                if (edge == nullptr)
+                {
+                    // This is the first time the edge is encountered.
+                    EdgeKey<false> ekey(tri->V[i0], tri->V[i1]);
+                    edge = InsertMeshObject(mEMap, ekey, mECreator, tri->V[i0], tri->V[i1]);
+
+                    // Update the edge and triangle.
+                    edge->T[0] = tri;
+                    tri->E[i0] = edge;
+                }
+                else
+                {
+                    // This is the second time the edge is encountered.
+                    // Update the edge.
                     edge->T[1] = tri;
 
-                    // Update the adjacent triangles. With a correct
-                    // implementation, the GTL_RUNTIME_ASSERT should not
-                    // trigger.
+                    // Update the adjacent triangles.
                     auto adjacent = edge->T[0];
-                    GTL_RUNTIME_ASSERT(
-                        adjacent != nullptr,
-                        "Expecting a triangle.");
-
                     for (std::size_t j = 0; j < 3; ++j)
                     {
                         if (adjacent->E[j] == edge)
@@ -310,7 +326,6 @@ namespace gtl
                 }
             }
 
-            mTMap[tkey] = std::move(newTri);
             return tri;
         }
 
@@ -959,4 +974,7 @@ namespace gtl
     private:
         friend class UnitTestDynamicETManifoldMesh;
     };
+
+    using DynamicETManifoldMesh = BasicDynamicETManifoldMesh<MeshMapStorage>;
+    using PooledETManifoldMesh = BasicDynamicETManifoldMesh<MeshPoolStorage>;
 }
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -16,10 +16,15 @@
 // and deallocation costs and are expensive for find operations. If you know
 // the triangles in advance and no insertions or removals will occur, consider
 // using StaticVTSManifoldMesh which performs much better, minimizes the
-// memory management costs and allows for multithreading.
+// memory management costs and allows for multithreading. If insertions and
+// removals occur but you do not need custom triangle or tetrahedron types,
+// consider using PooledTSManifoldMesh, which has the same interface but
+// stores the triangles and tetrahedra in slabs with open-addressing hash
+// tables for the key lookups. Read the comments in MeshStorage.h.
 
 #include <GTL/Utility/Exceptions.h>
 #include <GTL/Utility/HashCombine.h>
+#include <GTL/Mathematics/Meshes/MeshStorage.h>
 #include <GTL/Mathematics/Meshes/TetrahedronKey.h>
 #include <GTL/Mathematics/Meshes/TriangleKey.h>
 #include <algorithm>
@@ -31,19 +36,20 @@
 
 namespace gtl
 {
-    class DynamicTSManifoldMesh
+    template <typename Storage>
+    class BasicDynamicTSManifoldMesh
     {
     public:
         // Triangle data types.
         class Triangle;
         using TCreator = std::unique_ptr<Triangle>(*)(std::size_t, std::size_t, std::size_t);
-        using TMap = std::unordered_map<TriangleKey<false>, std::unique_ptr<Triangle>,
+        using TMap = typename Storage::template Map<TriangleKey<false>, Triangle,
             TriangleKey<false>, TriangleKey<false>>;
 
         // Tetrahedron data types.
         class Tetrahedron;
         using SCreator = std::unique_ptr<Tetrahedron>(*)(std::size_t, std::size_t, std::size_t, std::size_t);
-        using SMap = std::unordered_map<TetrahedronKey<true>, std::unique_ptr<Tetrahedron>,
+        using SMap = typename Storage::template Map<TetrahedronKey<true>, Tetrahedron,
             TetrahedronKey<true>, TetrahedronKey<true>>;
 
         // Triangle object.
@@ -99,7 +105,8 @@ namespace gtl
         };
 
 
-        DynamicTSManifoldMesh(TCreator tCreator = nullptr, SCreator sCreator = nullptr)
+        // The creators must be nullptr for MeshPoolStorage.
+        BasicDynamicTSManifoldMesh(TCreator tCreator = nullptr, SCreator sCreator = nullptr)
             :
             mTCreator(tCreator ? tCreator : CreateTriangle),
             mTMap{},
@@ -107,6 +114,9 @@ namespace gtl
             mSMap{},
             mThrowOnNonmanifoldInsertion(true)
         {
+            GTL_ARGUMENT_ASSERT(
+                Storage::supportsCreators || (tCreator == nullptr && sCreator == nullptr),
+                "The storage does not support creators.");
         }
 
         // Support for a deep copy of the mesh. The mTMap and mSMap objects
@@ -114,16 +124,16 @@ namespace gtl
         // shallow copy of the pointers to this memory is problematic.
         // Allowing sharing, say, via std::shared_ptr, is an option but not
         // really the intent of copying the mesh graph.
-        DynamicTSManifoldMesh(DynamicTSManifoldMesh const& mesh)
+        BasicDynamicTSManifoldMesh(BasicDynamicTSManifoldMesh const& mesh)
             :
-            DynamicTSManifoldMesh{}
+            BasicDynamicTSManifoldMesh{}
         {
             *this = mesh;
         }
 
-        virtual ~DynamicTSManifoldMesh() = default;
+        virtual ~BasicDynamicTSManifoldMesh() = default;
 
-        DynamicTSManifoldMesh& operator=(DynamicTSManifoldMesh const& mesh)
+        BasicDynamicTSManifoldMesh& operator=(BasicDynamicTSManifoldMesh const& mesh)
         {
             Clear();
 
@@ -176,27 +186,65 @@ namespace gtl
                 return nullptr;
             }
 
-            // Create the new tetrahedron. It will be added to mTMap at the
-            // end of the function so that if an assertion is triggered and
-            // the function returns early, the (bad) triangle will not be
-            // part of the mesh.
-            std::unique_ptr<Tetrahedron> newTetra = mSCreator(v0, v1, v2, v3);
-            Tetrahedron* tetra = newTetra.get();
-
-            // Add the faces to the mesh if they do not already exist.
+            // Look up the faces and verify that the insertion keeps the mesh
+            // manifold before the mesh is modified. If an exception is
+            // thrown or a null pointer is returned, the mesh is unchanged.
+            // The face indices are copied because GetOppositeFace() returns
+            // a temporary array.
+            std::array<std::size_t, 4> const V{ v0, v1, v2, v3 };
+            auto const oppositeFace = TetrahedronKey<true>::GetOppositeFace();
+            std::array<Triangle*, 4> faces{ nullptr, nullptr, nullptr, nullptr };
             for (std::size_t i = 0; i < 4; ++i)
             {
-                auto const& opposite = TetrahedronKey<true>::GetOppositeFace()[i];
-                TriangleKey<false> tkey(tetra->V[opposite[0]], tetra->V[opposite[1]], tetra->V[opposite[2]]);
-                Triangle* face = nullptr;
+                auto const& opposite = oppositeFace[i];
+                TriangleKey<false> tkey(V[opposite[0]], V[opposite[1]], V[opposite[2]]);
                 auto titer = mTMap.find(tkey);
                 if (titer == mTMap.end())
                 {
                     // This is the first time the face is encountered.
-                    std::unique_ptr<Triangle> newFace = mTCreator(tetra->V[opposite[0]],
+                    continue;
+                }
+
+                // This is the second time the face is encountered. With a
+                // correct implementation, the GTL_RUNTIME_ASSERT should not
+                // trigger.
+                Triangle* face = titer->second.get();
+                GTL_RUNTIME_ASSERT(
+                    face != nullptr && face->S[0] != nullptr,
+                    "Expecting a face.");
+
+                if (face->S[1])
+                {
+                    if (mThrowOnNonmanifoldInsertion)
+                    {
+                        GTL_RUNTIME_ERROR(
+                            "Attempt to create nonmanifold mesh.");
+                    }
+                    else
+                    {
+                        return nullptr;
+                    }
+                }
+
+                faces[i] = face;
+            }
+
+            // Create the new tetrahedron.
+            Tetrahedron* tetra = InsertMeshObject(mSMap, skey, mSCreator, v0, v1, v2, v3);
+
+            // Add the faces to the mesh if they do not already exist.
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                Triangle* face = faces[i];
+                if (face == nullptr)
+                {
+                    // This is the first time the face is encountered.
+                    auto const& opposite = oppositeFace[i];
+                    TriangleKey<false> tkey(tetra->V[opposite[0]],
                         tetra->V[opposite[1]], tetra->V[opposite[2]]);
-                    face = newFace.get();
-                    mTMap[tkey] = std::move(newFace);
+                    face = InsertMeshObject(mTMap, tkey, mTCreator,
+                        tetra->V[opposite[0]], tetra->V[opposite[1]],
+                        tetra->V[opposite[2]]);
 
                     // Update the face and tetrahedron.
                     face->S[0] = tetra;
@@ -204,37 +252,12 @@ namespace gtl
                 }
                 else
                 {
-                    // This is the second time the face is encountered. With
-                    // a correct implementation, the GTL_RUNTIME_ASSERT should
-                    // not trigger.
-                    face = titer->second.get();
-                    GTL_RUNTIME_ASSERT(
-                        face != nullptr,
-                        "Expecting a face.");
-
+                    // This is the second time the face is encountered.
                     // Update the face.
-                    if (face->S[1])
-                    {
-                        if (mThrowOnNonmanifoldInsertion)
-                        {
-                            GTL_RUNTIME_ERROR(
-                                "Attempt to create nonmanifold mesh.");
-                        }
-                        else
-                        {
-                            return nullptr;
-                        }
-                    }
                     face->S[1] = tetra;
 
-                    // Update the adjacent tetrahedra. With a correct
-                    // implementation, the GTL_RUNTIME_ASSERT should not
-                    // trigger.
+                    // Update the adjacent tetrahedra.
                     auto adjacent = face->S[0];
-                    GTL_RUNTIME_ASSERT(
-                        adjacent != nullptr,
-                        "Expecting a tetrahedron.");
-
                     for (std::size_t j = 0; j < 4; ++j)
                     {
                         if (adjacent->T[j] == face)
@@ -250,7 +273,6 @@ namespace gtl
                 }
             }
 
-            mSMap[skey] = std::move(newTetra);
             return tetra;
         }
 
@@ -369,4 +391,7 @@ namespace gtl
     private:
         friend class UnitTestDynamicTSManifoldMesh;
     };
+
+    using DynamicTSManifoldMesh = BasicDynamicTSManifoldMesh<MeshMapStorage>;
+    using PooledTSManifoldMesh = BasicDynamicTSManifoldMesh<MeshPoolStorage>;
 }
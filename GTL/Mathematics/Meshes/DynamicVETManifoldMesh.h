@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -17,10 +17,15 @@
 // and deallocation costs and are expensive for find operations. If you know
 // the triangles in advance and no insertions or removals will occur, consider
 // using StaticVETManifoldMesh which performs much better, minimizes the
-// memory management costs and allows for multithreading.
+// memory management costs and allows for multithreading. If insertions and
+// removals occur but you do not need custom vertex, edge or triangle types,
+// consider using PooledVETManifoldMesh, which has the same interface but
+// stores the vertices, edges and triangles in slabs with open-addressing hash
+// tables for the key lookups. Read the comments in MeshStorage.h.
 
 #include <GTL/Mathematics/Meshes/DynamicETManifoldMesh.h>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,13 +33,23 @@
 
 namespace gtl
 {
-    class DynamicVETManifoldMesh : public DynamicETManifoldMesh
+    template <typename Storage>
+    class BasicDynamicVETManifoldMesh : public BasicDynamicETManifoldMesh<Storage>
     {
     public:
+        using Base = BasicDynamicETManifoldMesh<Storage>;
+        using Edge = typename Base::Edge;
+        using ECreator = typename Base::ECreator;
+        using EMap = typename Base::EMap;
+        using Triangle = typename Base::Triangle;
+        using TCreator = typename Base::TCreator;
+        using TMap = typename Base::TMap;
+
         // Vertex data types.
         class Vertex;
         using VCreator = std::unique_ptr<Vertex>(*)(std::size_t);
-        using VMap = std::unordered_map<std::size_t, std::unique_ptr<Vertex>>;
+        using VMap = typename Storage::template Map<std::size_t, Vertex,
+            std::hash<std::size_t>, std::equal_to<std::size_t>>;
 
         // Vertex object.
         class Vertex
@@ -62,14 +77,18 @@ namespace gtl
 
 
         // Construction and destruction.
-        virtual ~DynamicVETManifoldMesh() = default;
+        virtual ~BasicDynamicVETManifoldMesh() = default;
 
-        DynamicVETManifoldMesh(VCreator vCreator = nullptr, ECreator eCreator = nullptr, TCreator tCreator = nullptr)
+        // The creators must be nullptr for MeshPoolStorage.
+        BasicDynamicVETManifoldMesh(VCreator vCreator = nullptr, ECreator eCreator = nullptr, TCreator tCreator = nullptr)
             :
-            DynamicETManifoldMesh(eCreator, tCreator),
+            Base(eCreator, tCreator),
             mVCreator(vCreator ? vCreator : CreateVertex),
             mVMap{}
         {
+            GTL_ARGUMENT_ASSERT(
+                Storage::supportsCreators || vCreator == nullptr,
+                "The storage does not support creators.");
         }
 
         // Support for a deep copy of the mesh.  The mVMap, mEMap, and mTMap
@@ -77,18 +96,18 @@ namespace gtl
         // triangles.  A shallow copy of the pointers to this memory is
         // problematic.  Allowing sharing, say, via std::shared_ptr, is an
         // option but not really the intent of copying the mesh graph.
-        DynamicVETManifoldMesh(DynamicVETManifoldMesh const& mesh)
+        BasicDynamicVETManifoldMesh(BasicDynamicVETManifoldMesh const& mesh)
             :
-            DynamicVETManifoldMesh{}
+            BasicDynamicVETManifoldMesh{}
         {
             *this = mesh;
         }
 
-        DynamicVETManifoldMesh& operator=(DynamicVETManifoldMesh const& mesh)
+        BasicDynamicVETManifoldMesh& operator=(BasicDynamicVETManifoldMesh const& mesh)
         {
             Clear();
             mVCreator = mesh.mVCreator;
-            DynamicETManifoldMesh::operator=(mesh);
+            Base::operator=(mesh);
             return *this;
         }
 
@@ -104,7 +123,7 @@ namespace gtl
         // fails with a nullptr returned.
         virtual Triangle* Insert(std::size_t v0, std::size_t v1, std::size_t v2) override
         {
-            Triangle* tri = DynamicETManifoldMesh::Insert(v0, v1, v2);
+            Triangle* tri = Base::Insert(v0, v1, v2);
             if (!tri)
             {
                 return nullptr;
@@ -117,9 +136,7 @@ namespace gtl
                 Vertex* vertex = nullptr;
                 if (vItem == mVMap.end())
                 {
-                    std::unique_ptr<Vertex> newVertex = mVCreator(vIndex);
-                    vertex = newVertex.get();
-                    mVMap[vIndex] = std::move(newVertex);
+                    vertex = InsertMeshObject(mVMap, vIndex, mVCreator, vIndex);
                 }
                 else
                 {
@@ -157,8 +174,8 @@ namespace gtl
         // otherwise, <v0,v1,v2> is not in the mesh and 'false' is returned.
         virtual bool Remove(std::size_t v0, std::size_t v1, std::size_t v2) override
         {
-            auto tItem = mTMap.find(TriangleKey<true>(v0, v1, v2));
-            if (tItem == mTMap.end())
+            auto tItem = this->mTMap.find(TriangleKey<true>(v0, v1, v2));
+            if (tItem == this->mTMap.end())
             {
                 return false;
             }
@@ -209,14 +226,14 @@ namespace gtl
                 }
             }
 
-            return DynamicETManifoldMesh::Remove(v0, v1, v2);
+            return Base::Remove(v0, v1, v2);
         }
 
         // Destroy the vertices, edges, and triangles to obtain an empty mesh.
         virtual void Clear() override
         {
             mVMap.clear();
-            DynamicETManifoldMesh::Clear();
+            Base::Clear();
         }
 
     protected:
@@ -232,4 +249,7 @@ namespace gtl
     private:
         friend class UnitTestDynamicVETManifoldMesh;
     };
+
+    using DynamicVETManifoldMesh = BasicDynamicVETManifoldMesh<MeshMapStorage>;
+    using PooledVETManifoldMesh = BasicDynamicVETManifoldMesh<MeshPoolStorage>;
 }
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.15
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -17,10 +17,16 @@
 // and deallocation costs and are expensive for find operations. If you know
 // the triangles in advance and no insertions or removals will occur, consider
 // using StaticVTSManifoldMesh which performs much better, minimizes the
-// memory management costs and allows for multithreading.
+// memory management costs and allows for multithreading. If insertions and
+// removals occur but you do not need custom vertex, triangle or tetrahedron
+// types, consider using PooledVTSManifoldMesh, which has the same interface
+// but stores the vertices, triangles and tetrahedra in slabs with
+// open-addressing hash tables for the key lookups. Read the comments in
+// MeshStorage.h.
 
 #include <GTL/Mathematics/Meshes/DynamicTSManifoldMesh.h>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,13 +34,23 @@
 
 namespace gtl
 {
-    class DynamicVTSManifoldMesh : public DynamicTSManifoldMesh
+    template <typename Storage>
+    class BasicDynamicVTSManifoldMesh : public BasicDynamicTSManifoldMesh<Storage>
     {
     public:
+        using Base = BasicDynamicTSManifoldMesh<Storage>;
+        using Triangle = typename Base::Triangle;
+        using TCreator = typename Base::TCreator;
+        using TMap = typename Base::TMap;
+        using Tetrahedron = typename Base::Tetrahedron;
+        using SCreator = typename Base::SCreator;
+        using SMap = typename Base::SMap;
+
         // Vertex data types.
         class Vertex;
         using VCreator = std::unique_ptr<Vertex>(*)(std::size_t);
-        using VMap = std::unordered_map<std::size_t, std::unique_ptr<Vertex>>;
+        using VMap = typename Storage::template Map<std::size_t, Vertex,
+            std::hash<std::size_t>, std::equal_to<std::size_t>>;
 
         // Vertex object.
         class Vertex
@@ -62,14 +78,18 @@ namespace gtl
 
 
         // Construction and destruction.
-        virtual ~DynamicVTSManifoldMesh() = default;
+        virtual ~BasicDynamicVTSManifoldMesh() = default;
 
-        DynamicVTSManifoldMesh(VCreator vCreator = nullptr, TCreator tCreator = nullptr, SCreator sCreator = nullptr)
+        // The creators must be nullptr for MeshPoolStorage.
+        BasicDynamicVTSManifoldMesh(VCreator vCreator = nullptr, TCreator tCreator = nullptr, SCreator sCreator = nullptr)
             :
-            DynamicTSManifoldMesh(tCreator, sCreator),
+            Base(tCreator, sCreator),
             mVCreator(vCreator ? vCreator : CreateVertex),
             mVMap{}
         {
+            GTL_ARGUMENT_ASSERT(
+                Storage::supportsCreators || vCreator == nullptr,
+                "The storage does not support creators.");
         }
 
         // Support for a deep copy of the mesh. The mVMap, mTMap and mSMap
@@ -77,18 +97,18 @@ namespace gtl
         // and tetrahedra. A shallow copy of the pointers to this memory is
         // problematic. Allowing sharing, say, via std::shared_ptr, is an
         // option but not really the intent of copying the mesh graph.
-        DynamicVTSManifoldMesh(DynamicVTSManifoldMesh const& mesh)
+        BasicDynamicVTSManifoldMesh(BasicDynamicVTSManifoldMesh const& mesh)
             :
-            DynamicVTSManifoldMesh{}
+            BasicDynamicVTSManifoldMesh{}
         {
             *this = mesh;
         }
 
-        DynamicVTSManifoldMesh& operator=(DynamicVTSManifoldMesh const& mesh)
+        BasicDynamicVTSManifoldMesh& operator=(BasicDynamicVTSManifoldMesh const& mesh)
         {
             Clear();
             mVCreator = mesh.mVCreator;
-            DynamicTSManifoldMesh::operator=(mesh);
+            Base::operator=(mesh);
             return *this;
         }
 
@@ -104,7 +124,7 @@ namespace gtl
         // fails with a nullptr returned.
         virtual Tetrahedron* Insert(std::size_t v0, std::size_t v1, std::size_t v2, std::size_t v3) override
         {
-            Tetrahedron* tetra = DynamicTSManifoldMesh::Insert(v0, v1, v2, v3);
+            Tetrahedron* tetra = Base::Insert(v0, v1, v2, v3);
             if (!tetra)
             {
                 return nullptr;
@@ -117,9 +137,7 @@ namespace gtl
                 Vertex* vertex = nullptr;
                 if (vItem == mVMap.end())
                 {
-                    std::unique_ptr<Vertex> newVertex = mVCreator(vIndex);
-                    vertex = newVertex.get();
-                    mVMap[vIndex] = std::move(newVertex);
+                    vertex = InsertMeshObject(mVMap, vIndex, mVCreator, vIndex);
                 }
                 else
                 {
@@ -163,8 +181,8 @@ namespace gtl
         // otherwise, <v0,v1,v2> is not in the mesh and 'false' is returned.
         virtual bool Remove(std::size_t v0, std::size_t v1, std::size_t v2, std::size_t v3) override
         {
-            auto sItem = mSMap.find(TetrahedronKey<true>(v0, v1, v2, v3));
-            if (sItem == mSMap.end())
+            auto sItem = this->mSMap.find(TetrahedronKey<true>(v0, v1, v2, v3));
+            if (sItem == this->mSMap.end())
             {
                 return false;
             }
@@ -221,14 +239,14 @@ namespace gtl
                 }
             }
 
-            return DynamicTSManifoldMesh::Remove(v0, v1, v2, v3);
+            return Base::Remove(v0, v1, v2, v3);
         }
 
         // Destroy the vertices, edges, and triangles to obtain an empty mesh.
         virtual void Clear() override
         {
             mVMap.clear();
-            DynamicTSManifoldMesh::Clear();
+            Base::Clear();
         }
 
     protected:
@@ -244,4 +262,7 @@ namespace gtl
     private:
         friend class UnitTestDynamicVTSManifoldMesh;
     };
+
+    using DynamicVTSManifoldMesh = BasicDynamicVTSManifoldMesh<MeshMapStorage>;
+    using PooledVTSManifoldMesh = BasicDynamicVTSManifoldMesh<MeshPoolStorage>;
 }
@@ -0,0 +1,84 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// The storage back ends of the dynamic manifold meshes
+// BasicDynamicETManifoldMesh, BasicDynamicVETManifoldMesh,
+// BasicDynamicTSManifoldMesh and BasicDynamicVTSManifoldMesh. The meshes
+// store their vertices, edges, triangles and tetrahedra in maps from keys to
+// objects. The Storage template parameter of a mesh selects the map type
+// Storage::Map<Key, Object, Hasher, Equal>.
+//
+// MeshMapStorage uses std::unordered_map<Key, std::unique_ptr<Object>>.
+// Each object is allocated separately on the heap. The constructors of the
+// meshes accept creator functions, so applications can store objects of
+// classes derived from Vertex, Edge, Triangle or Tetrahedron. The classes
+// DynamicETManifoldMesh, DynamicVETManifoldMesh, DynamicTSManifoldMesh and
+// DynamicVTSManifoldMesh use this storage.
+//
+// MeshPoolStorage uses SlabHashMap<Key, Object>. The objects are stored in
+// slabs addressed by 32-bit handles and the keys are looked up in an
+// open-addressing hash table, so an insertion or removal does not allocate
+// or free memory once the slabs and table have grown to the working size,
+// and a traversal of the mesh visits contiguous memory. The objects must be
+// of the exact types Vertex, Edge, Triangle or Tetrahedron, so creator
+// functions are not supported. The classes PooledETManifoldMesh,
+// PooledVETManifoldMesh, PooledTSManifoldMesh and PooledVTSManifoldMesh use
+// this storage.
+
+#include <GTL/Utility/SlabHashMap.h>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace gtl
+{
+    class MeshMapStorage
+    {
+    public:
+        template <typename Key, typename Object, typename Hasher, typename Equal>
+        using Map = std::unordered_map<Key, std::unique_ptr<Object>, Hasher, Equal>;
+
+        static bool constexpr supportsCreators = true;
+    };
+
+    class MeshPoolStorage
+    {
+    public:
+        template <typename Key, typename Object, typename Hasher, typename Equal>
+        using Map = SlabHashMap<Key, Object, Hasher, Equal>;
+
+        static bool constexpr supportsCreators = false;
+    };
+
+    // Insert a new object for a key that is not in the map and return a
+    // pointer to the object. For MeshMapStorage, the object is created by
+    // creator(args...). For MeshPoolStorage, the object is constructed in
+    // place by Object(args...) and the creator is ignored.
+    template <typename Key, typename Object, typename Hasher, typename Equal,
+        typename Allocator, typename Creator, typename... Args>
+    Object* InsertMeshObject(
+        std::unordered_map<Key, std::unique_ptr<Object>, Hasher, Equal, Allocator>& map,
+        Key const& key, Creator creator, Args&&... args)
+    {
+        std::unique_ptr<Object> newObject = creator(std::forward<Args>(args)...);
+        Object* object = newObject.get();
+        map.insert(std::make_pair(key, std::move(newObject)));
+        return object;
+    }
+
+    template <typename Key, typename Object, typename Hasher, typename Equal,
+        typename Creator, typename... Args>
+    Object* InsertMeshObject(
+        SlabHashMap<Key, Object, Hasher, Equal>& map,
+        Key const& key, Creator, Args&&... args)
+    {
+        return map.try_emplace(key, std::forward<Args>(args)...).first->second.get();
+    }
+}
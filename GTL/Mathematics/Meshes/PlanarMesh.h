@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -11,7 +11,9 @@
 // searches for triangles containing a specified point. The type T must be
 // 'float' or 'double'. The input triangles are all counterclockwise in the
 // mesh. Set the number of threads to a positive number if you want the
-// underlying StaticVETManifoldMesh to use multithreading.
+// underlying StaticVETManifoldMesh to use multithreading. The threads are
+// the workers of a ThreadPool when one is provided; otherwise, std::thread
+// objects are launched.
 //
 // GetContainingTriangle* functions use a blend of interval arithmetic and
 // exact rational arithmetic to correctly determine containment.
@@ -23,11 +25,11 @@
 #include <GTL/Mathematics/Geometry/2D/ExactToTriangle2.h>
 #include <GTL/Mathematics/Meshes/StaticVETManifoldMesh.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -54,9 +56,9 @@ namespace gtl
 
         PlanarMesh(std::vector<Vector2<T>> const& positions,
             std::vector<std::array<std::size_t, 3>> const& triangles,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
         {
-            Create(positions, triangles, numThreads);
+            Create(positions, triangles, numThreads, pool);
         }
 
         // The inputs must represent a manifold mesh of triangles in the
@@ -69,14 +71,14 @@ namespace gtl
         // to use multithreading.
         void Create(std::vector<Vector2<T>> const& positions,
             std::vector<std::array<std::size_t, 3>> const& triangles,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 positions.size() >= 3 && triangles.size() > 0,
                 "Invalid number of points or triangles.");
 
             mPositions = positions;
-            mMesh.Create(positions.size(), triangles, numThreads);
+            mMesh.Create(positions.size(), triangles, numThreads, pool);
         }
 
         virtual ~PlanarMesh() = default;
@@ -203,7 +205,7 @@ namespace gtl
         // convex. The search is exhaustive over all triangles but uses
         // multithreading to help with performance.
         std::size_t GetContainingTriangleNotConvex(Vector2<T> const& P,
-            std::size_t numThreads) const
+            std::size_t numThreads, ThreadPool* pool = nullptr) const
         {
             // Use an exhaustive search. For performance, the search is
             // multithreaded.
@@ -232,11 +234,8 @@ namespace gtl
                 std::vector<std::pair<std::size_t, std::int32_t>> triSignPairs(
                     numThreads, std::make_pair(invalid, 1));
 
-                std::vector<std::thread> process(numThreads);
-                for (std::size_t i = 0; i < numThreads; ++i)
-                {
-                    process[i] = std::thread(
-                        [this, i, &tmin, &tsup, &triangles, &P, &triSignPairs, &foundTriangle]()
+                ForkJoin(pool, numThreads,
+                    [this, &tmin, &tsup, &triangles, &P, &triSignPairs, &foundTriangle](std::size_t i)
                     {
                         for (std::size_t t = tmin[i]; t < tsup[i]; ++t)
                         {
@@ -251,7 +250,7 @@ namespace gtl
                             auto const& V0 = mPositions[index[0]];
                             auto const& V1 = mPositions[index[1]];
                             auto const& V2 = mPositions[index[2]];
-                            std::int32_t sign = mETTQuery[0](P, V0, V1, V2);
+                            std::int32_t sign = mETTQuery[i](P, V0, V1, V2);
                             if (sign <= 0)
                             {
                                 triSignPairs[i] = std::make_pair(t, sign);
@@ -263,12 +262,6 @@ namespace gtl
                             }
                         }
                     });
-                }
-
-                for (std::size_t i = 0; i < numThreads; ++i)
-                {
-                    process[i].join();
-                }
 
                 if (foundTriangle)
                 {
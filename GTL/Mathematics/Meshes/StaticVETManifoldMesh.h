@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -18,12 +18,12 @@
 // useful when the numbers of vertices and triangles are large.
 
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <limits>
 #include <map>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -111,7 +111,7 @@ namespace gtl
         StaticVETManifoldMesh(
             std::size_t numVertices,
             std::vector<std::array<std::size_t, 3>> const& triangles,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
             :
             mVertices{},
             mStorage{},
@@ -120,7 +120,7 @@ namespace gtl
             mMinTrianglesAtVertex(0),
             mMaxTrianglesAtVertex(0)
         {
-            Create(numVertices, triangles, numThreads);
+            Create(numVertices, triangles, numThreads, pool);
         }
 
         ~StaticVETManifoldMesh() = default;
@@ -133,11 +133,12 @@ namespace gtl
         //   5. The triangles must all be ordered counterclockwise.
         // Set numThreads to 2 or larger to activate multithreading in the
         // mesh construction. If numThreads is 0 or 1, the construction
-        // occurs in the main thread.
+        // occurs in the main thread. The threads are the workers of 'pool'
+        // when it is not null; otherwise, std::thread objects are launched.
         void Create(
             std::size_t numVertices,
             std::vector<std::array<std::size_t, 3>> const& triangles,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numVertices >= 3 && triangles.size() > 0,
@@ -157,7 +158,7 @@ namespace gtl
             GetNumTrianglesAtVertex(numTrianglesAtVertex);
             InitializeStorage(numTrianglesAtVertex);
             Populate();
-            UpdateAdjacencyForSharedEdges(numThreads);
+            UpdateAdjacencyForSharedEdges(numThreads, pool);
         }
 
         // Member access.
@@ -435,7 +436,7 @@ namespace gtl
 
         // Update triangle adjacency information for edges that are shared by
         // two triangles.
-        void UpdateAdjacencyForSharedEdges(std::size_t numThreads)
+        void UpdateAdjacencyForSharedEdges(std::size_t numThreads, ThreadPool* pool)
         {
             if (numThreads <= 1)
             {
@@ -443,7 +444,7 @@ namespace gtl
             }
             else
             {
-                UpdateAdjacencyForSharedEdgesMultithreaded(numThreads);
+                UpdateAdjacencyForSharedEdgesMultithreaded(numThreads, pool);
             }
         }
 
@@ -455,7 +456,7 @@ namespace gtl
             }
         }
 
-        void UpdateAdjacencyForSharedEdgesMultithreaded(std::size_t numThreads)
+        void UpdateAdjacencyForSharedEdgesMultithreaded(std::size_t numThreads, ThreadPool* pool)
         {
             std::size_t const numVertices = mVertices.size();
             std::size_t const numVerticesPerThread = numVertices / numThreads;
@@ -467,22 +468,14 @@ namespace gtl
             }
             vsup.back() = numVertices;
 
-            std::vector<std::thread> process(numThreads);
-            for (std::size_t i = 0; i < numThreads; ++i)
-            {
-                process[i] = std::thread([this, i, &vmin, &vsup]()
+            ForkJoin(pool, numThreads,
+                [this, &vmin, &vsup](std::size_t i)
                 {
                     for (std::size_t v = vmin[i]; v < vsup[i]; ++v)
                     {
                         UpdateAdjacencyForEdge(v);
                     }
                 });
-            }
-
-            for (std::size_t i = 0; i < numThreads; ++i)
-            {
-                process[i].join();
-            }
         }
 
         void UpdateAdjacencyForEdge(std::size_t v0)
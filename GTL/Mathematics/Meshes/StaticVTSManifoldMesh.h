@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.15
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -19,12 +19,12 @@
 // and tetrahedra are large.
 
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <limits>
 #include <map>
-#include <thread>
 #include <vector>
 
 namespace gtl
@@ -131,11 +131,12 @@ namespace gtl
         //   5. The tetrahedra must all be ordered counterclockwise.
         // Set numThreads to 2 or larger to activate multithreading in the
         // mesh construction. If numThreads is 0 or 1, the construction
-        // occurs in the main thread.
+        // occurs in the main thread. The threads are the workers of 'pool'
+        // when it is not null; otherwise, std::thread objects are launched.
         void Create(
             std::size_t numVertices,
             std::vector<std::array<std::size_t, 4>> const& tetrahedra,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 numVertices >= 4 && tetrahedra.size() > 0,
@@ -155,7 +156,7 @@ namespace gtl
             GetNumTetrahedraAtVertex(numTetrahedraAtVertex);
             InitializeStorage(numTetrahedraAtVertex);
             PopulateVertices();
-            UpdateAdjacencyForSharedFaces(numThreads);
+            UpdateAdjacencyForSharedFaces(numThreads, pool);
         }
 
         // Member access.
@@ -314,7 +315,7 @@ namespace gtl
 
         // Update tetrahedra adjacency information for faces that are shared
         // by two tetrahedra.
-        void UpdateAdjacencyForSharedFaces(std::size_t numThreads)
+        void UpdateAdjacencyForSharedFaces(std::size_t numThreads, ThreadPool* pool)
         {
             if (numThreads <= 1)
             {
@@ -322,7 +323,7 @@ namespace gtl
             }
             else
             {
-                UpdateAdjacencyForSharedFacesMultithreaded(numThreads);
+                UpdateAdjacencyForSharedFacesMultithreaded(numThreads, pool);
             }
         }
 
@@ -334,7 +335,7 @@ namespace gtl
             }
         }
 
-        void UpdateAdjacencyForSharedFacesMultithreaded(std::size_t numThreads)
+        void UpdateAdjacencyForSharedFacesMultithreaded(std::size_t numThreads, ThreadPool* pool)
         {
             std::size_t const numVertices = mVertices.size();
             std::size_t const numVerticesPerThread = numVertices / numThreads;
@@ -346,22 +347,14 @@ namespace gtl
             }
             vsup.back() = numVertices;
 
-            std::vector<std::thread> process(numThreads);
-            for (std::size_t i = 0; i < numThreads; ++i)
-            {
-                process[i] = std::thread([this, i, &vmin, &vsup]()
+            ForkJoin(pool, numThreads,
+                [this, &vmin, &vsup](std::size_t i)
                 {
                     for (std::size_t v = vmin[i]; v < vsup[i]; ++v)
                     {
                         UpdateAdjacencyForFace(v);
                     }
                 });
-            }
-
-            for (std::size_t i = 0; i < numThreads; ++i)
-            {
-                process[i].join();
-            }
         }
 
         void UpdateAdjacencyForFace(std::size_t v0)
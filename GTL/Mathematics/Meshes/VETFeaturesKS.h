@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -13,11 +13,11 @@
 #include <GTL/Mathematics/Meshes/EdgeKey.h>
 #include <GTL/Mathematics/Meshes/TriangleKey.h>
 #include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <limits>
-#include <thread>
 #include <vector>
 
 namespace gtl
@@ -57,8 +57,11 @@ namespace gtl
         }
 
         // If the number of threads is larger than 1, the initialization of
-        // the vertices is multithreaded.
-        VETFeaturesKS(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads)
+        // the vertices is multithreaded. The threads are the workers of
+        // 'pool' when it is not null; otherwise, std::thread objects are
+        // launched.
+        VETFeaturesKS(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads,
+            ThreadPool* pool = nullptr)
             :
             mAdjacentGrowth(0),
             mVertexPool{}
@@ -67,12 +70,13 @@ namespace gtl
                 Dimension == 1 || Dimension == 2,
                 "Only edges and triangles are supported by VETFeaturesKS.");
 
-            Reset(maxVertices, adjacentGrowth, numThreads);
+            Reset(maxVertices, adjacentGrowth, numThreads, pool);
         }
 
         virtual ~VETFeaturesKS() = default;
 
-        void Reset(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads)
+        void Reset(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads,
+            ThreadPool* pool = nullptr)
         {
             if (maxVertices >= Dimension + 1)
             {
@@ -92,25 +96,16 @@ namespace gtl
                     }
                     vSup.back() = maxVertices;
 
-                    std::vector<std::thread> process(numThreads);
-                    for (std::size_t i = 0; i < numThreads; ++i)
-                    {
-                        process[i] = std::thread(
-                            [this, i, &vMin, &vSup]()
+                    ForkJoin(pool, numThreads,
+                        [this, &vMin, &vSup](std::size_t i)
+                        {
+                            for (std::size_t v = vMin[i]; v < vSup[i]; ++v)
                             {
-                                for (std::size_t v = vMin[i]; v < vSup[i]; ++v)
-                                {
-                                    auto& vertex = mVertexPool[v];
-                                    vertex.numAdjacent = 0;
-                                    vertex.adjacent.resize(mAdjacentGrowth);
-                                }
-                            });
-                    }
-
-                    for (std::size_t i = 0; i < numThreads; ++i)
-                    {
-                        process[i].join();
-                    }
+                                auto& vertex = mVertexPool[v];
+                                vertex.numAdjacent = 0;
+                                vertex.adjacent.resize(mAdjacentGrowth);
+                            }
+                        });
                 }
                 else
                 {
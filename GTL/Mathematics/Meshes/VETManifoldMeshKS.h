@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -28,12 +28,12 @@
 // polyline that represents a 2-dimensional convex hull.
 
 #include <GTL/Mathematics/Meshes/VETFeaturesKS.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <limits>
 #include <set>
-#include <thread>
 #include <vector>
 
 namespace gtl
@@ -68,18 +68,22 @@ namespace gtl
         }
 
         // If the number of threads is larger than 1, the initialization of
-        // the vertices is multithreaded.
-        VETManifoldMeshKS(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads)
+        // the vertices is multithreaded. The threads are the workers of
+        // 'pool' when it is not null; otherwise, std::thread objects are
+        // launched.
+        VETManifoldMeshKS(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads,
+            ThreadPool* pool = nullptr)
             :
             mAdjacentGrowth(0),
             mVertexPool{}
         {
-            Reset(maxVertices, adjacentGrowth, numThreads);
+            Reset(maxVertices, adjacentGrowth, numThreads, pool);
         }
 
         virtual ~VETManifoldMeshKS() = default;
 
-        void Reset(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads)
+        void Reset(std::size_t maxVertices, std::size_t adjacentGrowth, std::size_t numThreads,
+            ThreadPool* pool = nullptr)
         {
             if (maxVertices >= 3)
             {
@@ -99,25 +103,16 @@ namespace gtl
                     }
                     vSup.back() = maxVertices;
 
-                    std::vector<std::thread> process(numThreads);
-                    for (std::size_t i = 0; i < numThreads; ++i)
-                    {
-                        process[i] = std::thread(
-                            [this, i, &vMin, &vSup]()
+                    ForkJoin(pool, numThreads,
+                        [this, &vMin, &vSup](std::size_t i)
+                        {
+                            for (std::size_t v = vMin[i]; v < vSup[i]; ++v)
                             {
-                                for (std::size_t v = vMin[i]; v < vSup[i]; ++v)
-                                {
-                                    auto& vertex = mVertexPool[v];
-                                    vertex.numAdjacent = 0;
-                                    vertex.adjacent.resize(mAdjacentGrowth);
-                                }
-                            });
-                    }
-
-                    for (std::size_t i = 0; i < numThreads; ++i)
-                    {
-                        process[i].join();
-                    }
+                                auto& vertex = mVertexPool[v];
+                                vertex.numAdjacent = 0;
+                                vertex.adjacent.resize(mAdjacentGrowth);
+                            }
+                        });
                 }
                 else
                 {
@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2026.07.15
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -12,7 +12,9 @@
 // 'float' or 'double'. The input tetrahedra are all counterclockwise in the
 // mesh; see Tetrahedron3.h for a description of what that means. Set the
 // number of threads to a positive number if you want the underlying
-// StaticVTSManifoldMesh to use multithreading.
+// StaticVTSManifoldMesh to use multithreading. The threads are the workers of
+// a ThreadPool when one is provided; otherwise, std::thread objects are
+// launched.
 //
 // GetContainingTetrahedron* functions use a blend of interval arithmetic and
 // exact rational arithmetic to correctly determine containment.
@@ -24,11 +26,11 @@
 #include <GTL/Mathematics/Geometry/3D/ExactToTetrahedron3.h>
 #include <GTL/Mathematics/Meshes/StaticVTSManifoldMesh.h>
 #include <GTL/Mathematics/Algebra/Vector.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -62,14 +64,14 @@ namespace gtl
         // the underlying StaticVETManifoldMesh to use multithreading.
         void Create(std::vector<Vector3<T>> const& positions,
             std::vector<std::array<std::size_t, 4>> const& tetrahedra,
-            std::size_t numThreads)
+            std::size_t numThreads, ThreadPool* pool = nullptr)
         {
             GTL_ARGUMENT_ASSERT(
                 positions.size() >= 4 && tetrahedra.size() > 0,
                 "Invalid number of points or tetrahedra.");
 
             mPositions = positions;
-            mMesh.Create(positions.size(), tetrahedra, numThreads);
+            mMesh.Create(positions.size(), tetrahedra, numThreads, pool);
         }
 
         virtual ~VolumetricMesh() = default;
@@ -198,7 +200,7 @@ namespace gtl
         // convex. The search is exhaustive over all tetrahedra but uses
         // multithreading to help with performance.
         std::size_t GetContainingTetrahedronNotConvex(Vector3<T> const& P,
-            std::size_t numThreads) const
+            std::size_t numThreads, ThreadPool* pool = nullptr) const
         {
             // Use an exhaustive search. For performance, the search is
             // multithreaded.
@@ -227,44 +229,35 @@ namespace gtl
                 std::vector<std::pair<std::size_t, std::int32_t>> tetraSignPairs(
                     numThreads, std::make_pair(invalid, 1));
 
-                std::vector<std::thread> process(numThreads);
-                for (std::size_t i = 0; i < numThreads; ++i)
-                {
-                    process[i] = std::thread(
-                        [this, i, &tmin, &tsup, &tetrahedra, &P, &tetraSignPairs, &foundTetrahedron]()
+                ForkJoin(pool, numThreads,
+                    [this, &tmin, &tsup, &tetrahedra, &P, &tetraSignPairs, &foundTetrahedron](std::size_t i)
+                    {
+                        for (std::size_t t = tmin[i]; t < tsup[i]; ++t)
                         {
-                            for (std::size_t t = tmin[i]; t < tsup[i]; ++t)
+                            if (foundTetrahedron)
                             {
-                                if (foundTetrahedron)
-                                {
-                                    // See the comments before the declaration of
-                                    // foundTetrahedron.
-                                    return;
-                                }
-
-                                auto const& index = tetrahedra[t];
-                                auto const& V0 = mPositions[index[0]];
-                                auto const& V1 = mPositions[index[1]];
-                                auto const& V2 = mPositions[index[2]];
-                                auto const& V3 = mPositions[index[3]];
-                                std::int32_t sign = mETTQuery[i](P, V0, V1, V2, V3);
-                                if (sign <= 0)
-                                {
-                                    tetraSignPairs[i] = std::make_pair(t, sign);
-
-                                    // See the comments before the declaration of
-                                    // foundTetrahedron.
-                                    foundTetrahedron = true;
-                                    return;
-                                }
+                                // See the comments before the declaration of
+                                // foundTetrahedron.
+                                return;
                             }
-                        });
-                }
 
-                for (std::size_t i = 0; i < numThreads; ++i)
-                {
-                    process[i].join();
-                }
+                            auto const& index = tetrahedra[t];
+                            auto const& V0 = mPositions[index[0]];
+                            auto const& V1 = mPositions[index[1]];
+                            auto const& V2 = mPositions[index[2]];
+                            auto const& V3 = mPositions[index[3]];
+                            std::int32_t sign = mETTQuery[i](P, V0, V1, V2, V3);
+                            if (sign <= 0)
+                            {
+                                tetraSignPairs[i] = std::make_pair(t, sign);
+
+                                // See the comments before the declaration of
+                                // foundTetrahedron.
+                                foundTetrahedron = true;
+                                return;
+                            }
+                        }
+                    });
 
                 if (foundTetrahedron)
                 {
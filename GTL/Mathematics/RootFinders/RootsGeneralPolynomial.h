@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -43,11 +43,11 @@
 // polynomial values do not.
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
+#include <GTL/Utility/ThreadPool.h>
 #include <cstddef>
 #include <cstdint>
 #include <cmath>
 #include <limits>
-#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -60,7 +60,12 @@ namespace gtl
     public:
         using Rational = BSRational<UIntegerAP32>;
 
-        static void Solve(std::vector<T> const& p, bool useThreading, std::vector<T>& roots)
+        // When useThreading is true, the bisections on the intervals
+        // bounded by consecutive derivative roots are executed in parallel.
+        // If 'pool' is not null, the bisections are executed by the pool
+        // workers; otherwise, one std::thread is launched per interval.
+        static void Solve(std::vector<T> const& p, bool useThreading, std::vector<T>& roots,
+            ThreadPool* pool = nullptr)
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -123,7 +128,7 @@ namespace gtl
             // Compute Cauchy bounds and solve for roots using recursion on
             // the polynomial degree.
             std::vector<Rational> rRoots{};
-            InitiateSolver(rP, useThreading, rRoots);
+            InitiateSolver(rP, useThreading, pool, rRoots);
 
             // Convert the rational roots to floating-point.
             roots.resize(rRoots.size());
@@ -133,7 +138,8 @@ namespace gtl
             }
         }
 
-        static void Solve(std::vector<Rational> const& rP, bool useThreading, std::vector<Rational>& rRoots)
+        static void Solve(std::vector<Rational> const& rP, bool useThreading, std::vector<Rational>& rRoots,
+            ThreadPool* pool = nullptr)
         {
             static_assert(
                 std::is_floating_point<T>::value,
@@ -194,12 +200,12 @@ namespace gtl
 
             // Compute Cauchy bounds and solve for roots using recursion on
             // the polynomial degree.
-            InitiateSolver(rPMonic, useThreading, rRoots);
+            InitiateSolver(rPMonic, useThreading, pool, rRoots);
         }
 
     private:
         static void InitiateSolver(std::vector<Rational> const& rP, bool useThreading,
-            std::vector<Rational>& rRoots)
+            ThreadPool* pool, std::vector<Rational>& rRoots)
         {
             // Compute Cauchy bounds to obtain an interval containing the
             // roots of p(x). At this time the polynomial is monic.
@@ -216,11 +222,12 @@ namespace gtl
             rCauchyBound += static_cast<Rational>(1);
 
             // Solve recursively in degree.
-            SolveRecursive(rP, -rCauchyBound, rCauchyBound, useThreading, rRoots);
+            SolveRecursive(rP, -rCauchyBound, rCauchyBound, useThreading, pool, rRoots);
         }
 
         static void SolveRecursive(std::vector<Rational> const& rP, Rational const& rXMin,
-            Rational const& rXMax, bool useThreading, std::vector<Rational>& rRoots)
+            Rational const& rXMax, bool useThreading, ThreadPool* pool,
+            std::vector<Rational>& rRoots)
         {
             // The base of the recursion.
             Rational const rZero = static_cast<Rational>(0);
@@ -244,7 +251,7 @@ namespace gtl
 
             // Estimate the roots of the derivative polynomial.
             std::vector<Rational> rRootsDerivative{};
-            SolveRecursive(rPDerivative, rXMin, rXMax, true, rRootsDerivative);
+            SolveRecursive(rPDerivative, rXMin, rXMax, useThreading, pool, rRootsDerivative);
 
             // Round the coefficients of rP(x) to floating-point numbers. This
             // is used for fast performance by floating-point-based bisection.
@@ -263,51 +270,30 @@ namespace gtl
             {
                 if (useThreading)
                 {
-                    std::vector<std::thread> process(rRootsDerivative.size() + 1);
-                    std::vector<std::pair<Rational, bool>> rootInfo(process.size(),
+                    // Interval 0 is [rXMin,rRootsDerivative.front()],
+                    // interval i for 0 < i < n is [rRootsDerivative[i-1],
+                    // rRootsDerivative[i]] and interval n is
+                    // [rRootsDerivative.back(),rXMax], where n is
+                    // rRootsDerivative.size(). Estimate a root, if any, on
+                    // each interval.
+                    std::size_t const numIntervals = rRootsDerivative.size() + 1;
+                    std::vector<std::pair<Rational, bool>> rootInfo(numIntervals,
                         std::make_pair(Rational(0), false));
 
-                    // Let rXUpper = rRootsDerivative.front(). Estimate a
-                    // root, if any, on the interval [rXMin,rXUpper].
-                    process.front() = std::thread(
-                        [&tP, &rP, &rXMin, &rRootsDerivative, &rootInfo]()
-                        {
-                            rootInfo.front().second = Bisect(tP, rP,
-                            rXMin, rRootsDerivative.front(),
-                            rootInfo.front().first);
-                        });
-
-                    // Let rXLower = rRootsDerivative[i] and let rXUpper =
-                    // rRootsDerivative[i+1]. Estimate a root, if any, on
-                    // [rXLower,rXUpper].
-                    for (std::size_t i0 = 0, i1 = 1; i1 < rRootsDerivative.size(); i0 = i1++)
-                    {
-                        // The loop counters must be passed by value.
-                        // Otherwise, they will be modified for the next
-                        // process[] constructor but the previous process[] is
-                        // trying to use the older values.
-                        process[i1] = std::thread(
-                            [&tP, &rP, i0, i1, &rRootsDerivative, &rootInfo]()
-                            {
-                                rootInfo[i1].second = Bisect(tP, rP,
-                                rRootsDerivative[i0], rRootsDerivative[i1],
-                                rootInfo[i1].first);
-                            });
-                    }
-
-                    // Let rXLower = rRootsDerivative.back(). Estimate a root,
-                    // if any, on the interval [rXLower,rXMax].
-                    process.back() = std::thread(
-                        [&tP, &rP, &rRootsDerivative, &rXMax, &rootInfo]()
+                    ForkJoin(pool, numIntervals,
+                        [&tP, &rP, &rXMin, &rXMax, &rRootsDerivative, &rootInfo,
+                        numIntervals](std::size_t i)
                         {
-                            rootInfo.back().second = Bisect(tP, rP,
-                            rRootsDerivative.back(), rXMax,
-                            rootInfo.back().first);
+                            Rational const& rXLower =
+                                (i > 0 ? rRootsDerivative[i - 1] : rXMin);
+                            Rational const& rXUpper =
+                                (i + 1 < numIntervals ? rRootsDerivative[i] : rXMax);
+                            rootInfo[i].second = Bisect(tP, rP, rXLower, rXUpper,
+                                rootInfo[i].first);
                         });
 
-                    for (std::size_t i = 0; i < process.size(); ++i)
+                    for (std::size_t i = 0; i < numIntervals; ++i)
                     {
-                        process[i].join();
                         if (rootInfo[i].second)
                         {
                             rRoots.push_back(rootInfo[i].first);
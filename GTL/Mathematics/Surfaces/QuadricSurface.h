@@ -3,7 +3,7 @@
 // Copyright (c) 2025 Geometric Tools LLC
 // Distributed under the Boost Software License, Version 1.0
 // https://www.boost.org/LICENSE_1_0.txt
-// File Version: 0.0.2025.01.28
+// File Version: 0.0.2026.10.16
 
 #pragma once
 
@@ -26,6 +26,7 @@
 
 #include <GTL/Mathematics/Arithmetic/ArbitraryPrecision.h>
 #include <GTL/Mathematics/Algebra/Matrix.h>
+#include <GTL/Utility/ScratchArena.h>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -195,6 +196,10 @@ namespace gtl
                 return mClassification;
             }
 
+            // The rational temporaries are allocated from the thread-local
+            // scratch arena. Only the classification leaves this function.
+            ScratchArena::Scope scope{};
+
             // Convert the coefficients to their rational representations and
             // compute various derived quantities.
             Matrix3x3<Rational> rA{};
@@ -255,7 +260,7 @@ namespace gtl
         }
 
     private:
-        using Rational = BSRational<UIntegerAP32>;
+        using Rational = BSRational<UIntegerAP32Scratch>;
 
         // Use Descartes' rule of signs to determine the root signs.
         static void ComputeRootSigns(std::array<Rational, 4> const& rP,
@@ -0,0 +1,271 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// HashedUnique identifies the unique elements of an array using hashing
+// instead of the ordered std::map that the GTL deduplication code has used
+// historically. The elements are accessed only through two callbacks,
+//   std::uint64_t hashOf(std::size_t i)
+//   bool isEqual(std::size_t i, std::size_t j)
+// where equal elements must have equal hash values. The output numbers the
+// unique elements in the order of their first occurrence in the array:
+//   outToIn[k] is the index of the first occurrence of unique element k
+//   inToOut[i] is the unique-element number k of element i
+// This is the numbering produced by inserting the elements in index order
+// into std::map<Element, std::size_t> with the map size as the value, so
+// code using the map can switch to HashedUnique without changing its
+// output.
+//
+// When numThreads > 1, the elements are partitioned by the high-order bits
+// of their hashes, and each partition is processed by one task with its own
+// open-addressing table. Equal elements are in the same partition and each
+// partition is visited in increasing index order, so the output does not
+// depend on the number of threads or on scheduling. If 'pool' is not null,
+// the tasks are executed by the pool; otherwise, std::thread objects are
+// launched. The number of elements must be smaller than 2^32 - 1.
+
+#include <GTL/Utility/Exceptions.h>
+#include <GTL/Utility/ThreadPool.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace gtl
+{
+    class HashedUnique
+    {
+    public:
+        // The function returns the number of unique elements.
+        template <typename HashOf, typename IsEqual>
+        static std::size_t Execute(std::size_t numElements,
+            HashOf const& hashOf, IsEqual const& isEqual,
+            std::vector<std::size_t>& inToOut, std::vector<std::size_t>& outToIn,
+            std::size_t numThreads = 1, ThreadPool* pool = nullptr)
+        {
+            GTL_ARGUMENT_ASSERT(
+                numElements < static_cast<std::size_t>(invalid),
+                "Too many elements for 32-bit indices.");
+
+            inToOut.resize(numElements);
+            outToIn.clear();
+            if (numElements == 0)
+            {
+                return 0;
+            }
+
+            numThreads = std::max(std::min(numThreads, numElements), static_cast<std::size_t>(1));
+            auto GetRange = [numElements, numThreads](std::size_t t, std::size_t& imin, std::size_t& isup)
+            {
+                imin = (t * numElements) / numThreads;
+                isup = ((t + 1) * numElements) / numThreads;
+            };
+
+            // Compute the hash values and the number of elements of each
+            // chunk of the array that fall into each partition.
+            std::vector<std::uint64_t> hashes(numElements);
+            std::vector<std::size_t> counts(numThreads * numThreads, 0);
+            Run(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    std::size_t imin{}, isup{};
+                    GetRange(t, imin, isup);
+                    std::size_t* chunkCounts = &counts[t * numThreads];
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        hashes[i] = Mix(static_cast<std::uint64_t>(hashOf(i)));
+                        ++chunkCounts[GetPartition(hashes[i], numThreads)];
+                    }
+                });
+
+            // Sort the element indices by partition. The sort is stable, so
+            // each partition lists its elements in increasing index order.
+            // When there is a single partition, the order is the identity
+            // and is not stored.
+            std::vector<std::uint32_t> order{};
+            std::vector<std::size_t> partitionFirst(numThreads + 1, 0);
+            if (numThreads > 1)
+            {
+                std::vector<std::size_t> offsets(numThreads * numThreads);
+                std::size_t offset = 0;
+                for (std::size_t p = 0; p < numThreads; ++p)
+                {
+                    partitionFirst[p] = offset;
+                    for (std::size_t t = 0; t < numThreads; ++t)
+                    {
+                        offsets[t * numThreads + p] = offset;
+                        offset += counts[t * numThreads + p];
+                    }
+                }
+                partitionFirst[numThreads] = offset;
+
+                order.resize(numElements);
+                Run(pool, numThreads,
+                    [&](std::size_t t)
+                    {
+                        std::size_t imin{}, isup{};
+                        GetRange(t, imin, isup);
+                        std::size_t* chunkOffsets = &offsets[t * numThreads];
+                        for (std::size_t i = imin; i < isup; ++i)
+                        {
+                            std::size_t const p = GetPartition(hashes[i], numThreads);
+                            order[chunkOffsets[p]++] = static_cast<std::uint32_t>(i);
+                        }
+                    });
+            }
+            else
+            {
+                partitionFirst[1] = numElements;
+            }
+
+            // Find the first occurrence of each element. The index of the
+            // first occurrence of element i is stored in first[i].
+            std::vector<std::uint32_t> first(numElements);
+            Run(pool, numThreads,
+                [&](std::size_t p)
+                {
+                    std::size_t const kmin = partitionFirst[p];
+                    std::size_t const ksup = partitionFirst[p + 1];
+                    std::size_t numBuckets = 16;
+                    while (numBuckets < 2 * (ksup - kmin))
+                    {
+                        numBuckets *= 2;
+                    }
+                    std::uint64_t const mask = static_cast<std::uint64_t>(numBuckets - 1);
+                    std::vector<std::uint32_t> table(numBuckets, static_cast<std::uint32_t>(invalid));
+
+                    for (std::size_t k = kmin; k < ksup; ++k)
+                    {
+                        std::uint32_t const i = (order.size() > 0 ? order[k] : static_cast<std::uint32_t>(k));
+                        std::uint64_t const hash = hashes[i];
+                        std::size_t b = static_cast<std::size_t>(hash & mask);
+                        for (;;)
+                        {
+                            std::uint32_t const j = table[b];
+                            if (j == invalid)
+                            {
+                                table[b] = i;
+                                first[i] = i;
+                                break;
+                            }
+                            if (hashes[j] == hash && isEqual(j, i))
+                            {
+                                first[i] = j;
+                                break;
+                            }
+                            b = static_cast<std::size_t>((b + 1) & mask);
+                        }
+                    }
+                });
+
+            // Number the first occurrences in index order. The chunk counts
+            // are reused for the numbers of first occurrences per chunk.
+            Run(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    std::size_t imin{}, isup{};
+                    GetRange(t, imin, isup);
+                    std::size_t numFirst = 0;
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        if (first[i] == i)
+                        {
+                            ++numFirst;
+                        }
+                    }
+                    counts[t] = numFirst;
+                });
+
+            std::size_t numUnique = 0;
+            for (std::size_t t = 0; t < numThreads; ++t)
+            {
+                std::size_t const numFirst = counts[t];
+                counts[t] = numUnique;
+                numUnique += numFirst;
+            }
+            outToIn.resize(numUnique);
+
+            Run(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    std::size_t imin{}, isup{};
+                    GetRange(t, imin, isup);
+                    std::size_t k = counts[t];
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        if (first[i] == i)
+                        {
+                            inToOut[i] = k;
+                            outToIn[k] = i;
+                            ++k;
+                        }
+                    }
+                });
+
+            Run(pool, numThreads,
+                [&](std::size_t t)
+                {
+                    std::size_t imin{}, isup{};
+                    GetRange(t, imin, isup);
+                    for (std::size_t i = imin; i < isup; ++i)
+                    {
+                        if (first[i] != i)
+                        {
+                            inToOut[i] = inToOut[first[i]];
+                        }
+                    }
+                });
+
+            return numUnique;
+        }
+
+        // The 64-bit finalizer of MurmurHash3, which spreads the bits of
+        // weak hash functions before the partition and bucket bits are
+        // selected.
+        static inline std::uint64_t Mix(std::uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 33;
+            hash *= 0xC4CEB9FE1A85EC53ull;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        // Combine a hash value with another value.
+        static inline std::uint64_t Combine(std::uint64_t hash, std::uint64_t value)
+        {
+            return Mix(hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2)));
+        }
+
+    private:
+        static std::uint32_t constexpr invalid = std::numeric_limits<std::uint32_t>::max();
+
+        static inline std::size_t GetPartition(std::uint64_t hash, std::size_t numPartitions)
+        {
+            return static_cast<std::size_t>(((hash >> 32) * static_cast<std::uint64_t>(numPartitions)) >> 32);
+        }
+
+        template <typename Task>
+        static void Run(ThreadPool* pool, std::size_t numThreads, Task const& task)
+        {
+            if (numThreads > 1)
+            {
+                ForkJoin(pool, numThreads, task);
+            }
+            else
+            {
+                task(0);
+            }
+        }
+
+    private:
+        friend class UnitTestHashedUnique;
+    };
+}
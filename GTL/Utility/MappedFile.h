@@ -0,0 +1,496 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// A file mapped into the virtual address space of the process. The
+// operating system pages the file contents in on demand and writes modified
+// pages back to the file, so the mapped size may be much larger than the
+// physical memory of the machine. The mapping is shared, which means
+// modifications through a writable mapping are visible in the file.
+//
+// On Microsoft Windows the mapping uses CreateFileMapping/MapViewOfFile.
+// On other platforms it uses the POSIX open/mmap functions. A process with
+// a 32-bit address space can map only files whose size fits in std::size_t.
+//
+// The library is header-only, so the operating system headers are included
+// by this header and by the headers that include it, such as MappedImage.h.
+// It is the only header outside GTL/Graphics and GTL/Applications that does
+// so. On Windows, <windows.h> is included with NOMINMAX and
+// WIN32_LEAN_AND_MEAN defined, unless it was included earlier. The two
+// macros are undefined afterwards when this header defined them, but the
+// parts of <windows.h> they exclude remain excluded in the translation unit.
+// To use the min/max macros or the excluded parts, include <windows.h>
+// before this header. The code does not depend on the macros. On other
+// platforms, <fcntl.h>, <sys/mman.h>, <sys/stat.h> and <unistd.h> are
+// included.
+
+#include <GTL/Utility/Exceptions.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define GTL_MAPPED_FILE_DEFINED_NOMINMAX
+#endif
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#define GTL_MAPPED_FILE_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#if defined(GTL_MAPPED_FILE_DEFINED_NOMINMAX)
+#undef NOMINMAX
+#undef GTL_MAPPED_FILE_DEFINED_NOMINMAX
+#endif
+#if defined(GTL_MAPPED_FILE_DEFINED_WIN32_LEAN_AND_MEAN)
+#undef WIN32_LEAN_AND_MEAN
+#undef GTL_MAPPED_FILE_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gtl
+{
+    class MappedFile
+    {
+    public:
+        enum class Access
+        {
+            // Map an existing file for reading.
+            READ_ONLY,
+
+            // Map an existing file for reading and writing.
+            READ_WRITE,
+
+            // Create the file, or truncate an existing file, with the
+            // specified number of bytes and map it for reading and writing.
+            // The initial contents are zero.
+            CREATE
+        };
+
+        enum class Advice
+        {
+            // The pages are accessed in no particular pattern.
+            NORMAL,
+
+            // The pages are accessed sequentially, so the operating system
+            // may read ahead aggressively and release pages behind.
+            SEQUENTIAL,
+
+            // The pages are accessed randomly, so read-ahead is wasted.
+            RANDOM,
+
+            // The pages will be accessed soon and should be read now.
+            WILL_NEED,
+
+            // The pages will not be accessed soon. They are released from
+            // the working set of the process. Modified pages of a writable
+            // mapping are not lost; they are written to the file.
+            DONT_NEED
+        };
+
+        // The file is not mapped. Call Open to map a file.
+        MappedFile()
+            :
+#if defined(_WIN32)
+            mFile(INVALID_HANDLE_VALUE),
+            mMapping(nullptr),
+#endif
+            mData(nullptr),
+            mSize(0),
+            mWritable(false)
+        {
+        }
+
+        // Map the file. See the comments for Open.
+        MappedFile(std::string const& filename, Access access, std::uint64_t numBytes = 0)
+            :
+#if defined(_WIN32)
+            mFile(INVALID_HANDLE_VALUE),
+            mMapping(nullptr),
+#endif
+            mData(nullptr),
+            mSize(0),
+            mWritable(false)
+        {
+            Open(filename, access, numBytes);
+        }
+
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        // A mapping has a unique owner, so copy semantics are disabled.
+        MappedFile(MappedFile const&) = delete;
+        MappedFile& operator=(MappedFile const&) = delete;
+
+        // Move semantics.
+        MappedFile(MappedFile&& other) noexcept
+            :
+#if defined(_WIN32)
+            mFile(INVALID_HANDLE_VALUE),
+            mMapping(nullptr),
+#endif
+            mData(nullptr),
+            mSize(0),
+            mWritable(false)
+        {
+            *this = std::move(other);
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Close();
+#if defined(_WIN32)
+                mFile = other.mFile;
+                mMapping = other.mMapping;
+                other.mFile = INVALID_HANDLE_VALUE;
+                other.mMapping = nullptr;
+#endif
+                mData = other.mData;
+                mSize = other.mSize;
+                mWritable = other.mWritable;
+                other.mData = nullptr;
+                other.mSize = 0;
+                other.mWritable = false;
+            }
+            return *this;
+        }
+
+        // Map the file. For READ_ONLY and READ_WRITE, the file must exist.
+        // If numBytes is 0, the entire file is mapped; otherwise, the first
+        // numBytes bytes are mapped and the file must have at least that
+        // many bytes. For CREATE, numBytes must be positive and is the size
+        // of the file. Any previously mapped file is closed first. An
+        // exception is thrown when the operating system reports a failure.
+        void Open(std::string const& filename, Access access, std::uint64_t numBytes = 0)
+        {
+            GTL_ARGUMENT_ASSERT(
+                filename.size() > 0 && (access != Access::CREATE || numBytes > 0),
+                "Invalid argument.");
+
+            GTL_LENGTH_ASSERT(
+                IsAddressable(numBytes),
+                "The file is too large for the address space.");
+
+            Close();
+            bool const writable = (access != Access::READ_ONLY);
+
+#if defined(_WIN32)
+            DWORD const desired = (writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ);
+            DWORD const disposition = (access == Access::CREATE ? CREATE_ALWAYS : OPEN_EXISTING);
+            mFile = CreateFileA(filename.c_str(), desired, FILE_SHARE_READ, nullptr,
+                disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (mFile == INVALID_HANDLE_VALUE)
+            {
+                GTL_RUNTIME_ERROR("Cannot open the file.");
+            }
+
+            if (access != Access::CREATE)
+            {
+                LARGE_INTEGER fileSize{};
+                if (!GetFileSizeEx(mFile, &fileSize))
+                {
+                    Close();
+                    GTL_RUNTIME_ERROR("Cannot get the file size.");
+                }
+                if (!GetMappedSize(static_cast<std::uint64_t>(fileSize.QuadPart), numBytes))
+                {
+                    Close();
+                    GTL_LENGTH_ERROR("The file is empty, too small or too large.");
+                }
+            }
+
+            // For CREATE, the mapping object extends the empty file to the
+            // maximum size and the new bytes are zero.
+            DWORD const protect = (writable ? PAGE_READWRITE : PAGE_READONLY);
+            mMapping = CreateFileMappingA(mFile, nullptr, protect,
+                static_cast<DWORD>(numBytes >> 32),
+                static_cast<DWORD>(numBytes & 0xFFFFFFFFull), nullptr);
+            if (mMapping == nullptr)
+            {
+                Close();
+                GTL_RUNTIME_ERROR("Cannot create the file mapping.");
+            }
+
+            DWORD const viewAccess = (writable ? FILE_MAP_WRITE : FILE_MAP_READ);
+            void* view = MapViewOfFile(mMapping, viewAccess, 0, 0,
+                static_cast<SIZE_T>(numBytes));
+            if (view == nullptr)
+            {
+                Close();
+                GTL_RUNTIME_ERROR("Cannot map a view of the file.");
+            }
+#else
+            int const flags = (access == Access::CREATE ? O_RDWR | O_CREAT | O_TRUNC :
+                (writable ? O_RDWR : O_RDONLY));
+            int const fd = open(filename.c_str(), flags, 0644);
+            if (fd < 0)
+            {
+                GTL_RUNTIME_ERROR("Cannot open the file.");
+            }
+
+            if (access == Access::CREATE)
+            {
+                if (ftruncate(fd, static_cast<off_t>(numBytes)) != 0)
+                {
+                    (void)close(fd);
+                    GTL_RUNTIME_ERROR("Cannot set the file size.");
+                }
+            }
+            else
+            {
+                struct stat status{};
+                if (fstat(fd, &status) != 0)
+                {
+                    (void)close(fd);
+                    GTL_RUNTIME_ERROR("Cannot get the file size.");
+                }
+                if (!GetMappedSize(static_cast<std::uint64_t>(status.st_size), numBytes))
+                {
+                    (void)close(fd);
+                    GTL_LENGTH_ERROR("The file is empty, too small or too large.");
+                }
+            }
+
+            int const protect = (writable ? PROT_READ | PROT_WRITE : PROT_READ);
+            void* view = mmap(nullptr, static_cast<std::size_t>(numBytes), protect,
+                MAP_SHARED, fd, 0);
+
+            // The mapping remains valid after the file descriptor is closed.
+            (void)close(fd);
+            if (view == MAP_FAILED)
+            {
+                GTL_RUNTIME_ERROR("Cannot map the file.");
+            }
+#endif
+            mData = static_cast<std::uint8_t*>(view);
+            mSize = static_cast<std::size_t>(numBytes);
+            mWritable = writable;
+        }
+
+        // Unmap the file. Modified pages are written to the file by the
+        // operating system, but not necessarily before Close returns; call
+        // Flush first if the file must be up to date.
+        void Close() noexcept
+        {
+#if defined(_WIN32)
+            if (mData != nullptr)
+            {
+                (void)UnmapViewOfFile(mData);
+            }
+            if (mMapping != nullptr)
+            {
+                (void)CloseHandle(mMapping);
+                mMapping = nullptr;
+            }
+            if (mFile != INVALID_HANDLE_VALUE)
+            {
+                (void)CloseHandle(mFile);
+                mFile = INVALID_HANDLE_VALUE;
+            }
+#else
+            if (mData != nullptr)
+            {
+                (void)munmap(mData, mSize);
+            }
+#endif
+            mData = nullptr;
+            mSize = 0;
+            mWritable = false;
+        }
+
+        // Member access.
+        inline bool IsOpen() const noexcept
+        {
+            return mData != nullptr;
+        }
+
+        inline bool IsWritable() const noexcept
+        {
+            return mWritable;
+        }
+
+        inline std::uint8_t const* data() const noexcept
+        {
+            return mData;
+        }
+
+        inline std::uint8_t* data() noexcept
+        {
+            return mData;
+        }
+
+        inline std::size_t size() const noexcept
+        {
+            return mSize;
+        }
+
+        // Write the modified pages in the byte range [offset,offset+numBytes)
+        // to the file and wait for the writes to finish. The range is
+        // extended to page boundaries.
+        void Flush(std::size_t offset, std::size_t numBytes)
+        {
+            std::size_t begin = 0, end = 0;
+            if (!GetPageRange(offset, numBytes, begin, end) || !mWritable)
+            {
+                return;
+            }
+
+#if defined(_WIN32)
+            if (!FlushViewOfFile(mData + begin, end - begin) || !FlushFileBuffers(mFile))
+            {
+                GTL_RUNTIME_ERROR("Cannot flush the file.");
+            }
+#else
+            if (msync(mData + begin, end - begin, MS_SYNC) != 0)
+            {
+                GTL_RUNTIME_ERROR("Cannot flush the file.");
+            }
+#endif
+        }
+
+        void Flush()
+        {
+            Flush(0, mSize);
+        }
+
+        // Give the operating system a hint about how the byte range
+        // [offset,offset+numBytes) will be accessed. The range is extended
+        // to page boundaries. A hint that the platform does not support is
+        // ignored, because the hints never change the file contents.
+        void Advise(std::size_t offset, std::size_t numBytes, Advice advice)
+        {
+            std::size_t begin = 0, end = 0;
+            if (!GetPageRange(offset, numBytes, begin, end))
+            {
+                return;
+            }
+
+#if defined(_WIN32)
+            if (advice == Advice::DONT_NEED)
+            {
+                // Unlocking pages that are not locked removes them from the
+                // working set. The call reports an error in that case, which
+                // is the expected outcome.
+                (void)VirtualUnlock(mData + begin, end - begin);
+            }
+#if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+            else if (advice == Advice::WILL_NEED)
+            {
+                WIN32_MEMORY_RANGE_ENTRY range{};
+                range.VirtualAddress = mData + begin;
+                range.NumberOfBytes = end - begin;
+                (void)PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+            }
+#endif
+#else
+            int hint = POSIX_MADV_NORMAL;
+            switch (advice)
+            {
+            case Advice::SEQUENTIAL:
+                hint = POSIX_MADV_SEQUENTIAL;
+                break;
+            case Advice::RANDOM:
+                hint = POSIX_MADV_RANDOM;
+                break;
+            case Advice::WILL_NEED:
+                hint = POSIX_MADV_WILLNEED;
+                break;
+            case Advice::DONT_NEED:
+                // Modified pages must reach the file before they are
+                // released. POSIX_MADV_DONTNEED does not discard them, but
+                // writing them now bounds the amount of dirty memory when
+                // a large file is processed in one sweep.
+                if (mWritable)
+                {
+                    (void)msync(mData + begin, end - begin, MS_ASYNC);
+                }
+                hint = POSIX_MADV_DONTNEED;
+                break;
+            default:
+                break;
+            }
+            (void)posix_madvise(mData + begin, end - begin, hint);
+#endif
+        }
+
+        // The granularity of the operating system pages.
+        static std::size_t GetPageSize()
+        {
+#if defined(_WIN32)
+            SYSTEM_INFO info{};
+            GetSystemInfo(&info);
+            return static_cast<std::size_t>(info.dwPageSize);
+#else
+            return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        }
+
+    private:
+        static bool IsAddressable(std::uint64_t numBytes)
+        {
+            // The parentheses prevent the expansion of a max macro when
+            // <windows.h> was included without NOMINMAX.
+            return numBytes <= static_cast<std::uint64_t>((std::numeric_limits<std::size_t>::max)());
+        }
+
+        // Replace a requested size of 0 by the file size. The function
+        // returns false when the file is empty, when it is smaller than the
+        // requested size or when it does not fit in the address space.
+        static bool GetMappedSize(std::uint64_t fileSize, std::uint64_t& numBytes)
+        {
+            if (fileSize == 0 || numBytes > fileSize)
+            {
+                return false;
+            }
+            if (numBytes == 0)
+            {
+                numBytes = fileSize;
+            }
+            return IsAddressable(numBytes);
+        }
+
+        // Clamp [offset,offset+numBytes) to the mapping and extend it to
+        // page boundaries. The function returns false when the range is
+        // empty.
+        bool GetPageRange(std::size_t offset, std::size_t numBytes,
+            std::size_t& begin, std::size_t& end) const
+        {
+            if (mData == nullptr || offset >= mSize || numBytes == 0)
+            {
+                return false;
+            }
+
+            std::size_t const pageSize = GetPageSize();
+            begin = offset - offset % pageSize;
+            end = (numBytes < mSize - offset ? offset + numBytes : mSize);
+            return true;
+        }
+
+#if defined(_WIN32)
+        HANDLE mFile;
+        HANDLE mMapping;
+#endif
+        std::uint8_t* mData;
+        std::size_t mSize;
+        bool mWritable;
+
+        friend class UnitTestMappedFile;
+    };
+}
@@ -0,0 +1,332 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// A thread-local bump arena for short-lived temporaries. The motivating use
+// is exact arithmetic with BSNumber and BSRational on arbitrary-precision
+// integers, where every arithmetic operation creates temporaries whose
+// std::vector storage is allocated and deallocated on the global heap.
+// UIntegerAP32Scratch uses ScratchAllocator for its storage. While a ScratchArena::Scope object is
+// alive on a thread, the allocations of that thread are carved from the
+// thread's arena by bumping a pointer. When the Scope object is destroyed,
+// the arena is rewound to the state it had when the Scope object was
+// created. Outside of any scope, ScratchAllocator forwards to the global
+// operator new and operator delete.
+//
+// The arena memory is retained by the thread after the scope ends, so once
+// an exact predicate has been evaluated a few times, subsequent evaluations
+// perform no global heap allocations. The arena grows by adding chunks whose
+// sizes double, so the number of chunks remains small.
+//
+//   std::int32_t Predicate(...)
+//   {
+//       ScratchArena::Scope scope{};
+//       BSRational<UIntegerAP32Scratch> r0 = ..., r1 = ...;
+//       return (r0 * r1 - ...).GetSign();
+//   }
+//
+// IMPORTANT. Objects whose storage is allocated while a scope is alive must
+// be destroyed before the scope is destroyed; declare the Scope object
+// before the numbers in the same block. The objects must also not be passed
+// to other threads. Only plain values, such as the sign of a number or its
+// conversion to a floating-point type, may leave the scope. Scopes may be
+// nested; the inner scope rewinds only the memory allocated after it was
+// created.
+//
+// The arena of a thread is destroyed when the thread exits, which for the
+// main thread is before the objects with static storage duration are
+// destroyed. After that, ScratchAllocator uses the global heap, so numbers
+// created outside any scope may have static storage duration.
+
+#include <GTL/Utility/Exceptions.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace gtl
+{
+    class ScratchArena
+    {
+    private:
+        struct State;
+        static State& GetState();
+
+    public:
+        // The default number of bytes for the first chunk of a thread's
+        // arena.
+        static std::size_t constexpr defaultChunkBytes = 65536;
+
+        // While a Scope object is alive on the calling thread, ScratchAllocator
+        // allocates from the thread's arena. The constructor input ensures
+        // that the arena has at least 'numBytes' bytes available, which
+        // allows the caller to pay for the chunk allocation up front.
+        class Scope
+        {
+        public:
+            Scope(std::size_t numBytes = 0)
+                :
+                mState(GetState()),
+                mChunk(mState.current),
+                mOffset(mState.offset)
+            {
+                if (numBytes > 0)
+                {
+                    mState.Reserve(numBytes);
+                }
+                ++mState.depth;
+            }
+
+            ~Scope()
+            {
+                mState.current = mChunk;
+                mState.offset = mOffset;
+                --mState.depth;
+            }
+
+            Scope(Scope const&) = delete;
+            Scope& operator=(Scope const&) = delete;
+            Scope(Scope&&) = delete;
+            Scope& operator=(Scope&&) = delete;
+
+        private:
+            State& mState;
+            std::size_t mChunk, mOffset;
+        };
+
+        // Query whether the calling thread is inside a scope.
+        static bool IsActive()
+        {
+            return !IsDestroyed() && GetState().depth > 0;
+        }
+
+        // The number of bytes owned by the arena of the calling thread.
+        static std::size_t GetCapacity()
+        {
+            std::size_t capacity = 0;
+            for (auto const& chunk : GetState().chunks)
+            {
+                capacity += chunk.numBytes;
+            }
+            return capacity;
+        }
+
+        // Release the memory of the calling thread's arena. This function
+        // must not be called while a scope is alive.
+        static void Release()
+        {
+            State& state = GetState();
+            GTL_RUNTIME_ASSERT(
+                state.depth == 0,
+                "Cannot release the arena while a scope is alive.");
+
+            state.chunks.clear();
+            state.current = 0;
+            state.offset = 0;
+        }
+
+        // The allocation functions used by ScratchAllocator.
+        static void* Allocate(std::size_t numBytes)
+        {
+            if (IsDestroyed())
+            {
+                return ::operator new(numBytes);
+            }
+
+            State& state = GetState();
+            if (state.depth == 0)
+            {
+                return ::operator new(numBytes);
+            }
+            return state.Allocate(numBytes);
+        }
+
+        static void Deallocate(void* p, std::size_t numBytes)
+        {
+            if (IsDestroyed() || !GetState().Deallocate(p, numBytes))
+            {
+                ::operator delete(p);
+            }
+        }
+
+    private:
+        static std::size_t constexpr alignment = alignof(std::max_align_t);
+
+        static inline std::size_t RoundUp(std::size_t numBytes)
+        {
+            return (numBytes + alignment - 1) & ~(alignment - 1);
+        }
+
+        struct Chunk
+        {
+            Chunk(std::size_t inNumBytes)
+                :
+                memory(new unsigned char[inNumBytes]),
+                numBytes(inNumBytes)
+            {
+            }
+
+            std::unique_ptr<unsigned char[]> memory;
+            std::size_t numBytes;
+        };
+
+        // The flag is set when the state of the calling thread is
+        // destroyed. It is trivially destructible, so it can be read by the
+        // destructors that run later on the thread.
+        static bool& IsDestroyed()
+        {
+            static thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        struct State
+        {
+            State()
+                :
+                chunks{},
+                current(0),
+                offset(0),
+                depth(0)
+            {
+            }
+
+            ~State()
+            {
+                IsDestroyed() = true;
+            }
+
+            // Ensure that the current chunk or a later chunk has 'numBytes'
+            // bytes available.
+            void Reserve(std::size_t numBytes)
+            {
+                numBytes = RoundUp(numBytes);
+                for (std::size_t c = current; c < chunks.size(); ++c)
+                {
+                    std::size_t available = chunks[c].numBytes - (c == current ? offset : 0);
+                    if (available >= numBytes)
+                    {
+                        return;
+                    }
+                }
+                AddChunk(numBytes);
+            }
+
+            void* Allocate(std::size_t numBytes)
+            {
+                numBytes = RoundUp(numBytes);
+                while (current < chunks.size())
+                {
+                    Chunk& chunk = chunks[current];
+                    if (chunk.numBytes - offset >= numBytes)
+                    {
+                        void* p = chunk.memory.get() + offset;
+                        offset += numBytes;
+                        return p;
+                    }
+
+                    // The remainder of the current chunk is abandoned until
+                    // the enclosing scope rewinds the arena.
+                    ++current;
+                    offset = 0;
+                }
+
+                AddChunk(numBytes);
+                current = chunks.size() - 1;
+                offset = numBytes;
+                return chunks[current].memory.get();
+            }
+
+            // Return 'true' when 'p' belongs to the arena. The most recent
+            // allocation is reclaimed immediately, which is the common case
+            // when std::vector grows its storage.
+            bool Deallocate(void* p, std::size_t numBytes)
+            {
+                unsigned char* bytes = static_cast<unsigned char*>(p);
+                for (std::size_t c = 0; c < chunks.size(); ++c)
+                {
+                    unsigned char* begin = chunks[c].memory.get();
+                    if (begin <= bytes && bytes < begin + chunks[c].numBytes)
+                    {
+                        if (depth > 0 && c == current &&
+                            bytes + RoundUp(numBytes) == begin + offset)
+                        {
+                            offset = static_cast<std::size_t>(bytes - begin);
+                        }
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void AddChunk(std::size_t numBytes)
+            {
+                std::size_t chunkBytes = (chunks.size() > 0 ?
+                    2 * chunks.back().numBytes : defaultChunkBytes);
+                chunks.emplace_back(std::max(chunkBytes, numBytes));
+            }
+
+            std::vector<Chunk> chunks;
+            std::size_t current, offset, depth;
+        };
+    };
+
+    inline ScratchArena::State& ScratchArena::GetState()
+    {
+        static thread_local State state{};
+        return state;
+    }
+
+    // An allocator for standard containers that allocates from the calling
+    // thread's ScratchArena while a ScratchArena::Scope is alive and from
+    // the global heap otherwise. All instances are interchangeable.
+    template <typename T>
+    class ScratchAllocator
+    {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        ScratchAllocator() noexcept = default;
+
+        template <typename U>
+        ScratchAllocator(ScratchAllocator<U> const&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(ScratchArena::Allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            ScratchArena::Deallocate(p, n * sizeof(T));
+        }
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(ScratchAllocator<T> const&, ScratchAllocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    inline bool operator!=(ScratchAllocator<T> const&, ScratchAllocator<U> const&) noexcept
+    {
+        return false;
+    }
+}
@@ -0,0 +1,588 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// SlabHashMap<Key, Object> is a map from keys to objects whose interface is
+// the subset of std::unordered_map<Key, std::unique_ptr<Object>> that is
+// used by the mesh classes (begin, end, find, count, size, empty, erase,
+// clear) plus try_emplace(key, args...), which constructs the object in
+// place. The value_type is std::pair<Key const, Pointer>, where Pointer
+// has the get(), operator-> and operator* interface of std::unique_ptr, so
+// code written for the std::unordered_map of std::unique_ptr compiles for
+// SlabHashMap.
+//
+// The key-object pairs are stored in slabs (pages) of 2^pageShift slots.
+// A slot is identified by a 32-bit handle; the page is handle >> pageShift
+// and the slot within the page is handle & pageMask. Slabs are never moved
+// or released until the map is cleared or destroyed, so pointers to objects
+// remain valid until the objects are erased. Slots of erased objects are
+// recycled through a free list, most recently freed first, so a sequence of
+// erasures and insertions touches memory that is already cached.
+//
+// Key lookups use an open-addressing hash table with linear probing. A
+// bucket stores the 32-bit handle of a slot and a 32-bit tag of the key's
+// hash, so most failed comparisons do not touch the slot. The hash of the
+// key is multiplied by 2^64/phi (Fibonacci hashing) to spread the bits of
+// weak hash functions such as the identity hash of std::hash<std::size_t>.
+// Erasure uses backward-shift deletion, so there are no tombstones. The
+// table is doubled when its load factor would exceed 1/2.
+//
+// The Hasher and Equal types follow the conventions of the GTL key classes
+// EdgeKey, TriangleKey and TetrahedronKey: Hasher()(key) returns the hash
+// value and Equal()(key0, key1) returns true when the keys are equal.
+//
+// The iteration order is the order of the slots, not the insertion order.
+
+#include <GTL/Utility/Exceptions.h>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtl
+{
+    template <typename Key, typename Object, typename Hasher = Key, typename Equal = Key>
+    class SlabHashMap
+    {
+    public:
+        static std::uint32_t constexpr invalid = std::numeric_limits<std::uint32_t>::max();
+        static std::uint32_t constexpr pageShift = 10;
+        static std::uint32_t constexpr pageSize = (1u << pageShift);
+        static std::uint32_t constexpr pageMask = pageSize - 1;
+
+        // The std::unique_ptr-like access to an object stored in a slot.
+        class Pointer
+        {
+        public:
+            Pointer(Object* object = nullptr)
+                :
+                mObject(object)
+            {
+            }
+
+            inline Object* get() const
+            {
+                return mObject;
+            }
+
+            inline Object* operator->() const
+            {
+                return mObject;
+            }
+
+            inline Object& operator*() const
+            {
+                return *mObject;
+            }
+
+            inline explicit operator bool() const
+            {
+                return mObject != nullptr;
+            }
+
+        private:
+            Object* mObject;
+        };
+
+        using key_type = Key;
+        using mapped_type = Pointer;
+        using value_type = std::pair<Key const, Pointer>;
+        using size_type = std::size_t;
+
+    private:
+        struct Slot
+        {
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type value;
+            typename std::aligned_storage<sizeof(Object), alignof(Object)>::type object;
+            std::uint32_t nextFree;
+            bool occupied;
+        };
+
+        struct Bucket
+        {
+            std::uint32_t handle;
+            std::uint32_t tag;
+        };
+
+        template <bool IsConst>
+        class Iterator
+        {
+        public:
+            using MapType = typename std::conditional<IsConst, SlabHashMap const, SlabHashMap>::type;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename SlabHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename std::conditional<IsConst, value_type const*, value_type*>::type;
+            using reference = typename std::conditional<IsConst, value_type const&, value_type&>::type;
+
+            Iterator()
+                :
+                mMap(nullptr),
+                mHandle(0)
+            {
+            }
+
+            Iterator(MapType* map, std::uint32_t handle)
+                :
+                mMap(map),
+                mHandle(handle)
+            {
+            }
+
+            // Conversion from iterator to const_iterator.
+            template <bool OtherIsConst, typename = typename std::enable_if<IsConst && !OtherIsConst>::type>
+            Iterator(Iterator<OtherIsConst> const& other)
+                :
+                mMap(other.mMap),
+                mHandle(other.mHandle)
+            {
+            }
+
+            inline reference operator*() const
+            {
+                return mMap->GetValue(mHandle);
+            }
+
+            inline pointer operator->() const
+            {
+                return &mMap->GetValue(mHandle);
+            }
+
+            Iterator& operator++()
+            {
+                mHandle = mMap->NextOccupied(mHandle + 1);
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator saved = *this;
+                ++*this;
+                return saved;
+            }
+
+            inline bool operator==(Iterator const& other) const
+            {
+                return mHandle == other.mHandle;
+            }
+
+            inline bool operator!=(Iterator const& other) const
+            {
+                return mHandle != other.mHandle;
+            }
+
+            // The handle of the slot referenced by the iterator.
+            inline std::uint32_t GetHandle() const
+            {
+                return mHandle;
+            }
+
+        private:
+            friend class SlabHashMap;
+            template <bool> friend class Iterator;
+
+            MapType* mMap;
+            std::uint32_t mHandle;
+        };
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        SlabHashMap()
+            :
+            mPages{},
+            mNumSlots(0),
+            mFreeList(invalid),
+            mSize(0),
+            mBuckets{},
+            mBucketMask(0)
+        {
+        }
+
+        ~SlabHashMap()
+        {
+            clear();
+        }
+
+        // The objects are referenced by pointers in the mesh classes, so
+        // copying the map is disallowed. Moving preserves the addresses of
+        // the objects.
+        SlabHashMap(SlabHashMap const&) = delete;
+        SlabHashMap& operator=(SlabHashMap const&) = delete;
+
+        SlabHashMap(SlabHashMap&& other) noexcept
+            :
+            SlabHashMap{}
+        {
+            *this = std::move(other);
+        }
+
+        SlabHashMap& operator=(SlabHashMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                mPages = std::move(other.mPages);
+                mNumSlots = other.mNumSlots;
+                mFreeList = other.mFreeList;
+                mSize = other.mSize;
+                mBuckets = std::move(other.mBuckets);
+                mBucketMask = other.mBucketMask;
+                other.mPages.clear();
+                other.mNumSlots = 0;
+                other.mFreeList = invalid;
+                other.mSize = 0;
+                other.mBuckets.clear();
+                other.mBucketMask = 0;
+            }
+            return *this;
+        }
+
+        inline std::size_t size() const
+        {
+            return mSize;
+        }
+
+        inline bool empty() const
+        {
+            return mSize == 0;
+        }
+
+        iterator begin()
+        {
+            return iterator(this, NextOccupied(0));
+        }
+
+        iterator end()
+        {
+            return iterator(this, mNumSlots);
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(this, NextOccupied(0));
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(this, mNumSlots);
+        }
+
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        iterator find(Key const& key)
+        {
+            std::uint32_t const handle = FindHandle(key);
+            return (handle != invalid ? iterator(this, handle) : end());
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            std::uint32_t const handle = FindHandle(key);
+            return (handle != invalid ? const_iterator(this, handle) : end());
+        }
+
+        inline std::size_t count(Key const& key) const
+        {
+            return (FindHandle(key) != invalid ? 1 : 0);
+        }
+
+        // If the key is not in the map, construct Object(args...) in a slot
+        // and return the iterator to it and 'true'. Otherwise, return the
+        // iterator to the existing element and 'false'.
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(Key const& key, Args&&... args)
+        {
+            std::uint32_t const tag = GetTag(key);
+            std::uint32_t const found = FindHandle(key, tag);
+            if (found != invalid)
+            {
+                return std::make_pair(iterator(this, found), false);
+            }
+
+            if (2 * (mSize + 1) > mBuckets.size())
+            {
+                Rehash(mBuckets.size() > 0 ? 2 * mBuckets.size() : 16);
+            }
+
+            std::uint32_t const handle = AllocateSlot();
+            Slot& slot = GetSlot(handle);
+            Object* object = nullptr;
+            try
+            {
+                object = ::new (static_cast<void*>(&slot.object)) Object(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                FreeSlot(handle);
+                throw;
+            }
+            ::new (static_cast<void*>(&slot.value)) value_type(key, Pointer(object));
+            slot.occupied = true;
+            ++mSize;
+
+            std::uint32_t i = tag & mBucketMask;
+            while (mBuckets[i].handle != invalid)
+            {
+                i = (i + 1) & mBucketMask;
+            }
+            mBuckets[i].handle = handle;
+            mBuckets[i].tag = tag;
+            return std::make_pair(iterator(this, handle), true);
+        }
+
+        std::size_t erase(Key const& key)
+        {
+            std::uint32_t const tag = GetTag(key);
+            if (mBuckets.size() == 0)
+            {
+                return 0;
+            }
+
+            Equal equal{};
+            for (std::uint32_t i = tag & mBucketMask; mBuckets[i].handle != invalid; i = (i + 1) & mBucketMask)
+            {
+                if (mBuckets[i].tag == tag && equal(GetValue(mBuckets[i].handle).first, key))
+                {
+                    std::uint32_t const handle = mBuckets[i].handle;
+                    RemoveBucket(i);
+                    DestroySlot(handle);
+                    return 1;
+                }
+            }
+            return 0;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            std::uint32_t const handle = position.mHandle;
+            Key const& key = GetValue(handle).first;
+            std::uint32_t const tag = GetTag(key);
+            for (std::uint32_t i = tag & mBucketMask; mBuckets[i].handle != invalid; i = (i + 1) & mBucketMask)
+            {
+                if (mBuckets[i].handle == handle)
+                {
+                    RemoveBucket(i);
+                    break;
+                }
+            }
+            DestroySlot(handle);
+            return iterator(this, NextOccupied(handle + 1));
+        }
+
+        // Destroy the objects and release the memory.
+        void clear()
+        {
+            for (std::uint32_t handle = 0; handle < mNumSlots; ++handle)
+            {
+                Slot& slot = GetSlot(handle);
+                if (slot.occupied)
+                {
+                    reinterpret_cast<value_type*>(&slot.value)->~value_type();
+                    reinterpret_cast<Object*>(&slot.object)->~Object();
+                    slot.occupied = false;
+                }
+            }
+            mPages.clear();
+            mNumSlots = 0;
+            mFreeList = invalid;
+            mSize = 0;
+            mBuckets.clear();
+            mBucketMask = 0;
+        }
+
+        // Preallocate the hash table and the slabs for the specified number
+        // of elements.
+        void reserve(std::size_t numElements)
+        {
+            GTL_ARGUMENT_ASSERT(
+                numElements < static_cast<std::size_t>(invalid) / 2,
+                "Too many elements for 32-bit handles.");
+
+            std::size_t numBuckets = 16;
+            while (numBuckets < 2 * numElements)
+            {
+                numBuckets *= 2;
+            }
+            if (numBuckets > mBuckets.size())
+            {
+                Rehash(numBuckets);
+            }
+
+            while (static_cast<std::size_t>(mPages.size()) * pageSize < numElements)
+            {
+                mPages.push_back(std::unique_ptr<Slot[]>(new Slot[pageSize]));
+                InitializePage(mPages.back().get());
+            }
+        }
+
+    private:
+        inline Slot& GetSlot(std::uint32_t handle) const
+        {
+            return mPages[handle >> pageShift][handle & pageMask];
+        }
+
+        inline value_type& GetValue(std::uint32_t handle) const
+        {
+            return *reinterpret_cast<value_type*>(&GetSlot(handle).value);
+        }
+
+        static void InitializePage(Slot* page)
+        {
+            for (std::uint32_t i = 0; i < pageSize; ++i)
+            {
+                page[i].nextFree = invalid;
+                page[i].occupied = false;
+            }
+        }
+
+        std::uint32_t NextOccupied(std::uint32_t handle) const
+        {
+            while (handle < mNumSlots && !GetSlot(handle).occupied)
+            {
+                ++handle;
+            }
+            return handle;
+        }
+
+        static std::uint32_t GetTag(Key const& key)
+        {
+            std::uint64_t const hash = static_cast<std::uint64_t>(Hasher{}(key));
+            return static_cast<std::uint32_t>((hash * 0x9E3779B97F4A7C15ull) >> 32);
+        }
+
+        std::uint32_t FindHandle(Key const& key) const
+        {
+            return FindHandle(key, GetTag(key));
+        }
+
+        std::uint32_t FindHandle(Key const& key, std::uint32_t tag) const
+        {
+            if (mBuckets.size() == 0)
+            {
+                return invalid;
+            }
+
+            Equal equal{};
+            for (std::uint32_t i = tag & mBucketMask; mBuckets[i].handle != invalid; i = (i + 1) & mBucketMask)
+            {
+                if (mBuckets[i].tag == tag && equal(GetValue(mBuckets[i].handle).first, key))
+                {
+                    return mBuckets[i].handle;
+                }
+            }
+            return invalid;
+        }
+
+        void Rehash(std::size_t numBuckets)
+        {
+            std::vector<Bucket> oldBuckets = std::move(mBuckets);
+            mBuckets.assign(numBuckets, Bucket{ invalid, 0 });
+            mBucketMask = static_cast<std::uint32_t>(numBuckets - 1);
+            for (auto const& bucket : oldBuckets)
+            {
+                if (bucket.handle != invalid)
+                {
+                    std::uint32_t i = bucket.tag & mBucketMask;
+                    while (mBuckets[i].handle != invalid)
+                    {
+                        i = (i + 1) & mBucketMask;
+                    }
+                    mBuckets[i] = bucket;
+                }
+            }
+        }
+
+        // Backward-shift deletion for linear probing. The buckets following
+        // the removed one are moved back when their home buckets are not
+        // in the cyclic range (i, j].
+        void RemoveBucket(std::uint32_t i)
+        {
+            std::uint32_t j = i;
+            for (;;)
+            {
+                j = (j + 1) & mBucketMask;
+                if (mBuckets[j].handle == invalid)
+                {
+                    break;
+                }
+
+                std::uint32_t const home = mBuckets[j].tag & mBucketMask;
+                bool const inRange = (i <= j ? (i < home && home <= j) : (i < home || home <= j));
+                if (!inRange)
+                {
+                    mBuckets[i] = mBuckets[j];
+                    i = j;
+                }
+            }
+            mBuckets[i].handle = invalid;
+        }
+
+        std::uint32_t AllocateSlot()
+        {
+            if (mFreeList != invalid)
+            {
+                std::uint32_t const handle = mFreeList;
+                mFreeList = GetSlot(handle).nextFree;
+                return handle;
+            }
+
+            GTL_RUNTIME_ASSERT(
+                mNumSlots < invalid - pageSize,
+                "Too many elements for 32-bit handles.");
+
+            if ((mNumSlots >> pageShift) == mPages.size())
+            {
+                mPages.push_back(std::unique_ptr<Slot[]>(new Slot[pageSize]));
+                InitializePage(mPages.back().get());
+            }
+            return mNumSlots++;
+        }
+
+        void FreeSlot(std::uint32_t handle)
+        {
+            Slot& slot = GetSlot(handle);
+            slot.occupied = false;
+            slot.nextFree = mFreeList;
+            mFreeList = handle;
+        }
+
+        void DestroySlot(std::uint32_t handle)
+        {
+            Slot& slot = GetSlot(handle);
+            reinterpret_cast<value_type*>(&slot.value)->~value_type();
+            reinterpret_cast<Object*>(&slot.object)->~Object();
+            FreeSlot(handle);
+            --mSize;
+        }
+
+        std::vector<std::unique_ptr<Slot[]>> mPages;
+        std::uint32_t mNumSlots;
+        std::uint32_t mFreeList;
+        std::size_t mSize;
+        std::vector<Bucket> mBuckets;
+        std::uint32_t mBucketMask;
+
+    private:
+        friend class UnitTestSlabHashMap;
+    };
+}
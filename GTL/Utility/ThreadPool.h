@@ -0,0 +1,386 @@
+// Geometric Tools Library
+// https://www.geometrictools.com
+// Copyright (c) 2025 Geometric Tools LLC
+// Distributed under the Boost Software License, Version 1.0
+// https://www.boost.org/LICENSE_1_0.txt
+// File Version: 0.0.2026.10.16
+
+#pragma once
+
+// A work-stealing thread pool that is shared by the multithreaded GTL
+// algorithms. The classes that historically launched and joined their own
+// std::thread objects on every call accept an optional ThreadPool pointer.
+// When the pointer is not null, the tasks are executed by the pool workers
+// instead of by newly created threads.
+//
+// Each worker owns a double-ended queue of jobs. A worker pops its own jobs
+// from the back (most recently pushed first, which keeps the data of nested
+// fork-join calls warm in the cache) and steals jobs from the front of the
+// other workers' queues when its own queue is empty. A thread that calls
+// ForkJoin participates in the computation. While waiting for its tasks to
+// finish it executes pending jobs, so nested ForkJoin calls cannot deadlock
+// and the calling thread is never idle.
+//
+// The partitioning of work is deterministic. ForkJoin(numTasks, task) calls
+// task(t) exactly once for each t in {0..numTasks-1}, and ParallelFor uses a
+// partition that depends only on the number of items and the number of
+// chunks, never on the number of workers or on the scheduling order. An
+// algorithm that writes per-task outputs and combines them in task order
+// therefore produces bit-identical results whether it runs single-threaded,
+// with std::thread objects or with a pool of any size.
+
+#include <GTL/Utility/Exceptions.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gtl
+{
+    class ThreadPool
+    {
+    public:
+        // Create a pool with the specified number of worker threads. If
+        // numThreads is 0, the number of workers is the number of hardware
+        // threads reported by std::thread::hardware_concurrency().
+        ThreadPool(std::size_t numThreads = 0)
+            :
+            mQueues{},
+            mWorkers{},
+            mSleepMutex{},
+            mWakeup{},
+            mNumPending(0),
+            mNextQueue(0),
+            mStop(false)
+        {
+            if (numThreads == 0)
+            {
+                numThreads = std::max(static_cast<std::size_t>(
+                    std::thread::hardware_concurrency()), static_cast<std::size_t>(1));
+            }
+
+            mQueues.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i)
+            {
+                mQueues.push_back(std::make_unique<Queue>());
+            }
+
+            mWorkers.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i)
+            {
+                mWorkers.emplace_back([this, i]() { WorkerLoop(i); });
+            }
+        }
+
+        // The destructor finishes all pending jobs before joining the
+        // workers.
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mSleepMutex);
+                mStop = true;
+            }
+            mWakeup.notify_all();
+
+            for (auto& worker : mWorkers)
+            {
+                worker.join();
+            }
+        }
+
+        // The pool owns threads, so it cannot be copied or moved.
+        ThreadPool(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        inline std::size_t GetNumThreads() const
+        {
+            return mWorkers.size();
+        }
+
+        // Call task(t) for each t in {0..numTasks-1} and return after all
+        // the calls have completed. The function signature of the task is
+        // void(std::size_t). Task 0 is executed by the calling thread. If a
+        // task throws an exception, the first exception is rethrown in the
+        // calling thread after all tasks have completed.
+        template <typename Task>
+        void ForkJoin(std::size_t numTasks, Task const& task)
+        {
+            if (numTasks == 0)
+            {
+                return;
+            }
+
+            Group group(numTasks);
+            for (std::size_t t = 1; t < numTasks; ++t)
+            {
+                Push([&group, &task, t]()
+                {
+                    group.Execute(task, t);
+                });
+            }
+
+            group.Execute(task, 0);
+            Wait(group);
+
+            if (group.exception)
+            {
+                std::rethrow_exception(group.exception);
+            }
+        }
+
+        // Partition {0..numItems-1} into numChunks contiguous subranges and
+        // call function(chunk, imin, isup) for each chunk, where the chunk
+        // processes the indices i with imin <= i < isup. Every chunk except
+        // the last has numItems/numChunks indices. The last chunk includes
+        // the remaining indices. This is the same partition used throughout
+        // GTL for dividing work among std::thread objects. If numChunks is
+        // 0, the number of chunks is the number of workers.
+        template <typename Function>
+        void ParallelFor(std::size_t numItems, std::size_t numChunks, Function const& function)
+        {
+            if (numChunks == 0)
+            {
+                numChunks = GetNumThreads();
+            }
+            numChunks = std::max(std::min(numChunks, numItems), static_cast<std::size_t>(1));
+
+            std::size_t const load = numItems / numChunks;
+            ForkJoin(numChunks, [&function, numItems, numChunks, load](std::size_t chunk)
+            {
+                std::size_t imin = chunk * load;
+                std::size_t isup = (chunk + 1 < numChunks ? imin + load : numItems);
+                function(chunk, imin, isup);
+            });
+        }
+
+        // A pool shared by callers that do not want to manage their own. It
+        // is created on first use with one worker per hardware thread.
+        static ThreadPool& GetDefault()
+        {
+            static ThreadPool pool(0);
+            return pool;
+        }
+
+    private:
+        using Job = std::function<void()>;
+
+        struct Queue
+        {
+            Queue()
+                :
+                mutex{},
+                jobs{}
+            {
+            }
+
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        // The bookkeeping for a single ForkJoin call.
+        struct Group
+        {
+            Group(std::size_t numTasks)
+                :
+                remaining(numTasks),
+                exceptionMutex{},
+                exception{}
+            {
+            }
+
+            template <typename Task>
+            void Execute(Task const& task, std::size_t t)
+            {
+                try
+                {
+                    task(t);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            std::atomic<std::size_t> remaining;
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+        };
+
+        static std::size_t constexpr invalid = std::numeric_limits<std::size_t>::max();
+
+        // Each worker thread records its pool and queue index so that jobs
+        // pushed from within a job go to the worker's own queue.
+        static ThreadPool const*& CurrentPool()
+        {
+            static thread_local ThreadPool const* pool = nullptr;
+            return pool;
+        }
+
+        static std::size_t& CurrentIndex()
+        {
+            static thread_local std::size_t index = invalid;
+            return index;
+        }
+
+        inline std::size_t GetCallerIndex() const
+        {
+            return (CurrentPool() == this ? CurrentIndex() : invalid);
+        }
+
+        void Push(Job&& job)
+        {
+            std::size_t index = GetCallerIndex();
+            if (index == invalid)
+            {
+                index = mNextQueue.fetch_add(1, std::memory_order_relaxed) % mQueues.size();
+            }
+
+            {
+                // The increment occurs while the sleep mutex is held so that
+                // a worker cannot miss the notification between testing its
+                // wait predicate and blocking. It occurs before the job is
+                // queued so that the counter never underflows.
+                std::lock_guard<std::mutex> lock(mSleepMutex);
+                mNumPending.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mQueues[index]->mutex);
+                mQueues[index]->jobs.push_back(std::move(job));
+            }
+            mWakeup.notify_one();
+        }
+
+        // Pop from the back of the caller's own queue, if it has one, and
+        // otherwise steal from the front of the other queues.
+        bool TryPop(std::size_t index, Job& job)
+        {
+            std::size_t const numQueues = mQueues.size();
+            if (index != invalid)
+            {
+                Queue& queue = *mQueues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.jobs.empty())
+                {
+                    job = std::move(queue.jobs.back());
+                    queue.jobs.pop_back();
+                    mNumPending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            std::size_t const start = (index != invalid ? index + 1 : 0);
+            for (std::size_t k = 0; k < numQueues; ++k)
+            {
+                Queue& queue = *mQueues[(start + k) % numQueues];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.jobs.empty())
+                {
+                    job = std::move(queue.jobs.front());
+                    queue.jobs.pop_front();
+                    mNumPending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // The thread that called ForkJoin executes pending jobs until all
+        // tasks of its group have completed.
+        void Wait(Group& group)
+        {
+            std::size_t const index = GetCallerIndex();
+            Job job;
+            while (group.remaining.load(std::memory_order_acquire) > 0)
+            {
+                if (TryPop(index, job))
+                {
+                    job();
+                    job = nullptr;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void WorkerLoop(std::size_t index)
+        {
+            CurrentPool() = this;
+            CurrentIndex() = index;
+
+            Job job;
+            for (;;)
+            {
+                if (TryPop(index, job))
+                {
+                    job();
+                    job = nullptr;
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(mSleepMutex);
+                mWakeup.wait(lock, [this]()
+                {
+                    return mStop || mNumPending.load(std::memory_order_relaxed) > 0;
+                });
+
+                if (mStop && mNumPending.load(std::memory_order_relaxed) == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> mQueues;
+        std::vector<std::thread> mWorkers;
+        std::mutex mSleepMutex;
+        std::condition_variable mWakeup;
+        std::atomic<std::size_t> mNumPending;
+        std::atomic<std::size_t> mNextQueue;
+        bool mStop;
+    };
+
+    // Call task(t) for each t in {0..numTasks-1}. When the pool is not null,
+    // the calls are executed by the pool. When the pool is null, one
+    // std::thread is launched per task and all of them are joined before the
+    // function returns, which is the behavior of the GTL code that predates
+    // ThreadPool.
+    template <typename Task>
+    void ForkJoin(ThreadPool* pool, std::size_t numTasks, Task const& task)
+    {
+        if (pool != nullptr)
+        {
+            pool->ForkJoin(numTasks, task);
+        }
+        else
+        {
+            std::vector<std::thread> process(numTasks);
+            for (std::size_t t = 0; t < numTasks; ++t)
+            {
+                process[t] = std::thread([&task, t]() { task(t); });
+            }
+
+            for (std::size_t t = 0; t < numTasks; ++t)
+            {
+                process[t].join();
+            }
+        }
+    }
+}